@@ -66,6 +66,38 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep)
                                0)) ? -ENOTCONN : 0;
 }
 
+static int _set_remote(sock_udp_t *sock, struct netbuf *buf,
+                       sock_udp_ep_t *remote)
+{
+    size_t addr_len;
+
+#if LWIP_IPV6
+    if (sock->conn->type & NETCONN_TYPE_IPV6) {
+        addr_len = sizeof(ipv6_addr_t);
+        remote->family = AF_INET6;
+    }
+    else {
+#endif
+#if LWIP_IPV4
+        addr_len = sizeof(ipv4_addr_t);
+        remote->family = AF_INET;
+#else
+        return -EPROTO;
+#endif
+#if LWIP_IPV6
+    }
+#endif
+#if LWIP_NETBUF_RECVINFO
+    remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
+#else
+    remote->netif = SOCK_ADDR_ANY_NETIF;
+#endif
+    /* copy address */
+    memcpy(&remote->addr, &buf->addr, addr_len);
+    remote->port = buf->port;
+    return 0;
+}
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -83,33 +115,12 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         return -ENOBUFS;
     }
     if (remote != NULL) {
-        /* convert remote */
-        size_t addr_len;
-#if LWIP_IPV6
-        if (sock->conn->type & NETCONN_TYPE_IPV6) {
-            addr_len = sizeof(ipv6_addr_t);
-            remote->family = AF_INET6;
-        }
-        else {
-#endif
-#if LWIP_IPV4
-            addr_len = sizeof(ipv4_addr_t);
-            remote->family = AF_INET;
-#else
+        int err = _set_remote(sock, buf, remote);
+
+        if (err < 0) {
             netbuf_delete(buf);
-            return -EPROTO;
-#endif
-#if LWIP_IPV6
+            return err;
         }
-#endif
-#if LWIP_NETBUF_RECVINFO
-        remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
-#else
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-#endif
-        /* copy address */
-        memcpy(&remote->addr, &buf->addr, addr_len);
-        remote->port = buf->port;
     }
     /* copy data */
     for (struct pbuf *q = buf->p; q != NULL; q = q->next) {
@@ -120,6 +131,62 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     return (ssize_t)res;
 }
 
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
+{
+    struct netbuf *buf = *buf_ctx;
+    u16_t len;
+    int res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (buf != NULL) {
+        /* continue with the next pbuf of the chain */
+        if (netbuf_next(buf) < 0) {
+            netbuf_delete(buf);
+            *buf_ctx = NULL;
+            *data = NULL;
+            return 0;
+        }
+    }
+    else {
+        if ((res = lwip_sock_recv(sock->conn, timeout, &buf)) < 0) {
+            return res;
+        }
+        if ((remote != NULL) && ((res = _set_remote(sock, buf, remote)) < 0)) {
+            netbuf_delete(buf);
+            return res;
+        }
+        *buf_ctx = buf;
+    }
+    netbuf_data(buf, data, &len);
+    if (len == 0) {
+        /* a datagram without payload has no chunk, so 0 must not leave the
+         * buffer to a second call */
+        netbuf_delete(buf);
+        *buf_ctx = NULL;
+        *data = NULL;
+    }
+    return (ssize_t)len;
+}
+
+ssize_t sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                            size_t num, uint32_t timeout)
+{
+    size_t i;
+    ssize_t res = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        /* only wait for the first message */
+        if ((res = sock_udp_recv(sock, msgs[i].data, msgs[i].len,
+                                 (i == 0) ? timeout : 0, msgs[i].remote)) < 0) {
+            break;
+        }
+        msgs[i].len = res;
+    }
+    return (i > 0) ? (ssize_t)i : res;
+}
+
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote)
 {
@@ -133,4 +200,20 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                           NETCONN_UDP);
 }
 
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                            size_t num)
+{
+    size_t i;
+    ssize_t res = 0;
+
+    assert((sock != NULL) && ((num == 0) || (msgs != NULL)));
+    for (i = 0; i < num; i++) {
+        if ((res = sock_udp_send(sock, msgs[i].data, msgs[i].len,
+                                 msgs[i].remote)) < 0) {
+            break;
+        }
+    }
+    return (i > 0) ? (ssize_t)i : res;
+}
+
 /** @} */
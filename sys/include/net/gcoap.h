@@ -304,6 +304,10 @@ extern "C" {
 
 /**
  * @brief   Time in usec that the event loop waits for an incoming CoAP message
+ *
+ * @deprecated  Unused, the sock notifies the event loop of incoming messages
+ *              (see @ref GCOAP_MSG_TYPE_RECV). Will be removed after the next
+ *              release.
  */
 #ifndef GCOAP_RECV_TIMEOUT
 #define GCOAP_RECV_TIMEOUT      (1 * US_PER_SEC)
@@ -324,12 +328,12 @@ extern "C" {
 #define GCOAP_MSG_TYPE_TIMEOUT  (0x1501)
 
 /**
- * @brief   Identifies a request to interrupt listening for an incoming message
- *          on a sock
+ * @brief   Identifies the notification of a message received on the sock
  *
- * Allows the event loop to process IPC messages.
+ * The sock notifies the event loop with @ref net_sock_async, so the event loop
+ * only waits for IPC messages.
  */
-#define GCOAP_MSG_TYPE_INTR     (0x1502)
+#define GCOAP_MSG_TYPE_RECV     (0x1502)
 
 /**
  * @brief   Maximum number of Observe clients; use 2 if not defined
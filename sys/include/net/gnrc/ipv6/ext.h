@@ -37,6 +37,47 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Iterator over the IPv6 extension headers in a packet snip.
+ *
+ * The iterator walks the headers in place, i.e. the snip is neither split
+ * nor copied.
+ */
+typedef struct {
+    uint8_t *data;  /**< data of the walked snip */
+    size_t size;    /**< size of the walked snip */
+    size_t offset;  /**< offset of the current header in the snip */
+    uint8_t nh;     /**< protocol number of the current header */
+} gnrc_ipv6_ext_iter_t;
+
+/**
+ * @brief   Initializes an extension header iterator.
+ *
+ * @param[out] iter The iterator.
+ * @param[in] snip  The snip starting with the first header to walk.
+ * @param[in] nh    @ref net_protnum of the first header in @p snip.
+ */
+void gnrc_ipv6_ext_iter_init(gnrc_ipv6_ext_iter_t *iter, gnrc_pktsnip_t *snip,
+                             uint8_t nh);
+
+/**
+ * @brief   Gets the current extension header and advances the iterator to
+ *          the header following it.
+ *
+ * After a successful call gnrc_ipv6_ext_iter_t::nh contains the protocol
+ * number of the header following @p ext.
+ *
+ * @param[in,out] iter  The iterator.
+ * @param[out] ext      The current extension header.
+ *
+ * @return  1, if @p ext was set to an extension header.
+ * @return  0, if the current header is not an extension header (i.e. the
+ *          upper layer header or no header at all was reached).
+ * @return  -EOVERFLOW, if the current extension header does not fit into the
+ *          remaining data of the snip.
+ */
+int gnrc_ipv6_ext_iter_next(gnrc_ipv6_ext_iter_t *iter, ipv6_ext_t **ext);
+
 /**
  * @brief   Demultiplex extension headers according to @p nh.
  *
@@ -50,6 +91,11 @@ extern "C" {
  * This situation may happen when the packet has a source routing extension
  * header (RFC 6554), and the packet is forwarded from an interface to another.
  *
+ * The extension headers are walked in place using @ref gnrc_ipv6_ext_iter_t.
+ * Headers that are not yet marked are only split off the payload once, as a
+ * single snip of type @ref GNRC_NETTYPE_IPV6_EXT, when the packet is handed to
+ * the upper layer.
+ *
  * @internal
  *
  * @param[in] iface     The receiving interface.
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_pmtu IPv6 path MTU cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Per-destination path MTU cache fed by ICMPv6 Packet Too Big
+ *              messages
+ * @see <a href="https://tools.ietf.org/html/rfc8201">RFC 8201</a>
+ *
+ * Entries are created or lowered by @ref gnrc_ipv6_pmtu_update() (called by
+ * @ref net_gnrc_icmpv6 on reception of a Packet Too Big message) and expire
+ * after @ref GNRC_IPV6_PMTU_TIMEOUT seconds, so that a larger path MTU can be
+ * rediscovered.
+ * @{
+ *
+ * @file
+ * @brief   IPv6 path MTU cache definitions
+ */
+#ifndef NET_GNRC_IPV6_PMTU_H
+#define NET_GNRC_IPV6_PMTU_H
+
+#include <stdint.h>
+
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of destinations in the path MTU cache.
+ */
+#ifndef GNRC_IPV6_PMTU_CACHE_SIZE
+#define GNRC_IPV6_PMTU_CACHE_SIZE   (4)
+#endif
+
+/**
+ * @brief   Time in seconds after which a path MTU estimate expires.
+ *
+ * RFC 8201, section 4 recommends 10 minutes and requires at least 5 minutes.
+ */
+#ifndef GNRC_IPV6_PMTU_TIMEOUT
+#define GNRC_IPV6_PMTU_TIMEOUT      (600U)
+#endif
+
+/**
+ * @brief   Updates the path MTU for a destination.
+ *
+ * The path MTU is only ever lowered by this function. Values lower than
+ * @ref IPV6_MIN_MTU are ignored (see RFC 8201, section 4).
+ * If the cache is full the entry that expires first is replaced.
+ *
+ * @param[in] dst   The destination address.
+ * @param[in] mtu   The MTU reported for the path to @p dst.
+ */
+void gnrc_ipv6_pmtu_update(const ipv6_addr_t *dst, uint32_t mtu);
+
+/**
+ * @brief   Gets the path MTU for a destination.
+ *
+ * @param[in] dst   The destination address.
+ *
+ * @return  The path MTU towards @p dst.
+ * @return  0, if no (unexpired) path MTU for @p dst is known.
+ */
+uint16_t gnrc_ipv6_pmtu_get(const ipv6_addr_t *dst);
+
+/**
+ * @brief   Removes a destination from the path MTU cache.
+ *
+ * Addresses not in the cache will be ignored.
+ *
+ * @param[in] dst   The destination address.
+ */
+void gnrc_ipv6_pmtu_del(const ipv6_addr_t *dst);
+
+/**
+ * @brief   Empties the path MTU cache.
+ */
+void gnrc_ipv6_pmtu_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_PMTU_H */
+/** @} */
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_mpl MPL
+ * @ingroup     net_gnrc
+ * @brief       Multicast Protocol for Low-Power and Lossy Networks
+ * @see <a href="https://tools.ietf.org/html/rfc7731">RFC 7731</a>
+ *
+ * MPL disseminates multicast packets by letting every forwarder retransmit
+ * each new message a few times, paced by a @ref sys_trickle "trickle" timer.
+ * Messages are encapsulated IPv6-in-IPv6 to @ref GNRC_MPL_ALL_FORWARDERS_ADDR
+ * with an MPL option in a Hop-by-Hop options header. The option is checked by
+ * @ref net_gnrc_ipv6_ext before the inner packet is decapsulated, so
+ * duplicates are neither delivered nor forwarded.
+ *
+ * This implementation only does proactive forwarding: MPL control messages
+ * are neither sent nor processed (this is allowed by RFC 7731, section 5.4,
+ * with `PROACTIVE_FORWARDING` set and `CONTROL_MESSAGE_TIMER_EXPIRATIONS` 0).
+ * Seed IDs are always taken from the outer source address (S = 0).
+ *
+ * @{
+ *
+ * @file
+ * @brief   MPL definitions
+ */
+#ifndef NET_GNRC_MPL_H
+#define NET_GNRC_MPL_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/pkt.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/ext.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default stack size to use for the MPL thread
+ */
+#ifndef GNRC_MPL_STACK_SIZE
+#define GNRC_MPL_STACK_SIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Default priority for the MPL thread
+ */
+#ifndef GNRC_MPL_PRIO
+#define GNRC_MPL_PRIO           (GNRC_IPV6_PRIO + 1)
+#endif
+
+/**
+ * @brief   Default message queue size to use for the MPL thread.
+ */
+#ifndef GNRC_MPL_MSG_QUEUE_SIZE
+#define GNRC_MPL_MSG_QUEUE_SIZE (8U)
+#endif
+
+/**
+ * @brief   Message type for trickle events of buffered messages
+ *
+ * The bits of @ref GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK carry the generation of
+ * the buffer entry the trickle timer was started for, so that a trickle
+ * event of an evicted message is not taken for one of the message replacing
+ * it.
+ */
+#define GNRC_MPL_MSG_TYPE_TRICKLE_MSG       (0x0a00)
+
+/**
+ * @brief   Bits of @ref GNRC_MPL_MSG_TYPE_TRICKLE_MSG that carry the
+ *          generation of a buffer entry
+ */
+#define GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK  (0x00ff)
+
+/**
+ * @brief   Number of entries in the seed set
+ */
+#ifndef GNRC_MPL_SEED_SET_NUMOF
+#define GNRC_MPL_SEED_SET_NUMOF         (4U)
+#endif
+
+/**
+ * @brief   Number of entries in the buffered message set
+ *
+ * Every entry keeps a copy of the message in the packet buffer for as long as
+ * it is retransmitted. If the set is full, the message that was retransmitted
+ * the most is dropped to make room for a new one.
+ */
+#ifndef GNRC_MPL_BUFFERED_MSG_NUMOF
+#define GNRC_MPL_BUFFERED_MSG_NUMOF     (4U)
+#endif
+
+/**
+ * @brief   Lifetime of a seed set entry in seconds (`SEED_SET_ENTRY_LIFETIME`)
+ */
+#ifndef GNRC_MPL_SEED_SET_ENTRY_LIFETIME
+#define GNRC_MPL_SEED_SET_ENTRY_LIFETIME    (1800U)
+#endif
+
+/**
+ * @brief   Trickle Imin for data messages in ms (`DATA_MESSAGE_IMIN`)
+ */
+#ifndef GNRC_MPL_DATA_MESSAGE_IMIN
+#define GNRC_MPL_DATA_MESSAGE_IMIN      (64U)
+#endif
+
+/**
+ * @brief   Trickle Imax for data messages as doublings of
+ *          @ref GNRC_MPL_DATA_MESSAGE_IMIN (`DATA_MESSAGE_IMAX`)
+ */
+#ifndef GNRC_MPL_DATA_MESSAGE_IMAX
+#define GNRC_MPL_DATA_MESSAGE_IMAX      (1U)
+#endif
+
+/**
+ * @brief   Trickle redundancy constant for data messages (`DATA_MESSAGE_K`)
+ */
+#ifndef GNRC_MPL_DATA_MESSAGE_K
+#define GNRC_MPL_DATA_MESSAGE_K         (1U)
+#endif
+
+/**
+ * @brief   Number of trickle intervals a message is retransmitted in
+ *          (`DATA_MESSAGE_TIMER_EXPIRATIONS`)
+ */
+#ifndef GNRC_MPL_DATA_MESSAGE_TIMER_EXPIRATIONS
+#define GNRC_MPL_DATA_MESSAGE_TIMER_EXPIRATIONS (3U)
+#endif
+
+/**
+ * @brief   Hop limit of the outer header of seeded messages
+ */
+#ifndef GNRC_MPL_HOP_LIMIT
+#define GNRC_MPL_HOP_LIMIT              (64U)
+#endif
+
+/**
+ * @brief   ALL_MPL_FORWARDERS multicast address with realm-local scope
+ *          (ff03::fc)
+ */
+#define GNRC_MPL_ALL_FORWARDERS_ADDR    {{ 0xff, 0x03, 0x00, 0x00, \
+                                           0x00, 0x00, 0x00, 0x00, \
+                                           0x00, 0x00, 0x00, 0x00, \
+                                           0x00, 0x00, 0x00, 0xfc }}
+
+/**
+ * @brief   Hop-by-Hop option type of the MPL option
+ */
+#define GNRC_MPL_OPT_TYPE               (0x6d)
+
+/**
+ * @name    Flags of the MPL option
+ * @{
+ */
+#define GNRC_MPL_OPT_S_MASK             (0xc0)  /**< seed ID length */
+#define GNRC_MPL_OPT_S_POS              (6U)    /**< position of S field */
+#define GNRC_MPL_OPT_M                  (0x20)  /**< largest known sequence */
+#define GNRC_MPL_OPT_V                  (0x10)  /**< version, must be 0 */
+/** @} */
+
+/**
+ * @brief   MPL option with a seed ID derived from the source address (S = 0)
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc7731#section-6.1">
+ *          RFC 7731, section 6.1
+ *      </a>
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;       /**< option type (@ref GNRC_MPL_OPT_TYPE) */
+    uint8_t len;        /**< option length */
+    uint8_t flags;      /**< S, M and V flags */
+    uint8_t seq;        /**< sequence number */
+} gnrc_mpl_opt_t;
+
+/**
+ * @brief   MPL statistics
+ */
+typedef struct {
+    uint32_t seeded;        /**< messages originated by this node */
+    uint32_t rx;            /**< new messages received */
+    uint32_t rx_dup;        /**< duplicate or old messages dropped */
+    uint32_t tx;            /**< (re-)transmissions of buffered messages */
+    uint32_t evicted;       /**< buffered messages dropped to make room */
+} gnrc_mpl_stats_t;
+
+/**
+ * @brief   PID of the MPL thread
+ */
+extern kernel_pid_t gnrc_mpl_pid;
+
+/**
+ * @brief   MPL statistics
+ */
+extern gnrc_mpl_stats_t gnrc_mpl_stats;
+
+/**
+ * @brief   Initialization of the MPL thread and enabling of MPL forwarding on
+ *          an interface.
+ *
+ * Subscribes @p if_pid to @ref GNRC_MPL_ALL_FORWARDERS_ADDR, which takes one
+ * entry of its addresses (see @ref GNRC_IPV6_NETIF_ADDR_NUMOF).
+ *
+ * @param[in] if_pid    PID of the interface
+ *
+ * @return  PID of the MPL thread, on success.
+ * @return  KERNEL_PID_UNDEF, if initialization of the thread fails or
+ *          @p if_pid has no room for another address.
+ */
+kernel_pid_t gnrc_mpl_init(kernel_pid_t if_pid);
+
+/**
+ * @brief   Disseminates an IPv6 packet via MPL.
+ *
+ * Missing fields in the IPv6 header of @p pkt (source address, payload length,
+ * next header, hop limit) and the checksum of the upper layer are filled in
+ * before the packet is encapsulated, so the result of e.g.
+ * @ref gnrc_ipv6_hdr_build() can be handed in directly.
+ *
+ * @param[in] pkt   An IPv6 packet, optionally preceded by a
+ *                  @ref net_gnrc_netif_hdr "netif header" to select the
+ *                  interface. The packet is released in any case.
+ *
+ * @note    The packet is not delivered to this node itself.
+ *
+ * @return  0, on success.
+ * @return  -EINVAL, if @p pkt contains no IPv6 header.
+ * @return  -EADDRNOTAVAIL, if no source address could be selected.
+ * @return  -ENOMEM, if the packet buffer is full.
+ * @return  -ENOTCONN, if MPL was not initialized.
+ */
+int gnrc_mpl_send(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Processes the MPL option of a received Hop-by-Hop options header.
+ *
+ * Called by @ref net_gnrc_ipv6_ext. New messages are added to the buffered
+ * message set for retransmission.
+ *
+ * @param[in] iface The receiving interface.
+ * @param[in] pkt   The received packet. Its first snip must start with @p hbh
+ *                  and be preceded by the IPv6 header.
+ * @param[in] hbh   The Hop-by-Hop options header.
+ *
+ * @return  0, if the packet should be processed further.
+ * @return  -EALREADY, if the packet is an old or duplicate MPL message and must
+ *          be dropped.
+ * @return  -ENOTSUP, if the MPL option has a seed ID length other than 0 or the
+ *          V flag set. The packet must be dropped.
+ */
+int gnrc_mpl_process_hbh(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
+                         ipv6_ext_t *hbh);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_MPL_H */
+/** @} */
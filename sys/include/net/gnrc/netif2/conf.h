@@ -85,6 +85,17 @@ extern "C" {
 #define GNRC_NETIF2_IPV6_GROUPS_NUMOF   (2 + GNRC_NETIF2_RPL_ADDR + GNRC_NETIF2_IPV6_RTR_ADDR)
 #endif
 
+/**
+ * @brief   Number of cached source address selections per interface
+ *
+ * @ref gnrc_netif2_ipv6_addr_best_src() caches its result per
+ * destination prefix (which also determines the scope of the destination).
+ * Set to 0 to disable the cache.
+ */
+#ifndef GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+#define GNRC_NETIF2_IPV6_SRC_CACHE_SIZE (2U)
+#endif
+
 /**
  * @brief   Maximum length of the link-layer address.
  *
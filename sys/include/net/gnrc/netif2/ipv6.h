@@ -67,6 +67,17 @@ extern "C" {
 #define GNRC_NETIF2_IPV6_ADDRS_FLAGS_ANYCAST                (0x20U)
 /** @} */
 
+/**
+ * @brief   Entry of the source address selection cache
+ *
+ * @see     gnrc_netif2_ipv6_t::src_cache
+ */
+typedef struct {
+    network_uint64_t dst_pfx;   /**< upper 64 bits of the destination */
+    int8_t idx;                 /**< index of the selected address, -1 for none */
+    uint8_t flags;              /**< flags of the entry */
+} gnrc_netif2_ipv6_src_cache_t;
+
 /**
  * @brief   IPv6 component for @ref gnrc_netif2_t
  *
@@ -95,6 +106,24 @@ typedef struct {
      * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
      */
     ipv6_addr_t groups[GNRC_NETIF2_IPV6_GROUPS_NUMOF];
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE || DOXYGEN
+    /**
+     * @brief   Cache of source address selections
+     *
+     * Flushed whenever an address is added to or removed from the interface.
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6" and
+     *          if @ref GNRC_NETIF2_IPV6_SRC_CACHE_SIZE > 0.
+     */
+    gnrc_netif2_ipv6_src_cache_t src_cache[GNRC_NETIF2_IPV6_SRC_CACHE_SIZE];
+    /**
+     * @brief   Next entry of gnrc_netif2_ipv6_t::src_cache to replace
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6" and
+     *          if @ref GNRC_NETIF2_IPV6_SRC_CACHE_SIZE > 0.
+     */
+    uint8_t src_cache_next;
+#endif
 #ifdef MODULE_NETSTATS_IPV6
     /**
      * @brief IPv6 packet statistics
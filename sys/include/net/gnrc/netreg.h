@@ -79,6 +79,16 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of buckets the UDP entries are hashed into by port
+ *
+ * Entries of @ref GNRC_NETTYPE_UDP are kept in one list per bucket, so
+ * looking up a port only walks the entries of ports sharing its bucket.
+ */
+#ifndef GNRC_NETREG_UDP_BUCKETS
+#define GNRC_NETREG_UDP_BUCKETS     (16U)
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
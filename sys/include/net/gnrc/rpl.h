@@ -81,6 +81,12 @@
  *   CFLAGS += -DGNRC_RPL_WITHOUT_VALIDATION
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * - Adapt the redundancy constant of the trickle timer to the number of
+ *   neighbors (see @ref GNRC_RPL_DENSITY_NUMOF)
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ *   USEMODULE += gnrc_rpl_adaptive_redun
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * @{
  *
  * @file
@@ -193,12 +199,43 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
+#ifdef MODULE_GNRC_RPL_MRHOF
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (2)
+#else
 #define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#endif
 
 /**
  * @brief   Default Objective Code Point (OF0)
+ *
+ * Set to 1 to let a root build its DODAG with MRHOF (needs the
+ * `gnrc_rpl_mrhof` module). Other nodes use the objective function announced
+ * by the root.
  */
+#ifndef GNRC_RPL_DEFAULT_OCP
 #define GNRC_RPL_DEFAULT_OCP (0)
+#endif
+
+/**
+ * @brief   Maximum ETX of a link to a parent for MRHOF, in 1/128
+ *
+ * Parents over links with a higher ETX are not used.
+ *
+ * @see [RFC 6719, section 5](https://tools.ietf.org/html/rfc6719#section-5)
+ */
+#ifndef GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define GNRC_RPL_MRHOF_MAX_LINK_METRIC (512)
+#endif
+
+/**
+ * @brief   Difference in path cost (ETX in 1/128) a new parent must be better
+ *          than the preferred parent for MRHOF to switch to it
+ *
+ * @see [RFC 6719, section 5](https://tools.ietf.org/html/rfc6719#section-5)
+ */
+#ifndef GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD (192)
+#endif
 
 /**
  * @brief   Default Instance ID
@@ -280,6 +317,51 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
 #endif
 /** @} */
 
+/**
+ * @name    Adaptive redundancy constant
+ *
+ * With module `gnrc_rpl_adaptive_redun` the redundancy constant k of the
+ * trickle timer of a DODAG follows the number of neighbors DIOs were heard
+ * from in the last @ref GNRC_RPL_DENSITY_WINDOW intervals. About every
+ * @ref GNRC_RPL_DENSITY_PER_REDUN th neighbor sends a DIO per interval, but k
+ * is at least @ref GNRC_RPL_DENSITY_REDUN_MIN and at most the redundancy
+ * constant of the DODAG. A redundancy constant of 0 (infinity) is not
+ * adapted.
+ *
+ * Since suppressed neighbors do not send DIOs, the window must cover at least
+ * @ref GNRC_RPL_DENSITY_PER_REDUN intervals to hear all of them.
+ * @{
+ */
+/**
+ * @brief   Number of neighbors counted per DODAG
+ */
+#ifndef GNRC_RPL_DENSITY_NUMOF
+#define GNRC_RPL_DENSITY_NUMOF          (16U)
+#endif
+
+/**
+ * @brief   Number of trickle intervals a neighbor is counted after its last
+ *          DIO
+ */
+#ifndef GNRC_RPL_DENSITY_WINDOW
+#define GNRC_RPL_DENSITY_WINDOW         (8U)
+#endif
+
+/**
+ * @brief   Number of neighbors per DIO sent in an interval
+ */
+#ifndef GNRC_RPL_DENSITY_PER_REDUN
+#define GNRC_RPL_DENSITY_PER_REDUN      (4U)
+#endif
+
+/**
+ * @brief   Minimum redundancy constant
+ */
+#ifndef GNRC_RPL_DENSITY_REDUN_MIN
+#define GNRC_RPL_DENSITY_REDUN_MIN      (2U)
+#endif
+/** @} */
+
 /**
  * @name Default parent and route entry lifetime
  * default lifetime will be multiplied by the lifetime unit to obtain the resulting lifetime
@@ -337,6 +419,13 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
 #ifndef GNRC_RPL_DEFAULT_DAO_DELAY
 #define GNRC_RPL_DEFAULT_DAO_DELAY (1)
 #endif
+/**
+ * @brief   Time in seconds a router collects route changes of its children
+ *          before it sends them in one DAO
+ */
+#ifndef GNRC_RPL_DAO_AGGREGATION_WINDOW
+#define GNRC_RPL_DAO_AGGREGATION_WINDOW (4)
+#endif
 /** @} */
 
 /**
@@ -568,6 +657,17 @@ void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6
  */
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag);
 
+/**
+ * @brief   Schedule a DAO for route changes of children
+ *
+ * The DAO is sent after @ref GNRC_RPL_DAO_AGGREGATION_WINDOW, so changes of
+ * several children are sent in one DAO. If a DAO is scheduled already, it is
+ * not delayed any further.
+ *
+ * @param[in] dodag     The DODAG of the DAO
+ */
+void gnrc_rpl_aggregate_dao(gnrc_rpl_dodag_t *dodag);
+
 /**
  * @brief   Long delay the DAO sending interval
  *
@@ -575,6 +675,41 @@ void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag);
  */
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag);
 
+#if defined(MODULE_GNRC_RPL_ADAPTIVE_REDUN) || defined(DOXYGEN)
+/**
+ * @brief   Forgets all neighbors counted for a DODAG
+ *
+ * @param[in] dodag     The DODAG
+ */
+void gnrc_rpl_density_reset(gnrc_rpl_dodag_t *dodag);
+
+/**
+ * @brief   Counts the sender of a DIO of a DODAG as neighbor
+ *
+ * @param[in] dodag     The DODAG of the DIO
+ * @param[in] src       Source address of the DIO
+ */
+void gnrc_rpl_density_heard(gnrc_rpl_dodag_t *dodag, const ipv6_addr_t *src);
+
+/**
+ * @brief   Ends a trickle interval of a DODAG and adapts the redundancy
+ *          constant to the number of neighbors
+ *
+ * @param[in] dodag     The DODAG
+ */
+void gnrc_rpl_density_update(gnrc_rpl_dodag_t *dodag);
+
+/**
+ * @brief   Gets the number of neighbors of a DODAG
+ *
+ * @param[in] dodag     The DODAG
+ *
+ * @return  Number of neighbors DIOs were heard from in the last
+ *          @ref GNRC_RPL_DENSITY_WINDOW trickle intervals.
+ */
+unsigned gnrc_rpl_density_get(gnrc_rpl_dodag_t *dodag);
+#endif
+
 /**
  * @brief Create a new RPL instance and RPL DODAG.
  *
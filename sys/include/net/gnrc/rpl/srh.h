@@ -23,6 +23,9 @@
 #ifndef NET_GNRC_RPL_SRH_H
 #define NET_GNRC_RPL_SRH_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "net/ipv6/hdr.h"
 #include "net/ipv6/addr.h"
 
@@ -35,6 +38,49 @@ extern "C" {
  */
 #define GNRC_RPL_SRH_TYPE   (3U)
 
+/**
+ * @name    Source routes of a non-storing mode root
+ *
+ * With module `gnrc_rpl_srh_root` the root of a non-storing mode DODAG keeps
+ * the parent of every node, as announced in the transit information options
+ * of the DAOs, and inserts a compressed source routing header into packets
+ * it sends down the DODAG.
+ *
+ * Built headers are cached per destination. The cache is invalidated when a
+ * parent changes or a route is removed, so a packet to a recently used
+ * destination does not walk the parent chain again.
+ * @{
+ */
+/**
+ * @brief   Number of nodes the root keeps a parent for
+ */
+#ifndef GNRC_RPL_SRH_ROOT_NUMOF
+#define GNRC_RPL_SRH_ROOT_NUMOF         (16U)
+#endif
+
+/**
+ * @brief   Maximum number of hops of a source route
+ */
+#ifndef GNRC_RPL_SRH_ROOT_MAX_HOPS
+#define GNRC_RPL_SRH_ROOT_MAX_HOPS      (8U)
+#endif
+
+/**
+ * @brief   Number of destinations built source routing headers are cached
+ *          for
+ */
+#ifndef GNRC_RPL_SRH_ROOT_CACHE_SIZE
+#define GNRC_RPL_SRH_ROOT_CACHE_SIZE    (4U)
+#endif
+
+/**
+ * @brief   Maximum length of a source routing header built by the root
+ */
+#define GNRC_RPL_SRH_ROOT_HDR_MAX_LEN   (sizeof(gnrc_rpl_srh_t) + \
+                                         ((GNRC_RPL_SRH_ROOT_MAX_HOPS - 1) * \
+                                          sizeof(ipv6_addr_t)))
+/** @} */
+
 /**
  * @brief   The RPL Source routing header.
  *
@@ -66,6 +112,56 @@ typedef struct __attribute__((packed)) {
  */
 int gnrc_rpl_srh_process(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh);
 
+/**
+ * @brief   Resets the source routes of the root
+ *
+ * @param[in] root  Address of the root, i.e. the DODAG ID. Parent chains end
+ *                  at this address.
+ */
+void gnrc_rpl_srh_root_init(const ipv6_addr_t *root);
+
+/**
+ * @brief   Updates the parent of a node
+ *
+ * @param[in] target    Address of the node.
+ * @param[in] parent    Address of the parent of @p target.
+ * @param[in] lifetime  Lifetime of the route in seconds. 0 removes the route.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, if there is no space left for the route.
+ */
+int gnrc_rpl_srh_root_update(const ipv6_addr_t *target,
+                             const ipv6_addr_t *parent, uint32_t lifetime);
+
+/**
+ * @brief   Removes the route to a node
+ *
+ * @param[in] target    Address of the node.
+ */
+void gnrc_rpl_srh_root_remove(const ipv6_addr_t *target);
+
+/**
+ * @brief   Gets the source route to a node
+ *
+ * The header is ready to be inserted after the IPv6 header, only
+ * gnrc_rpl_srh_t::nh needs to be set.
+ *
+ * @param[in] dst           Destination of the packet.
+ * @param[out] first_hop    The first hop, i.e. the destination address of
+ *                          the IPv6 header.
+ * @param[out] srh          Buffer for the source routing header.
+ * @param[in] srh_len       Length of @p srh, at most
+ *                          @ref GNRC_RPL_SRH_ROOT_HDR_MAX_LEN is needed.
+ *
+ * @return  Length of the source routing header in @p srh.
+ * @return  0, if @p dst is a child of the root and needs no source routing
+ *          header.
+ * @return  -ENOENT, if there is no route to @p dst.
+ * @return  -ENOBUFS, if @p srh_len is too small.
+ */
+int gnrc_rpl_srh_root_get(const ipv6_addr_t *dst, ipv6_addr_t *first_hop,
+                          void *srh, size_t srh_len);
+
 #ifdef __cplusplus
 }
 #endif
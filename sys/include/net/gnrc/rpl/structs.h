@@ -221,6 +221,9 @@ struct gnrc_rpl_parent {
     gnrc_rpl_parent_t *next;        /**< pointer to the next parent */
     uint8_t state;                  /**< 0 for unsued, 1 for used */
     ipv6_addr_t addr;               /**< link-local IPv6 address of this parent */
+    ipv6_addr_t global_addr;        /**< global IPv6 address the parent advertised
+                                         in a Prefix Information option, used
+                                         as DAO parent in non-storing mode */
     uint8_t dtsn;                   /**< last seen dtsn of this parent */
     uint16_t rank;                  /**< rank of the parent */
     gnrc_rpl_dodag_t *dodag;        /**< DODAG the parent belongs to */
@@ -263,6 +266,25 @@ typedef struct {
     void (*process_dio)(void);  /**< DIO processing callback (acc. to OF0 spec, chpt 5) */
 } gnrc_rpl_of_t;
 
+/**
+ * @brief Control message and topology statistics of a DODAG
+ */
+typedef struct {
+    uint32_t dio_sent;              /**< DIOs sent */
+    uint32_t dio_received;          /**< DIOs received */
+    uint32_t dio_suppressed;        /**< DIOs suppressed by the trickle timer */
+    uint32_t dis_sent;              /**< DISs sent */
+    uint32_t dis_received;          /**< DISs received and responded to */
+    uint32_t dao_sent;              /**< DAOs sent */
+    uint32_t dao_received;          /**< DAOs received */
+    uint32_t dao_merged;            /**< DAO triggers merged into a scheduled DAO */
+    uint32_t dao_suppressed;        /**< received DAOs that changed no route */
+    uint32_t dao_ack_sent;          /**< DAO-ACKs sent */
+    uint32_t dao_ack_received;      /**< DAO-ACKs received */
+    uint32_t parent_switches;       /**< changes of the preferred parent */
+    uint32_t rank_changes;          /**< changes of the own rank */
+} gnrc_rpl_stats_t;
+
 /**
  * @cond INTERNAL
  */
@@ -290,6 +312,7 @@ struct gnrc_rpl_dodag {
                                          (see @ref GNRC_RPL_REQ_DIO_OPTS "DIO Options") */
     uint8_t dao_time;               /**< time to schedule a DAO in seconds */
     trickle_t trickle;              /**< trickle representation */
+    gnrc_rpl_stats_t stats;         /**< message and topology statistics */
 };
 
 struct gnrc_rpl_instance {
@@ -67,6 +67,9 @@ typedef struct {
     /**
      * @brief   Lifetime in minutes this context is valid.
      *
+     * Decremented every minute, when it reaches 0 the context is not used
+     * for compression anymore.
+     *
      * @see     <a href="http://tools.ietf.org/html/rfc6775#section-4.2">
      *              6LoWPAN Context Option
      *          </a>
@@ -77,6 +80,9 @@ typedef struct {
 /**
  * @brief   Gets a context matching the given IPv6 address best with its prefix.
  *
+ * Does not lock, the context buffer is scanned again if it was updated
+ * meanwhile.
+ *
  * @param[in] addr  An IPv6 address.
  *
  * @return  The context associated with the best prefix for @p addr.
@@ -113,17 +119,24 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
-#ifdef MODULE_GNRC_SIXLOWPAN_CTX
 /**
  * @brief   Removes context.
  *
+ * @note    May be called from interrupt context.
+ *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-}
-#endif
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the version of the context buffer
+ *
+ * The version changes whenever a context is updated, removed, or its lifetime
+ * expires, so results derived from the context buffer can be cached.
+ *
+ * @return  The current version of the context buffer.
+ */
+uint16_t gnrc_sixlowpan_ctx_version(void);
 
 #ifdef TEST_SUITES
 /**
@@ -32,6 +32,7 @@
 #include "kernel_types.h"
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
+#include "timex.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,111 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_MSG_FRAG_SND    (0x0225)
 
+/**
+ * @brief   Number of datagrams that can be reassembled concurrently
+ *
+ * Each entry keeps the datagram it reassembles in the packet buffer, the
+ * bookkeeping per entry is independent of the number of fragments received.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_RBUF_SIZE
+#define GNRC_SIXLOWPAN_FRAG_RBUF_SIZE       (4U)
+#endif
+
+/**
+ * @brief   Timeout for reassembly in microseconds
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT
+#define GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT    (3U * US_PER_SEC)
+#endif
+
+/**
+ * @brief   Number of datagrams a router can forward concurrently without
+ *          reassembling them
+ *
+ * Only used with module `gnrc_sixlowpan_frag_vrb`. Each entry maps the
+ * datagram tag of an incoming datagram to the outgoing datagram tag and next
+ * hop, so fragments are forwarded as soon as they arrive. Datagrams that do
+ * not fit are reassembled and forwarded by IPv6 as usual.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (4U)
+#endif
+
+/**
+ * @brief   Number of datagrams that can wait for fragmentation
+ *
+ * Datagrams are fragmented one after another. This includes the datagram that
+ * is currently fragmented, larger datagrams are dropped when the queue is full.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PACING
+#define GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE      (4U)
+#else
+#define GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE      (1U)
+#endif
+#endif
+
+/**
+ * @brief   Number of times a fragment the interface did not accept is handed
+ *          to it again before the datagram is dropped
+ *
+ * The n-th retry waits n times the gap between two fragments
+ * (@ref GNRC_SIXLOWPAN_FRAG_GAP or the adaptive gap), also without module
+ * `gnrc_sixlowpan_frag_pacing`, so the interface or the packet buffer can
+ * drain in the meantime.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_RETRIES
+#define GNRC_SIXLOWPAN_FRAG_RETRIES         (2U)
+#endif
+
+/**
+ * @brief   Gap between two fragments in microseconds
+ *
+ * Used with module `gnrc_sixlowpan_frag_pacing` and to delay retries (see
+ * @ref GNRC_SIXLOWPAN_FRAG_RETRIES). Fragments sent back-to-back collide on a multi-hop path with the next hop forwarding the
+ * preceding fragment, so the fragmentation waits this long after every
+ * fragment. With @ref GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE this is the minimum
+ * gap.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_GAP
+#define GNRC_SIXLOWPAN_FRAG_GAP             (5U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Derive the gap between two fragments from the time the interface
+ *          needs to send a fragment
+ *
+ * Only used with module `gnrc_sixlowpan_frag_pacing`. When set to 1, the time
+ * from handing a fragment to the interface until it accepts the next request
+ * is smoothed and multiplied by @ref GNRC_SIXLOWPAN_FRAG_PACING_FACTOR and
+ * the link-layer retries needed for the fragment (@ref
+ * NETOPT_TX_RETRIES_NEEDED) plus one. The result is bound by
+ * @ref GNRC_SIXLOWPAN_FRAG_GAP and @ref GNRC_SIXLOWPAN_FRAG_GAP_MAX.
+ *
+ * @note    Each measurement blocks the 6LoWPAN thread until the interface
+ *          processed the fragment.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE
+#define GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE (0)
+#endif
+
+/**
+ * @brief   Multiple of the interface's send time used as adaptive gap
+ *
+ * The default gives the next hop the time to forward the preceding fragment
+ * before the next one is sent.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_PACING_FACTOR
+#define GNRC_SIXLOWPAN_FRAG_PACING_FACTOR   (2U)
+#endif
+
+/**
+ * @brief   Maximum adaptive gap between two fragments in microseconds
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_GAP_MAX
+#define GNRC_SIXLOWPAN_FRAG_GAP_MAX         (50U * US_PER_MS)
+#endif
+
 /**
  * @brief   Definition of 6LoWPAN fragmentation type.
  */
@@ -51,6 +157,8 @@ typedef struct {
     size_t datagram_size;   /**< Length of just the IPv6 packet to be fragmented */
     uint16_t offset;        /**< Offset of the Nth fragment from the beginning of the
                              *   payload datagram */
+    uint16_t tag;           /**< Datagram tag, set when the first fragment is sent */
+    uint8_t retries;        /**< Attempts to send the current fragment again */
 } gnrc_sixlowpan_msg_frag_t;
 
 /**
@@ -61,6 +169,13 @@ typedef struct {
  */
 void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg);
 
+/**
+ * @brief   Generates a new datagram tag for an outgoing fragmented datagram.
+ *
+ * @return  A new datagram tag.
+ */
+uint16_t gnrc_sixlowpan_frag_next_tag(void);
+
 /**
  * @brief   Handles a packet containing a fragment header.
  *
@@ -68,6 +183,35 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg);
  */
 void gnrc_sixlowpan_frag_handle_pkt(gnrc_pktsnip_t *pkt);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || DOXYGEN
+/**
+ * @brief   Statistics on fragmentation and the reassembly buffer
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_stats`.
+ */
+typedef struct {
+    uint32_t rbuf_full;     /**< datagrams evicted since the buffer was full */
+    uint32_t expired;       /**< datagrams that timed out */
+    uint32_t discarded;     /**< datagrams discarded due to errors or overlaps */
+    uint32_t datagrams;     /**< datagrams reassembled completely */
+    uint32_t forwarded;     /**< fragments forwarded without reassembly */
+    uint32_t sfr_retries;   /**< rounds of recoverable fragments sent again */
+    uint32_t sfr_aborted;   /**< recoverable datagrams given up */
+    uint32_t frags_sent;    /**< fragments handed to the interface */
+    uint32_t frag_retries;  /**< fragments handed to the interface again */
+    uint32_t pacing_delay;  /**< total delay before fragments and retries in
+                             *   microseconds */
+} gnrc_sixlowpan_frag_stats_t;
+
+/**
+ * @brief   Get the current statistics on fragmentation and the reassembly
+ *          buffer
+ *
+ * @return  The current statistics.
+ */
+gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
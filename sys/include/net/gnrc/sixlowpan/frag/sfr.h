@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_sfr 6LoWPAN selective fragment recovery
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Recoverable fragments with per-fragment acknowledgments
+ * @see <a href="https://tools.ietf.org/html/rfc8931">RFC 8931</a>
+ *
+ * Datagrams to peers that are known to support selective fragment recovery
+ * are sent as recoverable fragments (RFRAG). The last fragment of each round
+ * requests an acknowledgment (RFRAG-ACK) whose bitmap tells the sender which
+ * fragments were received, so only the missing ones are sent again.
+ *
+ * A peer is known to support recoverable fragments if an RFRAG was received
+ * from it or if it was added with @ref gnrc_sixlowpan_frag_sfr_peer_add().
+ * All other peers still get fragments as specified in RFC 4944. Datagrams
+ * that need more than @ref SIXLOWPAN_SFR_ACK_BITMAP_SIZE fragments or that
+ * are sent while another datagram is in recovery also fall back to RFC 4944
+ * fragmentation.
+ *
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN selective fragment recovery definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/pkt.h"
+#include "timex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Message type to send the next recoverable fragment
+ */
+#define GNRC_SIXLOWPAN_MSG_SFR_SND          (0x0226)
+
+/**
+ * @brief   Message type for the acknowledgment timeout of a datagram
+ */
+#define GNRC_SIXLOWPAN_MSG_SFR_ACK_TIMEOUT  (0x0227)
+
+/**
+ * @brief   Time in microseconds to wait for an RFRAG-ACK
+ */
+#ifndef GNRC_SIXLOWPAN_SFR_ACK_TIMEOUT
+#define GNRC_SIXLOWPAN_SFR_ACK_TIMEOUT      (200U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Number of times missing fragments are sent again before the
+ *          datagram is given up (`MaxFragRetries`)
+ */
+#ifndef GNRC_SIXLOWPAN_SFR_RETRIES
+#define GNRC_SIXLOWPAN_SFR_RETRIES          (3U)
+#endif
+
+/**
+ * @brief   Number of peers that are remembered to support recoverable
+ *          fragments
+ */
+#ifndef GNRC_SIXLOWPAN_SFR_PEERS_NUMOF
+#define GNRC_SIXLOWPAN_SFR_PEERS_NUMOF      (4U)
+#endif
+
+/**
+ * @brief   Number of datagrams that can be received in recoverable fragments
+ *          concurrently
+ */
+#ifndef GNRC_SIXLOWPAN_SFR_RBUF_SIZE
+#define GNRC_SIXLOWPAN_SFR_RBUF_SIZE        (2U)
+#endif
+
+/**
+ * @brief   Marks a peer as supporting recoverable fragments.
+ *
+ * @param[in] l2addr        Link-layer address of the peer.
+ * @param[in] l2addr_len    Length of @p l2addr.
+ *
+ * @return  0, on success.
+ * @return  -EINVAL, if @p l2addr_len is too long.
+ */
+int gnrc_sixlowpan_frag_sfr_peer_add(const uint8_t *l2addr, size_t l2addr_len);
+
+/**
+ * @brief   Sends a datagram as recoverable fragments, if its destination
+ *          supports them.
+ *
+ * @param[in] pkt   A compressed datagram with a netif header in front.
+ *
+ * @return  true, if the datagram is sent as recoverable fragments. @p pkt is
+ *          released when it was acknowledged or given up.
+ * @return  false, if the datagram must be fragmented as specified in RFC 4944.
+ *          @p pkt is left untouched.
+ */
+bool gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Handles a @ref GNRC_SIXLOWPAN_MSG_SFR_SND message.
+ */
+void gnrc_sixlowpan_frag_sfr_send_next(void);
+
+/**
+ * @brief   Handles a @ref GNRC_SIXLOWPAN_MSG_SFR_ACK_TIMEOUT message.
+ */
+void gnrc_sixlowpan_frag_sfr_ack_timeout(void);
+
+/**
+ * @brief   Handles a received RFRAG or RFRAG-ACK.
+ *
+ * @param[in] pkt   The received packet. It is released.
+ */
+void gnrc_sixlowpan_frag_sfr_handle_pkt(gnrc_pktsnip_t *pkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_H */
+/** @} */
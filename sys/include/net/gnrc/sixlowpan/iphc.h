@@ -21,6 +21,7 @@
 #define NET_GNRC_SIXLOWPAN_IPHC_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
@@ -29,6 +30,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of flows whose compressed addresses are cached
+ *
+ * Only used with module `gnrc_sixlowpan_iphc_cache`. A flow is identified by
+ * its interface, link-layer addresses, and IPv6 source and destination
+ * address. Subsequent packets of a flow reuse the compressed addresses
+ * without looking up contexts again.
+ */
+#ifndef GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define GNRC_SIXLOWPAN_IPHC_CACHE_SIZE  (4U)
+#endif
+
 /**
  * @brief   Decompresses a received 6LoWPAN IPHC frame.
  *
@@ -61,6 +74,25 @@ size_t gnrc_sixlowpan_iphc_decode(gnrc_pktsnip_t **dec_hdr, gnrc_pktsnip_t *pkt,
  */
 bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) || DOXYGEN
+/**
+ * @brief   Statistics on the IPHC flow cache
+ *
+ * @note    Only available with module `gnrc_sixlowpan_iphc_cache`.
+ */
+typedef struct {
+    uint32_t hits;      /**< packets compressed with cached addresses */
+    uint32_t misses;    /**< packets whose addresses were compressed anew */
+} gnrc_sixlowpan_iphc_cache_stats_t;
+
+/**
+ * @brief   Get the current statistics on the IPHC flow cache
+ *
+ * @return  The current statistics.
+ */
+gnrc_sixlowpan_iphc_cache_stats_t *gnrc_sixlowpan_iphc_cache_stats_get(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
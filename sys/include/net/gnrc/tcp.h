@@ -11,6 +11,15 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * Besides the blocking API, connections can be handled without blocking: they are opened
+ * with gnrc_tcp_open_active_nb() or gnrc_tcp_open_passive_nb() and report their progress
+ * to the callback set with gnrc_tcp_set_event_cb() (@ref GNRC_TCP_EVENT_CONNECTED,
+ * @ref GNRC_TCP_EVENT_READABLE, @ref GNRC_TCP_EVENT_WRITABLE, @ref GNRC_TCP_EVENT_CLOSED).
+ * gnrc_tcp_send_nb(), gnrc_tcp_recv_nb() and gnrc_tcp_close_nb() never block, so a single
+ * thread can serve many connections. The callback is called from the TCP thread: it should
+ * only record the events and wake up the application thread. Blocking and non-blocking
+ * calls must not be mixed on a connection.
+ *
  * @{
  *
  * @file
@@ -74,7 +83,6 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
   *            -EAFNOSUPPORT if @p address_family is not supported.
   *            -EINVAL if @p address_family is not the same the address_family use by the TCB.
   *            -EISCONN if TCB is already in use.
-  *            -ENOMEM if the receive buffer for the TCB could not be allocated.
   *            -EADDRINUSE if @p local_port is already used by another connection.
   *            -ETIMEDOUT if the connection could not be opened.
   *            -ECONNREFUSED if the connection was resetted by the peer.
@@ -106,8 +114,6 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
  *            -EAFNOSUPPORT if local_addr != NULL and @p address_family is not supported.
  *            -EINVAL if @p address_family is not the same the address_family used in TCB.
  *            -EISCONN if TCB is already in use.
- *            -ENOMEM if the receive buffer for the TCB could not be allocated.
- *            Hint: Increase "GNRC_TCP_RCV_BUFFERS".
  */
 int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
                           const uint8_t *local_addr, const uint16_t local_port);
@@ -119,16 +125,20 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occured.
+ * @note Blocks until up to @p len bytes were queued for transmission or an error occured.
+ *       Queued data is sent as far as the peers window and the congestion window permit
+ *       and retransmitted until the peer acknowledged it. If the peer does not acknowledge
+ *       a segment within GNRC_TCP_CONNECTION_TIMEOUT_DURATION, the connection is closed.
+ *       gnrc_tcp_close() returns after all queued data was acknowledged.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
- * @param[in]     user_timeout_duration_us   If not zero and there was not data transmitted
+ * @param[in]     user_timeout_duration_us   If not zero and there was not data queued
  *                                           the function returns after user_timeout_duration_us.
  *                                           If zero, no timeout will be triggered.
  *
- * @returns   The number of successfully transmitted bytes.
+ * @returns   The number of bytes queued for transmission.
  *            -ENOTCONN if connection is not established.
  *            -ECONNRESET if connection was resetted by the peer.
  *            -ECONNABORTED if the connection was aborted.
@@ -187,6 +197,149 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
  */
 void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Set the options of a TCB.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @note gnrc_tcp_tcb_init() sets the options to @ref GNRC_TCP_DEFAULT_OPTS.
+ *       With @ref GNRC_TCP_OPT_DELAYED_ACK, received data is acknowledged with every second
+ *       segment, with data sent in the meantime or after @ref GNRC_TCP_DELAYED_ACK_TIMEOUT.
+ *       With @ref GNRC_TCP_OPT_NAGLE, writes of less than a segment are held back while
+ *       data is in flight and sent as one segment once it was acknowledged. Delaying ACKs
+ *       on one side and holding back data on the other side can stall request/response
+ *       protocols whose requests consist of several writes for the ACK delay.
+ *
+ * @param[in,out] tcb    TCB the options are set for.
+ * @param[in]     opts   Combination of GNRC_TCP_OPT_* values.
+ */
+void gnrc_tcp_set_opts(gnrc_tcp_tcb_t *tcb, uint8_t opts);
+
+/**
+ * @brief Set the event callback of a TCB.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @note The callback is called from the TCP thread for connections opened with
+ *       gnrc_tcp_open_active_nb() or gnrc_tcp_open_passive_nb(). It may call the
+ *       non-blocking functions on @p tcb but must not block.
+ *
+ * @param[in,out] tcb   TCB the callback is set for.
+ * @param[in]     cb    Event callback, NULL to disable it.
+ * @param[in]     arg   Argument passed to @p cb.
+ */
+void gnrc_tcp_set_event_cb(gnrc_tcp_tcb_t *tcb, gnrc_tcp_event_cb_t cb, void *arg);
+
+/**
+ * @brief Opens a connection actively without blocking.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL
+ * @pre @p target_addr must not be NULL.
+ * @pre @p target_port must not be 0.
+ *
+ * @note @ref GNRC_TCP_EVENT_CONNECTED is reported once the connection is established,
+ *       @ref GNRC_TCP_EVENT_CLOSED if it was refused or timed out.
+ *
+ * @param[in,out] tcb              TCB holding the connection information.
+ * @param[in]     address_family   Address family of @p target_addr.
+ * @param[in]     target_addr      Pointer to target address.
+ * @param[in]     target_port      Target port number.
+ * @param[in]     local_port       If zero or PORT_UNSPEC, the connections source port
+ *                                 is randomly chosen. If local_port is non-zero
+ *                                 the local_port is used as source port.
+ *
+ * @returns   Zero if the connection is being opened.
+ *            -EAFNOSUPPORT if @p address_family is not supported.
+ *            -EINVAL if @p address_family is not the same the address_family use by the TCB.
+ *            -EISCONN if TCB is already in use.
+ *            -EADDRINUSE if @p local_port is already used.
+ */
+int gnrc_tcp_open_active_nb(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                            const uint8_t *target_addr, const uint16_t target_port,
+                            const uint16_t local_port);
+
+/**
+ * @brief Opens a connection passively without blocking.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL
+ * @pre @p local_port must not be 0.
+ *
+ * @note @ref GNRC_TCP_EVENT_CONNECTED is reported once a peer connected. Several TCBs may
+ *       listen on the same port, each accepts one connection.
+ *
+ * @param[in,out] tcb              TCB holding the connection information.
+ * @param[in]     address_family   Address family of @p local_addr.
+ *                                 If local_addr == NULL, address_family is ignored.
+ * @param[in]     local_addr       If not NULL the connection is bound to @p local_addr.
+ *                                 If NULL a connection request to all local ip
+ *                                 addresses is valied.
+ * @param[in]     local_port       Port number to listen on.
+ *
+ * @returns   Zero if the TCB listens for a connection.
+ *            -EAFNOSUPPORT if local_addr != NULL and @p address_family is not supported.
+ *            -EINVAL if @p address_family is not the same the address_family used in TCB.
+ *            -EISCONN if TCB is already in use.
+ */
+int gnrc_tcp_open_passive_nb(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                             const uint8_t *local_addr, const uint16_t local_port);
+
+/**
+ * @brief Transmit data to connected peer without blocking.
+ *
+ * @pre Connection was opened with gnrc_tcp_open_active_nb() or gnrc_tcp_open_passive_nb().
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @note If less than @p len bytes were queued, @ref GNRC_TCP_EVENT_WRITABLE is reported
+ *       once more data can be queued.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     data   Pointer to the data that should be transmitted.
+ * @param[in]     len    Number of bytes that should be transmitted.
+ *
+ * @returns   The number of bytes queued for transmission.
+ *            -EAGAIN if no data could be queued.
+ *            -ENOTCONN if connection is not established.
+ *            -ECONNRESET if connection was closed, resetted or aborted.
+ */
+ssize_t gnrc_tcp_send_nb(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len);
+
+/**
+ * @brief Receive data from the peer without blocking.
+ *
+ * @pre Connection was opened with gnrc_tcp_open_active_nb() or gnrc_tcp_open_passive_nb().
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[out]    data      Pointer to the buffer where the received data should be copied into.
+ * @param[in]     max_len   Maximum amount to bytes that should be read into @p data.
+ *
+ * @returns   The number of bytes read into @p data.
+ *            Zero if the peer closed its side of the connection and all data was read.
+ *            -EAGAIN if no data is available.
+ *            -ENOTCONN if connection is not established.
+ */
+ssize_t gnrc_tcp_recv_nb(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len);
+
+/**
+ * @brief Close a TCP connection without blocking.
+ *
+ * @pre Connection was opened with gnrc_tcp_open_active_nb() or gnrc_tcp_open_passive_nb().
+ * @pre @p tcb must not be NULL.
+ *
+ * @note Queued data is still transmitted. @ref GNRC_TCP_EVENT_CLOSED is reported once the
+ *       connection is closed and the TCB can be reused. Use gnrc_tcp_abort() to close a
+ *       connection that is still being opened.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void gnrc_tcp_close_nb(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculate and set checksum in TCP header.
  *
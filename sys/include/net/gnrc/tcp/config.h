@@ -29,7 +29,8 @@ extern "C" {
 #endif
 
 /**
- * @brief Timeout duration for user calls. Default is 2 minutes.
+ * @brief Timeout duration for user calls and for the acknowledgment of data in flight.
+ *        Default is 2 minutes.
  */
 #ifndef GNRC_TCP_CONNECTION_TIMEOUT_DURATION
 #define GNRC_TCP_CONNECTION_TIMEOUT_DURATION (120U * US_PER_SEC)
@@ -54,7 +55,7 @@ extern "C" {
 #endif
 
 /**
- * @brief MSS Multiplicator = Number of MSS sized packets stored in receive buffer
+ * @brief MSS Multiplicator = Number of MSS sized segments that fit into the receive window
  */
 #ifndef GNRC_TCP_MSS_MULTIPLICATOR
 #define GNRC_TCP_MSS_MULTIPLICATOR (1U)
@@ -68,17 +69,48 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers
+ * @brief Number of received payload bytes all connections together may hold
+ *
+ * Received segments are kept in the packet buffer until the user read them, so no receive
+ * buffer is allocated per connection. Each connection advertises a window of at most
+ * @ref GNRC_TCP_DEFAULT_WINDOW, limited to the part of this budget that is not held by
+ * any connection. The packet buffer holds the headers of each segment in addition to
+ * its payload, so it must be large enough for this budget and all other traffic.
+ */
+#ifndef GNRC_TCP_RCV_BUDGET
+#define GNRC_TCP_RCV_BUDGET (2U * GNRC_TCP_DEFAULT_WINDOW)
+#endif
+
+/**
+ * @brief Number of data segments that can be in flight at the same time
+ *
+ * Every segment in flight is held in the packet buffer until it is acknowledged, so
+ * this together with @ref GNRC_TCP_MSS bounds the packet buffer used per connection.
+ * The number of bytes in flight is further limited by the peers window and the
+ * congestion window.
+ */
+#ifndef GNRC_TCP_RTX_QUEUE_SIZE
+#define GNRC_TCP_RTX_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681)
  */
-#ifndef GNRC_TCP_RCV_BUFFERS
-#define GNRC_TCP_RCV_BUFFERS (1U)
+#ifndef GNRC_TCP_DUP_ACK_THRESHOLD
+#define GNRC_TCP_DUP_ACK_THRESHOLD (3U)
 #endif
 
 /**
- * @brief Default receive buffer size
+ * @brief Number of received segments that are kept per connection
+ *
+ * Segments are held in the packet buffer until the user read their payload. Segments
+ * received out of order are kept until the missing data arrived and are reported to the
+ * peer with selective acknowledgments (see RFC 2018), so it resends only the segments that
+ * were lost. The window is closed while all entries hold data that was not read yet.
+ * Must be at least 2.
  */
-#ifndef GNRC_TCP_RCV_BUF_SIZE
-#define GNRC_TCP_RCV_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
+#ifndef GNRC_TCP_RCV_QUEUE_SIZE
+#define GNRC_TCP_RCV_QUEUE_SIZE (GNRC_TCP_MSS_MULTIPLICATOR + 4U)
 #endif
 
 /**
@@ -137,6 +169,25 @@ extern "C" {
 #define GNRC_TCP_PROBE_UPPER_BOUND (60U * US_PER_SEC)
 #endif
 
+/**
+ * @brief Maximum duration an ACK is delayed, must be less than 500ms (RFC 1122, 4.2.3.2)
+ */
+#ifndef GNRC_TCP_DELAYED_ACK_TIMEOUT
+#define GNRC_TCP_DELAYED_ACK_TIMEOUT (200U * US_PER_MS)
+#endif
+
+/**
+ * @brief Options a TCB is initialized with, a combination of GNRC_TCP_OPT_* values
+ *
+ * No option is set by default, every received data segment is acknowledged right away.
+ * Delayed ACKs save about every second ACK of a transfer, but hold back the ACK of a
+ * single segment for up to @ref GNRC_TCP_DELAYED_ACK_TIMEOUT, which stalls peers that
+ * wait for it, e.g. peers using the Nagle algorithm.
+ */
+#ifndef GNRC_TCP_DEFAULT_OPTS
+#define GNRC_TCP_DEFAULT_OPTS (0U)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,7 +24,6 @@
 
 #include <stdint.h>
 #include "kernel_types.h"
-#include "ringbuffer.h"
 #include "xtimer.h"
 #include "mutex.h"
 #include "msg.h"
@@ -45,6 +44,58 @@ extern "C" {
  */
 #define GNRC_TCP_TCB_MBOX_SIZE (8U)
 
+/**
+ * @brief Events passed to the event callback of a TCB.
+ * @{
+ */
+#define GNRC_TCP_EVENT_CONNECTED (0x01)  /**< Connection was established */
+#define GNRC_TCP_EVENT_READABLE  (0x02)  /**< Data or the peers FIN can be received */
+#define GNRC_TCP_EVENT_WRITABLE  (0x04)  /**< Data can be queued for transmission again */
+#define GNRC_TCP_EVENT_CLOSED    (0x08)  /**< Connection was closed, reset or aborted */
+/** @} */
+
+/**
+ * @brief Options of a TCB, see gnrc_tcp_set_opts().
+ * @{
+ */
+#define GNRC_TCP_OPT_DELAYED_ACK (0x01)  /**< Delay ACKs to piggyback them on data (RFC 1122) */
+#define GNRC_TCP_OPT_NAGLE       (0x02)  /**< Coalesce small writes while data is in flight
+                                          *   (RFC 896) */
+/** @} */
+
+struct _transmission_control_block;
+
+/**
+ * @brief Event callback of a TCB.
+ *
+ * @param[in] tcb      TCB the events occured on.
+ * @param[in] events   Events that occured, a combination of GNRC_TCP_EVENT_*.
+ * @param[in] arg      Argument passed to gnrc_tcp_set_event_cb().
+ */
+typedef void (*gnrc_tcp_event_cb_t)(struct _transmission_control_block *tcb, uint8_t events,
+                                    void *arg);
+
+/**
+ * @brief Segment in the retransmission queue of a TCB.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;     /**< Sent segment, NULL if the entry is unused */
+    uint32_t seq;            /**< Sequence number of the segment */
+    uint32_t send_time;      /**< Time of the first transmission in microseconds */
+    uint16_t seq_con;        /**< Sequence number consumption of the segment */
+    uint8_t retransmitted;   /**< Flag: segment has been retransmitted */
+    uint8_t sacked;          /**< Flag: segment has been selectively acknowledged */
+} gnrc_tcp_rtx_t;
+
+/**
+ * @brief Segment in the receive queue of a TCB.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;     /**< Received segment, NULL if the entry is unused */
+    uint32_t seq;            /**< Sequence number of the segment */
+    uint16_t len;            /**< Payload length of the segment */
+} gnrc_tcp_rcv_seg_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -57,29 +108,50 @@ typedef struct _transmission_control_block {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
+    uint8_t opts;          /**< Options of the connection, see GNRC_TCP_OPT_* */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
     uint16_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
+    uint32_t rcv_user;     /**< Sequence number of the next byte passed to the user */
     uint16_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Highest sequence number sent before the last loss */
+    uint32_t high_rxt;     /**< Sequence number following the last retransmitted segment */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received in a row */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    xtimer_t tim_conn;     /**< Connection timer of non-blocking connections */
+    msg_t msg_conn;        /**< Message, sent on connection timeouts */
+    uint32_t conn_last;    /**< Time of the last activity of non-blocking connections */
+    xtimer_t tim_ack;      /**< Timer struct for delayed ACKs */
+    msg_t msg_ack;         /**< Message, sent when a delayed ACK is due */
+    gnrc_pktsnip_t *snd_pend;  /**< Data held back by the Nagle algorithm, NULL if none */
+    uint16_t snd_pend_len;     /**< Number of bytes held back in snd_pend */
+    uint32_t probe_tout;   /**< Current zero window probe interval of non-blocking connections */
+    gnrc_tcp_event_cb_t event_cb;  /**< Event callback of non-blocking connections */
+    void *event_arg;       /**< Argument of the event callback */
+    uint8_t events;        /**< Events not yet passed to the event callback */
+    gnrc_tcp_rtx_t rtx[GNRC_TCP_RTX_QUEUE_SIZE + 1];  /**< Retransmission queue, one entry
+                                                        *   is reserved for a FIN */
+    uint8_t rtx_head;      /**< Oldest entry in the retransmission queue */
+    uint8_t rtx_num;       /**< Number of entries in the retransmission queue */
+    gnrc_tcp_rcv_seg_t rcv_queue[GNRC_TCP_RCV_QUEUE_SIZE];  /**< Received segments that
+                                                              *   were not read yet */
+    uint32_t ooo_last;     /**< Sequence number of the last segment received out of order */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
-    uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
-    ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct _transmission_control_block *next;   /**< Pointer next TCB */
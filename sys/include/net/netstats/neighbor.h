@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_netstats_neighbor Per neighbor link statistics
+ * @ingroup     net_netstats
+ * @brief       Transmission statistics and ETX estimation per neighbor
+ *
+ * The link layer records the destination of every unicast frame with
+ * @ref netstats_nb_record() and reports the outcome of the transmission as
+ * reported by the device (@ref NETDEV_EVENT_TX_COMPLETE,
+ * @ref NETDEV_EVENT_TX_NOACK, @ref NETDEV_EVENT_TX_MEDIUM_BUSY) with
+ * @ref netstats_nb_update_tx(). From this, an expected transmission count
+ * (ETX) is estimated per neighbor as an exponentially weighted moving
+ * average of the number of transmissions a frame needed.
+ *
+ * Neighbors are identified by the interface and the interface identifier
+ * (IID) derived from their link layer address, so routing protocols can look
+ * them up by their link-local IPv6 address.
+ *
+ * Devices that do not report the outcome of a transmission leave the ETX of
+ * their neighbors at @ref NETSTATS_NB_ETX_INIT.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Per neighbor link statistics definitions
+ */
+#ifndef NET_NETSTATS_NEIGHBOR_H
+#define NET_NETSTATS_NEIGHBOR_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/eui64.h"
+#include "net/netdev.h"
+#ifdef MODULE_GNRC_NETIF_HDR
+#include "net/gnrc/pkt.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of neighbors statistics are kept for
+ *
+ * If the table is full, the neighbor that was not updated for the longest time
+ * is replaced.
+ */
+#ifndef NETSTATS_NB_SIZE
+#define NETSTATS_NB_SIZE            (8U)
+#endif
+
+/**
+ * @brief   Fixed point divisor of the ETX values (i.e. an ETX of 1 is 128)
+ *
+ * @see [RFC 6551, section 4.3.2](https://tools.ietf.org/html/rfc6551#section-4.3.2)
+ */
+#define NETSTATS_NB_ETX_DIVISOR     (128U)
+
+/**
+ * @brief   ETX assumed for a neighbor without any transmission outcome
+ */
+#ifndef NETSTATS_NB_ETX_INIT
+#define NETSTATS_NB_ETX_INIT        (2U * NETSTATS_NB_ETX_DIVISOR)
+#endif
+
+/**
+ * @brief   Number of transmissions a failed transmission (no ACK or busy
+ *          medium) is accounted with
+ */
+#ifndef NETSTATS_NB_ETX_NOACK_PENALTY
+#define NETSTATS_NB_ETX_NOACK_PENALTY   (8U)
+#endif
+
+/**
+ * @brief   Weight of a new sample in the moving average, in 1/8
+ *
+ * The first samples of a neighbor are weighted higher, so the estimation
+ * converges fast.
+ */
+#ifndef NETSTATS_NB_ETX_ALPHA
+#define NETSTATS_NB_ETX_ALPHA       (1U)
+#endif
+
+/**
+ * @brief   Number of samples after which the ETX is considered fresh
+ */
+#ifndef NETSTATS_NB_FRESH_SAMPLES
+#define NETSTATS_NB_FRESH_SAMPLES   (4U)
+#endif
+
+/**
+ * @brief   Outcome of a transmission
+ */
+typedef enum {
+    NETSTATS_NB_SUCCESS = 0,    /**< frame was acknowledged */
+    NETSTATS_NB_NOACK,          /**< frame was not acknowledged */
+    NETSTATS_NB_BUSY,           /**< medium was busy, frame was not sent */
+} netstats_nb_result_t;
+
+/**
+ * @brief   Statistics of a neighbor
+ */
+typedef struct {
+    eui64_t iid;            /**< IID of the neighbor */
+    kernel_pid_t iface;     /**< interface of the neighbor,
+                             *   KERNEL_PID_UNDEF if unused */
+    uint8_t pending;        /**< a frame to the neighbor awaits its outcome */
+    uint8_t samples;        /**< number of samples, up to
+                             *   @ref NETSTATS_NB_FRESH_SAMPLES */
+    uint16_t etx;           /**< ETX in 1/@ref NETSTATS_NB_ETX_DIVISOR */
+    uint32_t tx_count;      /**< transmissions, including retransmissions */
+    uint32_t tx_success;    /**< frames acknowledged */
+    uint32_t tx_failed;     /**< frames not acknowledged or not sent */
+    uint32_t last_updated;  /**< time of the last update in seconds */
+} netstats_nb_t;
+
+/**
+ * @brief   Initializes the neighbor statistics
+ */
+void netstats_nb_init(void);
+
+/**
+ * @brief   Records that a unicast frame is sent to a neighbor
+ *
+ * @param[in] iface     Interface the frame is sent over.
+ * @param[in] l2_addr   Link layer address of the neighbor.
+ * @param[in] l2_addr_len   Length of @p l2_addr (2, 4, 6, or 8 byte).
+ */
+void netstats_nb_record(kernel_pid_t iface, const uint8_t *l2_addr,
+                        uint8_t l2_addr_len);
+
+/**
+ * @brief   Updates the statistics of the neighbor the last frame on @p iface
+ *          was recorded for
+ *
+ * @param[in] iface         Interface the frame was sent over.
+ * @param[in] result        Outcome of the transmission.
+ * @param[in] transmissions Number of transmissions of the frame, including
+ *                          retransmissions by the MAC layer. 0 if unknown.
+ */
+void netstats_nb_update_tx(kernel_pid_t iface, netstats_nb_result_t result,
+                           uint8_t transmissions);
+
+/**
+ * @brief   Updates the statistics of the neighbor the last frame on @p iface
+ *          was recorded for with the transmissions reported by @p dev
+ *
+ * For a transmission the device reports as acknowledged, the number of
+ * retransmissions is read with @ref NETOPT_TX_RETRIES_NEEDED, otherwise with
+ * @ref NETOPT_RETRANS. Devices that know neither option sent the frame once.
+ *
+ * @param[in] dev       Device that sent the frame.
+ * @param[in] iface     Interface the frame was sent over.
+ * @param[in] result    Outcome of the transmission as reported by @p dev.
+ */
+void netstats_nb_update_tx_dev(netdev_t *dev, kernel_pid_t iface,
+                               netstats_nb_result_t result);
+
+#if defined(MODULE_GNRC_NETIF_HDR) || defined(DOXYGEN)
+/**
+ * @brief   Records that a GNRC packet is sent to a neighbor
+ *
+ * Only unicast frames are recorded, as only they are acknowledged.
+ *
+ * @param[in] iface     Interface the packet is sent over.
+ * @param[in] pkt       Packet to send, starting with its
+ *                      @ref net_gnrc_netif_hdr.
+ */
+void netstats_nb_record_pkt(kernel_pid_t iface, gnrc_pktsnip_t *pkt);
+#endif
+
+/**
+ * @brief   Gets the statistics of a neighbor
+ *
+ * @param[in] iface     Interface of the neighbor.
+ * @param[in] iid       IID of the neighbor, e.g. of its link-local address.
+ *
+ * @return  The statistics of the neighbor.
+ * @return  NULL, if there are no statistics for the neighbor.
+ */
+netstats_nb_t *netstats_nb_get(kernel_pid_t iface, const eui64_t *iid);
+
+/**
+ * @brief   Gets the ETX of a neighbor
+ *
+ * @param[in] iface     Interface of the neighbor.
+ * @param[in] iid       IID of the neighbor, e.g. of its link-local address.
+ *
+ * @return  ETX of the neighbor in 1/@ref NETSTATS_NB_ETX_DIVISOR.
+ * @return  @ref NETSTATS_NB_ETX_INIT, if there are no statistics for the
+ *          neighbor.
+ */
+uint16_t netstats_nb_etx(kernel_pid_t iface, const eui64_t *iid);
+
+/**
+ * @brief   Iterates over all neighbors with statistics
+ *
+ * @param[in] prev  Previous neighbor, NULL to get the first one.
+ *
+ * @return  Next neighbor with statistics.
+ * @return  NULL, if there is none.
+ */
+netstats_nb_t *netstats_nb_iter(const netstats_nb_t *prev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_NETSTATS_NEIGHBOR_H */
+/** @} */
@@ -141,6 +141,81 @@ static inline bool sixlowpan_frag_is(sixlowpan_frag_t *hdr)
 }
 /** @} */
 
+/**
+ * @name    6LoWPAN selective fragment recovery definitions
+ * @see     <a href="https://tools.ietf.org/html/rfc8931#section-5">
+ *              RFC 8931, section 5
+ *          </a>
+ * @{
+ */
+#define SIXLOWPAN_SFR_DISP_MASK     (0xfe)      /**< mask for SFR dispatches */
+#define SIXLOWPAN_SFR_RFRAG_DISP    (0xe8)      /**< dispatch for RFRAG */
+#define SIXLOWPAN_SFR_ACK_DISP      (0xea)      /**< dispatch for RFRAG-ACK */
+#define SIXLOWPAN_SFR_ECN           (0x01)      /**< explicit congestion
+                                                 *   notification flag */
+#define SIXLOWPAN_SFR_ACK_REQ       (0x8000U)   /**< acknowledgment request
+                                                 *   flag */
+#define SIXLOWPAN_SFR_SEQ_MASK      (0x7c00U)   /**< mask for sequence number */
+#define SIXLOWPAN_SFR_SEQ_POS       (10U)       /**< position of sequence
+                                                 *   number */
+#define SIXLOWPAN_SFR_SEQ_MAX       (0x1fU)     /**< maximum sequence number */
+#define SIXLOWPAN_SFR_FRAG_SIZE_MASK (0x03ffU)  /**< mask for fragment size */
+#define SIXLOWPAN_SFR_ACK_BITMAP_SIZE (32U)     /**< bits in an RFRAG-ACK
+                                                 *   bitmap */
+
+/**
+ * @brief   Recoverable fragment (RFRAG) header
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t disp_ecn;           /**< dispatch and ECN flag */
+    uint8_t tag;                /**< datagram tag */
+    /**
+     * @brief   Acknowledgment request flag, sequence number and fragment size
+     */
+    network_uint16_t ar_seq_fs;
+    /**
+     * @brief   Datagram size (sequence number 0) or fragment offset in the
+     *          compressed datagram
+     */
+    network_uint16_t offset;
+} sixlowpan_sfr_rfrag_t;
+
+/**
+ * @brief   RFRAG acknowledgment (RFRAG-ACK) header
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t disp_ecn;           /**< dispatch and ECN flag */
+    uint8_t tag;                /**< datagram tag */
+    network_uint32_t bitmap;    /**< received fragments, MSB is sequence 0 */
+} sixlowpan_sfr_ack_t;
+
+/**
+ * @brief   Checks if a given header is an RFRAG header.
+ *
+ * @param[in] disp  The first byte of a frame.
+ *
+ * @return  true, if @p disp is the dispatch of an RFRAG.
+ * @return  false, if not.
+ */
+static inline bool sixlowpan_sfr_rfrag_is(const uint8_t *disp)
+{
+    return ((disp[0] & SIXLOWPAN_SFR_DISP_MASK) == SIXLOWPAN_SFR_RFRAG_DISP);
+}
+
+/**
+ * @brief   Checks if a given header is an RFRAG-ACK header.
+ *
+ * @param[in] disp  The first byte of a frame.
+ *
+ * @return  true, if @p disp is the dispatch of an RFRAG-ACK.
+ * @return  false, if not.
+ */
+static inline bool sixlowpan_sfr_ack_is(const uint8_t *disp)
+{
+    return ((disp[0] & SIXLOWPAN_SFR_DISP_MASK) == SIXLOWPAN_SFR_ACK_DISP);
+}
+/** @} */
+
 /**
  * @name    6LoWPAN IPHC dispatch definitions
  * @{
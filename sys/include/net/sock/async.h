@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async  Asynchronous sock API
+ * @ingroup     net_sock
+ * @brief       Callbacks on sock events
+ *
+ * With this API a sock notifies the application about received and sent
+ * messages instead of having a thread blocked in the receive function of the
+ * sock. The callback is called in the context of the network stack, e.g. the
+ * thread of the transport layer, and should only notify the thread handling
+ * the sock, e.g. with @ref msg_try_send(). That thread then receives the
+ * message with a timeout of 0.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+ * {
+ *     if (flags & SOCK_ASYNC_MSG_RECV) {
+ *         msg_t msg = { .type = MSG_TYPE_RECV };
+ *
+ *         msg_try_send(&msg, (kernel_pid_t)(intptr_t)arg);
+ *     }
+ * }
+ *
+ * ...
+ *     sock_udp_create(&sock, &local, NULL, 0);
+ *     sock_udp_set_cb(&sock, _cb, (void *)(intptr_t)thread_getpid());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The implementation for @ref net_gnrc "GNRC" is called `gnrc_sock_async`
+ * and uses @ref net_gnrc_netapi_callbacks.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous sock API definitions
+ */
+#ifndef NET_SOCK_ASYNC_H
+#define NET_SOCK_ASYNC_H
+
+#include "net/sock/async/types.h"
+#include "net/sock/ip.h"
+#include "net/sock/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sets the event callback of a raw IPv4/IPv6 sock
+ *
+ * @pre `(sock != NULL)` and @p sock was created with @ref sock_ip_create()
+ *
+ * @param[in] sock  A raw IPv4/IPv6 sock object.
+ * @param[in] cb    The callback. NULL to remove the callback.
+ * @param[in] arg   Argument for @p cb.
+ */
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *arg);
+
+/**
+ * @brief   Sets the event callback of a UDP sock
+ *
+ * @pre `(sock != NULL)` and @p sock was created with @ref sock_udp_create()
+ *
+ * @param[in] sock  A UDP sock object.
+ * @param[in] cb    The callback. NULL to remove the callback.
+ * @param[in] arg   Argument for @p cb.
+ */
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_H */
+/** @} */
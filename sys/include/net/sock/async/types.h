@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_async
+ * @{
+ *
+ * @file
+ * @brief       Types of the asynchronous sock API
+ *
+ * Kept apart from net/sock/async.h, so the sock types of an
+ * implementation can contain the callbacks.
+ */
+#ifndef NET_SOCK_ASYNC_TYPES_H
+#define NET_SOCK_ASYNC_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct sock_ip;
+struct sock_udp;
+
+/**
+ * @brief   Events of a sock
+ */
+typedef enum {
+    SOCK_ASYNC_MSG_RECV = 0x01,     /**< a message was received */
+    SOCK_ASYNC_MSG_SENT = 0x02,     /**< a message was handed to the network
+                                     *   stack */
+} sock_async_flags_t;
+
+/**
+ * @brief   Callback for events of a raw IPv4/IPv6 sock
+ *
+ * @param[in] sock  The sock the events happened on.
+ * @param[in] flags The events.
+ * @param[in] arg   Argument given to @ref sock_ip_set_cb().
+ */
+typedef void (*sock_ip_cb_t)(struct sock_ip *sock, sock_async_flags_t flags,
+                             void *arg);
+
+/**
+ * @brief   Callback for events of a UDP sock
+ *
+ * @param[in] sock  The sock the events happened on.
+ * @param[in] flags The events.
+ * @param[in] arg   Argument given to @ref sock_udp_set_cb().
+ */
+typedef void (*sock_udp_cb_t)(struct sock_udp *sock, sock_async_flags_t flags,
+                              void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_TYPES_H */
+/** @} */
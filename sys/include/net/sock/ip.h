@@ -440,6 +440,8 @@ ssize_t sock_ip_recv(sock_ip_t *sock, void *data, size_t max_len,
  *          valid interface or contradicts the local interface of @p sock.
  * @return  -EHOSTUNREACH, if @p remote or remote end point of @p sock is not
  *          reachable.
+ * @return  -EMSGSIZE, if @p data does not fit into the known path MTU towards
+ *          @p remote or remote end point of @p sock.
  * @return  -ENOMEM, if no memory was available to send @p data.
  * @return  -ENOTCONN, if `remote == NULL`, but @p sock has no remote end point.
  * @return  -EPROTOTYPE, if `sock == NULL` and @p proto is not by
@@ -289,6 +289,20 @@ typedef struct _sock_tl_ep sock_udp_ep_t;   /**< An end point for a UDP sock obj
  */
 typedef struct sock_udp sock_udp_t;
 
+/**
+ * @brief   A message of a batch for @ref sock_udp_send_batch() and
+ *          @ref sock_udp_recv_batch()
+ */
+typedef struct {
+    void *data;             /**< payload to send or buffer to receive into */
+    size_t len;             /**< length of the payload or space at
+                             *   sock_udp_msg_t::data, set to the length of
+                             *   the received payload */
+    sock_udp_ep_t *remote;  /**< remote end point to send to (may be NULL for
+                             *   the remote of the sock) or of the received
+                             *   message (may be NULL if not required) */
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -399,6 +413,63 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep);
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives a UDP message from a remote end point without copying it
+ *
+ * Instead of copying the payload into a buffer provided by the caller, the
+ * payload is handed to the application in the buffer of the network stack.
+ * The payload may be split into several chunks. Every call with the
+ * @p buf_ctx returned by the previous call provides the next chunk. When
+ * there are no more chunks, 0 is returned and the buffer is released:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = sock_udp_recv_buf(&sock, &data, &ctx, SOCK_NO_TIMEOUT,
+ *                                 NULL)) > 0) {
+ *     parse(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre `(sock != NULL) && (data != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[out] data     Pointer to the current chunk of the payload. The chunk
+ *                      may be shared with other receivers and must not be
+ *                      written to. It is only valid until the next call with
+ *                      @p buf_ctx.
+ * @param[in,out] buf_ctx   Context of the buffer. Must point to NULL to
+ *                      receive a new message. Is set to NULL again, when the
+ *                      buffer was released.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *                      Ignored if `*buf_ctx != NULL`.
+ * @param[out] remote   Remote end point of the received data.
+ *                      May be `NULL`, if it is not required by the application.
+ *                      Only set on the first chunk.
+ *
+ * @note    Function blocks if no packet is currently waiting.
+ * @note    A received message occupies the buffer of the network stack until
+ *          it was released. To release it before all chunks were read, call
+ *          this function until it returns 0.
+ *
+ * @return  The number of bytes in the chunk at @p data on success.
+ * @return  0, if there are no more chunks. The buffer was released. This is
+ *          also the case on the first call for a message without payload.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -ENOMEM, if no memory was available to receive @p data.
+ * @return  -EPROTO, if source address of received packet did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote);
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
@@ -427,12 +498,66 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
  *          neither the local end point of `sock` nor remote are assigned to
  *          `SOCK_ADDR_ANY_NETIF` but are nevertheless different.
  * @return  -EINVAL, if sock_udp_ep_t::port of @p remote is 0.
+ * @return  -EMSGSIZE, if @p data does not fit into the known path MTU towards
+ *          @p remote or remote end point of @p sock.
  * @return  -ENOMEM, if no memory was available to send @p data.
  * @return  -ENOTCONN, if `remote == NULL`, but @p sock has no remote end point.
  */
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives several UDP messages from remote end points
+ *
+ * Waits for the first message like @ref sock_udp_recv() and then receives
+ * the messages that are already waiting, up to @p num.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  The buffers to receive into. sock_udp_msg_t::len is
+ *                      set to the length of the received message.
+ * @param[in] num       Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for the first message in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @note    An error on a message after the first ends the batch. The
+ *          message is dropped, as with @ref sock_udp_recv().
+ *
+ * @return  The number of messages received on success.
+ * @return  The errors of @ref sock_udp_recv(), if the first message could
+ *          not be received.
+ */
+ssize_t sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                            size_t num, uint32_t timeout);
+
+/**
+ * @brief   Sends several UDP messages to remote end points
+ *
+ * Compared to calling @ref sock_udp_send() for every message, the sock is
+ * bound and checked only once, and a remote end point is only checked when
+ * it differs from the one of the previous message. Implementations may also
+ * select the source address only once for consecutive messages to the same
+ * remote end point.
+ *
+ * @pre `(sock != NULL) && ((num == 0) || (msgs != NULL))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] msgs      The messages to send. sock_udp_msg_t::remote may be
+ *                      NULL if @p sock has a remote end point.
+ * @param[in] num       Number of entries in @p msgs.
+ *
+ * @return  The number of messages sent on success. Sending stops at the
+ *          first message that fails.
+ * @return  The errors of @ref sock_udp_send(), if the first message could
+ *          not be sent.
+ */
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                            size_t num);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
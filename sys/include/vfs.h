@@ -88,6 +88,15 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef VFS_POLL_THREAD_FLAG
+/**
+ * @brief Thread flag set by vfs_poll_notify() on threads waiting for a file
+ *
+ * The flag must not be used otherwise by threads calling vfs_poll_wait().
+ */
+#define VFS_POLL_THREAD_FLAG (0x1 << 13)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -346,6 +355,22 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     ssize_t (*write) (vfs_file_t *filp, const void *src, size_t nbytes);
+
+    /**
+     * @brief Check if an open file is ready for reading or writing
+     *
+     * This function must not block. A driver that implements it must call
+     * vfs_poll_notify() whenever one of the events may have become ready,
+     * e.g. when data was received. Files without this function are always
+     * ready for reading and writing.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  events   events of interest, see man 3p poll
+     *
+     * @return the events of @p events that are ready
+     * @return <0 on error
+     */
+    int (*poll) (vfs_file_t *filp, int events);
 };
 
 /**
@@ -790,6 +815,44 @@ int vfs_statvfs(const char *restrict path, struct statvfs *restrict buf);
  */
 int vfs_bind(int fd, int flags, const vfs_file_ops_t *f_op, void *private_data);
 
+/**
+ * @brief Check if an open file is ready for reading or writing
+ *
+ * @param[in]  fd       fd number to check
+ * @param[in]  events   events of interest, see man 3p poll
+ *
+ * @return the events of @p events that are ready
+ * @return <0 on error
+ */
+int vfs_poll(int fd, int events);
+
+#if defined(MODULE_CORE_THREAD_FLAGS) || defined(DOXYGEN)
+/**
+ * @brief Start waiting for files to become ready
+ *
+ * Until vfs_poll_wait_stop() is called, @ref VFS_POLL_THREAD_FLAG is set on
+ * the calling thread whenever a file may have become ready. Call this before
+ * checking the files with vfs_poll(), so no notification is missed.
+ */
+void vfs_poll_wait_start(void);
+
+/**
+ * @brief Stop waiting for files to become ready
+ */
+void vfs_poll_wait_stop(void);
+
+/**
+ * @brief Notify the waiting threads that a file may have become ready
+ *
+ * May be called from interrupt context.
+ */
+void vfs_poll_notify(void);
+#else
+static inline void vfs_poll_notify(void)
+{
+}
+#endif
+
 /**
  * @brief Normalize a path
  *
@@ -20,6 +20,7 @@
 
 #include <errno.h>
 #include "net/gcoap.h"
+#include "net/sock/async.h"
 #include "random.h"
 #include "thread.h"
 
@@ -28,7 +29,8 @@
 
 /* Internal functions */
 static void *_event_loop(void *arg);
-static void _listen(sock_udp_t *sock);
+static void _sock_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg);
+static int _listen(sock_udp_t *sock);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len);
 static ssize_t _write_options(coap_pkt_t *pdu, uint8_t *buf, size_t len);
 static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
@@ -85,59 +87,68 @@ static void *_event_loop(void *arg)
         return 0;
     }
 
+    sock_udp_set_cb(&_sock, _sock_cb, NULL);
+
     while(1) {
-        res = msg_try_receive(&msg_rcvd);
+        msg_receive(&msg_rcvd);
 
-        if (res > 0) {
-            switch (msg_rcvd.type) {
-                case GCOAP_MSG_TYPE_TIMEOUT:
-                    _expire_request((gcoap_request_memo_t *)msg_rcvd.content.ptr);
-                    break;
-                case GCOAP_MSG_TYPE_INTR:
-                    /* next _listen() timeout will account for open requests */
-                    break;
-                default:
-                    break;
-            }
+        switch (msg_rcvd.type) {
+            case GCOAP_MSG_TYPE_TIMEOUT:
+                _expire_request((gcoap_request_memo_t *)msg_rcvd.content.ptr);
+                break;
+            default:
+                /* GCOAP_MSG_TYPE_RECV is handled below */
+                break;
         }
-
-        _listen(&_sock);
+        /* Handle all messages waiting on the sock after any IPC message. A
+         * notification is only lost if the queue is full, and then one of the
+         * queued messages gets here. */
+        while (_listen(&_sock)) {}
     }
 
     return 0;
 }
 
-/* Listen for an incoming CoAP message. */
-static void _listen(sock_udp_t *sock)
+/* Notifies the gcoap thread of messages received on the sock. */
+static void _sock_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    msg_t msg = { .type = GCOAP_MSG_TYPE_RECV };
+
+    (void)sock;
+    (void)arg;
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        msg_try_send(&msg, _pid);
+    }
+}
+
+/* Handles an incoming CoAP message; returns 0 if none is waiting. */
+static int _listen(sock_udp_t *sock)
 {
     coap_pkt_t pdu;
     uint8_t buf[GCOAP_PDU_BUF_SIZE];
     sock_udp_ep_t remote;
     gcoap_request_memo_t *memo = NULL;
-    uint8_t open_reqs = gcoap_op_state();
 
-    ssize_t res = sock_udp_recv(sock, buf, sizeof(buf),
-                                open_reqs > 0 ? GCOAP_RECV_TIMEOUT : SOCK_NO_TIMEOUT,
-                                &remote);
+    ssize_t res = sock_udp_recv(sock, buf, sizeof(buf), 0, &remote);
     if (res <= 0) {
 #if ENABLE_DEBUG
-        if (res < 0 && res != -ETIMEDOUT) {
+        if (res < 0 && res != -EAGAIN) {
             DEBUG("gcoap: udp recv failure: %d\n", res);
         }
 #endif
-        return;
+        return (res != -EAGAIN);
     }
 
     res = coap_parse(&pdu, buf, res);
     if (res < 0) {
         DEBUG("gcoap: parse failure: %d\n", res);
         /* If a response, can't clear memo, but it will timeout later. */
-        return;
+        return 1;
     }
 
     if (pdu.hdr->code == COAP_CODE_EMPTY) {
         DEBUG("gcoap: empty messages not handled yet\n");
-        return;
+        return 1;
 
     /* incoming request */
     } else if (coap_get_code_class(&pdu) == COAP_CLASS_REQ) {
@@ -150,7 +161,7 @@ static void _listen(sock_udp_t *sock)
         }
         else {
             DEBUG("gcoap: illegal request type: %u\n", coap_get_type(&pdu));
-            return;
+            return 1;
         }
     }
 
@@ -164,6 +175,7 @@ static void _listen(sock_udp_t *sock)
             memo->state = GCOAP_MEMO_UNUSED;
         }
     }
+    return 1;
 }
 
 /*
@@ -698,21 +710,11 @@ size_t gcoap_req_send2(const uint8_t *buf, size_t len,
         size_t res = sock_udp_send(&_sock, buf, len, remote);
 
         if (res && (GCOAP_NON_TIMEOUT > 0)) {
-            /* interrupt sock listening (to set a listen timeout) */
-            msg_t mbox_msg;
-            mbox_msg.type          = GCOAP_MSG_TYPE_INTR;
-            mbox_msg.content.value = 0;
-            if (mbox_try_put(&_sock.reg.mbox, &mbox_msg)) {
-                /* start response wait timer */
-                memo->timeout_msg.type        = GCOAP_MSG_TYPE_TIMEOUT;
-                memo->timeout_msg.content.ptr = (char *)memo;
-                xtimer_set_msg(&memo->response_timer, GCOAP_NON_TIMEOUT,
-                                                      &memo->timeout_msg, _pid);
-            }
-            else {
-                memo->state = GCOAP_MEMO_UNUSED;
-                DEBUG("gcoap: can't wake up mbox; no timeout for msg\n");
-            }
+            /* start response wait timer */
+            memo->timeout_msg.type        = GCOAP_MSG_TYPE_TIMEOUT;
+            memo->timeout_msg.content.ptr = (char *)memo;
+            xtimer_set_msg(&memo->response_timer, GCOAP_NON_TIMEOUT,
+                                                  &memo->timeout_msg, _pid);
         }
         else if (!res) {
             memo->state = GCOAP_MEMO_UNUSED;
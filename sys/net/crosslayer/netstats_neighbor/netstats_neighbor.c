@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ieee802154.h"
+#include "net/netstats/neighbor.h"
+#ifdef MODULE_GNRC_NETIF_HDR
+#include "net/gnrc/netif/hdr.h"
+#endif
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static netstats_nb_t _nbs[NETSTATS_NB_SIZE];
+static mutex_t _mutex = MUTEX_INIT;
+
+static inline uint32_t _now(void)
+{
+    return xtimer_now_usec() / US_PER_SEC;
+}
+
+static bool _get_iid(eui64_t *iid, const uint8_t *l2_addr, uint8_t l2_addr_len)
+{
+    if (l2_addr_len == ETHERNET_ADDR_LEN) {
+        ethernet_get_iid(iid, (uint8_t *)l2_addr);
+        return true;
+    }
+    return (ieee802154_get_iid(iid, l2_addr, l2_addr_len) != NULL);
+}
+
+static netstats_nb_t *_find(kernel_pid_t iface, const eui64_t *iid)
+{
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if ((_nbs[i].iface == iface) &&
+            (memcmp(&_nbs[i].iid, iid, sizeof(eui64_t)) == 0)) {
+            return &_nbs[i];
+        }
+    }
+    return NULL;
+}
+
+static netstats_nb_t *_alloc(kernel_pid_t iface, const eui64_t *iid)
+{
+    netstats_nb_t *res = NULL;
+    uint32_t now = _now();
+
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if (_nbs[i].iface == KERNEL_PID_UNDEF) {
+            res = &_nbs[i];
+            break;
+        }
+        /* replace the neighbor that was not updated for the longest time */
+        if ((res == NULL) ||
+            ((now - _nbs[i].last_updated) > (now - res->last_updated))) {
+            res = &_nbs[i];
+        }
+    }
+    DEBUG("netstats_nb: add neighbor %02x%02x:%02x%02x:%02x%02x:%02x%02x\n",
+          iid->uint8[0], iid->uint8[1], iid->uint8[2], iid->uint8[3],
+          iid->uint8[4], iid->uint8[5], iid->uint8[6], iid->uint8[7]);
+    memset(res, 0, sizeof(netstats_nb_t));
+    res->iid = *iid;
+    res->iface = iface;
+    res->etx = NETSTATS_NB_ETX_INIT;
+    res->last_updated = now;
+    return res;
+}
+
+void netstats_nb_init(void)
+{
+    mutex_lock(&_mutex);
+    memset(_nbs, 0, sizeof(_nbs));
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        _nbs[i].iface = KERNEL_PID_UNDEF;
+    }
+    mutex_unlock(&_mutex);
+}
+
+void netstats_nb_record(kernel_pid_t iface, const uint8_t *l2_addr,
+                        uint8_t l2_addr_len)
+{
+    netstats_nb_t *nb;
+    eui64_t iid;
+
+    if (!_get_iid(&iid, l2_addr, l2_addr_len)) {
+        return;
+    }
+    mutex_lock(&_mutex);
+    /* only the last frame on an interface awaits its outcome */
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if (_nbs[i].iface == iface) {
+            _nbs[i].pending = 0;
+        }
+    }
+    if ((nb = _find(iface, &iid)) == NULL) {
+        nb = _alloc(iface, &iid);
+    }
+    nb->pending = 1;
+    mutex_unlock(&_mutex);
+}
+
+void netstats_nb_update_tx(kernel_pid_t iface, netstats_nb_result_t result,
+                           uint8_t transmissions)
+{
+    netstats_nb_t *nb = NULL;
+    uint32_t sample;
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if ((_nbs[i].iface == iface) && _nbs[i].pending) {
+            nb = &_nbs[i];
+            break;
+        }
+    }
+    if (nb == NULL) {
+        mutex_unlock(&_mutex);
+        return;
+    }
+    nb->pending = 0;
+    if (transmissions == 0) {
+        transmissions = 1;
+    }
+    if (result == NETSTATS_NB_SUCCESS) {
+        nb->tx_success++;
+        sample = transmissions;
+    }
+    else {
+        nb->tx_failed++;
+        sample = NETSTATS_NB_ETX_NOACK_PENALTY;
+        if (result == NETSTATS_NB_BUSY) {
+            /* nothing was sent */
+            transmissions = 0;
+        }
+    }
+    nb->tx_count += transmissions;
+    sample *= NETSTATS_NB_ETX_DIVISOR;
+    if (nb->samples == 0) {
+        nb->etx = sample;
+    }
+    else if (nb->samples < NETSTATS_NB_FRESH_SAMPLES) {
+        nb->etx = (nb->etx + sample) / 2;
+    }
+    else {
+        nb->etx = ((nb->etx * (8U - NETSTATS_NB_ETX_ALPHA)) +
+                   (sample * NETSTATS_NB_ETX_ALPHA)) / 8U;
+    }
+    if (nb->samples < NETSTATS_NB_FRESH_SAMPLES) {
+        nb->samples++;
+    }
+    nb->last_updated = _now();
+    DEBUG("netstats_nb: result %u after %u transmissions, ETX %u/%u\n",
+          (unsigned)result, (unsigned)transmissions, nb->etx,
+          NETSTATS_NB_ETX_DIVISOR);
+    mutex_unlock(&_mutex);
+}
+
+void netstats_nb_update_tx_dev(netdev_t *dev, kernel_pid_t iface,
+                               netstats_nb_result_t result)
+{
+    uint8_t retries = 0;
+    netopt_t opt = (result == NETSTATS_NB_SUCCESS) ? NETOPT_TX_RETRIES_NEEDED
+                                                   : NETOPT_RETRANS;
+
+    /* devices that do not know these options sent the frame once */
+    if ((result == NETSTATS_NB_BUSY) ||
+        (dev->driver->get(dev, opt, &retries, sizeof(retries)) < 0)) {
+        retries = 0;
+    }
+    netstats_nb_update_tx(iface, result, retries + 1);
+}
+
+#ifdef MODULE_GNRC_NETIF_HDR
+void netstats_nb_record_pkt(kernel_pid_t iface, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->data;
+
+    /* only unicast frames are acknowledged */
+    if ((pkt->type == GNRC_NETTYPE_NETIF) && (hdr->dst_l2addr_len > 0) &&
+        !(hdr->flags & (GNRC_NETIF_HDR_FLAGS_BROADCAST |
+                        GNRC_NETIF_HDR_FLAGS_MULTICAST))) {
+        netstats_nb_record(iface, gnrc_netif_hdr_get_dst_addr(hdr),
+                           hdr->dst_l2addr_len);
+    }
+}
+#endif
+
+netstats_nb_t *netstats_nb_get(kernel_pid_t iface, const eui64_t *iid)
+{
+    netstats_nb_t *res;
+
+    mutex_lock(&_mutex);
+    res = _find(iface, iid);
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+uint16_t netstats_nb_etx(kernel_pid_t iface, const eui64_t *iid)
+{
+    netstats_nb_t *nb;
+    uint16_t res = NETSTATS_NB_ETX_INIT;
+
+    mutex_lock(&_mutex);
+    if ((nb = _find(iface, iid)) != NULL) {
+        res = nb->etx;
+    }
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+netstats_nb_t *netstats_nb_iter(const netstats_nb_t *prev)
+{
+    const netstats_nb_t *end = &_nbs[NETSTATS_NB_SIZE];
+
+    prev = (prev == NULL) ? _nbs : (prev + 1);
+    for (; prev < end; prev++) {
+        if (prev->iface != KERNEL_PID_UNDEF) {
+            return (netstats_nb_t *)prev;
+        }
+    }
+    return NULL;
+}
+
+/** @} */
@@ -29,6 +29,9 @@
 
 #include "net/gnrc/netdev.h"
 #include "net/ethernet/hdr.h"
+#ifdef MODULE_NETSTATS_NEIGHBOR
+#include "net/netstats/neighbor.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -73,12 +76,27 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
 
                     break;
                 }
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_NEIGHBOR)
             case NETDEV_EVENT_TX_MEDIUM_BUSY:
+#ifdef MODULE_NETSTATS_L2
                 dev->stats.tx_failed++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_update_tx_dev(dev, gnrc_netdev->pid, NETSTATS_NB_BUSY);
+#endif
                 break;
             case NETDEV_EVENT_TX_COMPLETE:
+#ifdef MODULE_NETSTATS_L2
                 dev->stats.tx_success++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_update_tx_dev(dev, gnrc_netdev->pid, NETSTATS_NB_SUCCESS);
+#endif
+                break;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            case NETDEV_EVENT_TX_NOACK:
+                netstats_nb_update_tx_dev(dev, gnrc_netdev->pid, NETSTATS_NB_NOACK);
                 break;
 #endif
             default:
@@ -143,6 +161,9 @@ static void *_gnrc_netdev_thread(void *args)
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netdev: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 gnrc_pktsnip_t *pkt = msg.content.ptr;
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_record_pkt(gnrc_netdev->pid, pkt);
+#endif
                 gnrc_netdev->send(gnrc_netdev, pkt);
                 break;
             case GNRC_NETAPI_MSG_TYPE_SET:
@@ -22,6 +22,9 @@
 #ifdef MODULE_NETSTATS_IPV6
 #include "net/netstats.h"
 #endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+#include "net/netstats/neighbor.h"
+#endif
 #include "log.h"
 #include "sched.h"
 
@@ -506,6 +509,67 @@ static ipv6_addr_t *_src_addr_selection(gnrc_netif2_t *netif,
                                         uint8_t *candidate_set);
 static int _group_idx(const gnrc_netif2_t *netif, const ipv6_addr_t *addr);
 
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+#define _SRC_CACHE_FLAGS_VALID      (0x01U)
+#define _SRC_CACHE_FLAGS_LL_ONLY    (0x02U)
+
+static inline void _src_cache_flush(gnrc_netif2_t *netif)
+{
+    memset(netif->ipv6.src_cache, 0, sizeof(netif->ipv6.src_cache));
+}
+
+static inline uint8_t _src_cache_flags(bool ll_only)
+{
+    return _SRC_CACHE_FLAGS_VALID | ((ll_only) ? _SRC_CACHE_FLAGS_LL_ONLY : 0);
+}
+
+static gnrc_netif2_ipv6_src_cache_t *_src_cache_get(gnrc_netif2_t *netif,
+                                                    const ipv6_addr_t *dst,
+                                                    bool ll_only)
+{
+    const uint8_t flags = _src_cache_flags(ll_only);
+
+    for (unsigned i = 0; i < GNRC_NETIF2_IPV6_SRC_CACHE_SIZE; i++) {
+        gnrc_netif2_ipv6_src_cache_t *entry = &netif->ipv6.src_cache[i];
+
+        if ((entry->flags == flags) && (entry->dst_pfx.u64 == dst->u64[0].u64)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief   Caches the result of a source address selection for @p dst
+ *
+ * The selection only depends on the scope of @p dst and on how far the
+ * addresses of @p netif match @p dst. Both are the same for all destinations
+ * with the same upper 64 bits, unless an address on @p netif matches @p dst
+ * beyond them (e.g. rule 1 or rule 8 with a prefix longer than /64); such
+ * results are not cached.
+ */
+static void _src_cache_add(gnrc_netif2_t *netif, const ipv6_addr_t *dst,
+                           bool ll_only, int idx)
+{
+    gnrc_netif2_ipv6_src_cache_t *entry;
+
+    for (unsigned i = 0; i < GNRC_NETIF2_IPV6_ADDRS_NUMOF; i++) {
+        if ((netif->ipv6.addrs_flags[i] != 0) &&
+            (ipv6_addr_match_prefix(&netif->ipv6.addrs[i], dst) >= 64U)) {
+            return;
+        }
+    }
+    entry = &netif->ipv6.src_cache[netif->ipv6.src_cache_next];
+    netif->ipv6.src_cache_next = (netif->ipv6.src_cache_next + 1) %
+                                 GNRC_NETIF2_IPV6_SRC_CACHE_SIZE;
+    entry->dst_pfx = dst->u64[0];
+    entry->idx = idx;
+    entry->flags = _src_cache_flags(ll_only);
+}
+#else
+#define _src_cache_flush(netif)     (void)netif
+#endif
+
 int gnrc_netif2_ipv6_addr_add(gnrc_netif2_t *netif, const ipv6_addr_t *addr,
                               unsigned pfx_len, uint8_t flags)
 {
@@ -537,6 +601,7 @@ int gnrc_netif2_ipv6_addr_add(gnrc_netif2_t *netif, const ipv6_addr_t *addr,
     }
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    _src_cache_flush(netif);
     /* TODO:
      *  - update prefix list, if flags == VALID
      *  - with SLAAC, send out NS otherwise for DAD probing */
@@ -556,6 +621,7 @@ void gnrc_netif2_ipv6_addr_remove(gnrc_netif2_t *netif,
     if (idx >= 0) {
         netif->ipv6.addrs_flags[idx] = 0;
         ipv6_addr_set_unspecified(&netif->ipv6.addrs[idx]);
+        _src_cache_flush(netif);
         /* TODO:
          *  - update prefix list, if necessary */
     }
@@ -597,8 +663,17 @@ ipv6_addr_t *gnrc_netif2_ipv6_addr_best_src(gnrc_netif2_t *netif,
     BITFIELD(candidate_set, GNRC_NETIF2_IPV6_ADDRS_NUMOF);
 
     assert((netif != NULL) && (dst != NULL));
-    memset(candidate_set, 0, sizeof(candidate_set));
     gnrc_netif2_acquire(netif);
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+    gnrc_netif2_ipv6_src_cache_t *entry = _src_cache_get(netif, dst, ll_only);
+
+    if (entry != NULL) {
+        best_src = (entry->idx < 0) ? NULL : &netif->ipv6.addrs[entry->idx];
+        gnrc_netif2_release(netif);
+        return best_src;
+    }
+#endif
+    memset(candidate_set, 0, sizeof(candidate_set));
     int first_candidate = _create_candidate_set(netif, dst, ll_only,
                                                 candidate_set);
     if (first_candidate >= 0) {
@@ -607,6 +682,10 @@ ipv6_addr_t *gnrc_netif2_ipv6_addr_best_src(gnrc_netif2_t *netif,
             best_src = &(netif->ipv6.addrs[first_candidate]);
         }
     }
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+    _src_cache_add(netif, dst, ll_only,
+                   (best_src == NULL) ? -1 : (best_src - netif->ipv6.addrs));
+#endif
     gnrc_netif2_release(netif);
     return best_src;
 }
@@ -1153,6 +1232,9 @@ static void *_gnrc_netif2_thread(void *args)
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif2: GNRC_NETDEV_MSG_TYPE_SND received\n");
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_record_pkt(netif->pid, msg.content.ptr);
+#endif
                 res = netif->ops->send(netif, msg.content.ptr);
 #if ENABLE_DEBUG
                 if (res < 0) {
@@ -1243,16 +1325,31 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                     }
                 }
                 break;
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_NEIGHBOR)
             case NETDEV_EVENT_TX_MEDIUM_BUSY:
+#ifdef MODULE_NETSTATS_L2
                 /* we are the only ones supposed to touch this variable,
                  * so no acquire necessary */
                 dev->stats.tx_failed++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_update_tx_dev(dev, netif->pid, NETSTATS_NB_BUSY);
+#endif
                 break;
             case NETDEV_EVENT_TX_COMPLETE:
+#ifdef MODULE_NETSTATS_L2
                 /* we are the only ones supposed to touch this variable,
                  * so no acquire necessary */
                 dev->stats.tx_success++;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+                netstats_nb_update_tx_dev(dev, netif->pid, NETSTATS_NB_SUCCESS);
+#endif
+                break;
+#endif
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            case NETDEV_EVENT_TX_NOACK:
+                netstats_nb_update_tx_dev(dev, netif->pid, NETSTATS_NB_NOACK);
                 break;
 #endif
             default:
@@ -30,14 +30,38 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+#ifdef MODULE_GNRC_UDP
+/* UDP entries are hashed by port, since there are usually many of them and
+ * ephemeral port allocation looks up every candidate port */
+static gnrc_netreg_entry_t *_udp_ports[GNRC_NETREG_UDP_BUCKETS];
+#endif
+
+/* all entries with the same demux context share a list */
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+#ifdef MODULE_GNRC_UDP
+    if (type == GNRC_NETTYPE_UDP) {
+        return &_udp_ports[demux_ctx % GNRC_NETREG_UDP_BUCKETS];
+    }
+#else
+    (void)demux_ctx;
+#endif
+    return &netreg[type];
+}
+
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#ifdef MODULE_GNRC_UDP
+    memset(_udp_ports, 0, sizeof(_udp_ports));
+#endif
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
+    gnrc_netreg_entry_t **head;
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #ifdef DEVELHELP
     /* only threads with a message queue are allowed to register at gnrc */
@@ -53,18 +77,25 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+    head = _head(type, entry->demux_ctx);
+    LL_PREPEND(*head, entry);
 
     return 0;
 }
 
 void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
+    gnrc_netreg_entry_t **head;
+
     if (_INVALID_TYPE(type)) {
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    head = _head(type, entry->demux_ctx);
+    /* a bucket is empty much more often than a list of a whole type */
+    if (*head != NULL) {
+        LL_DELETE(*head, entry);
+    }
 }
 
 gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
@@ -75,7 +106,7 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
         return NULL;
     }
 
-    LL_SEARCH_SCALAR(netreg[type], res, demux_ctx, demux_ctx);
+    LL_SEARCH_SCALAR(*_head(type, demux_ctx), res, demux_ctx, demux_ctx);
 
     return res;
 }
@@ -89,7 +120,7 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
         return 0;
     }
 
-    entry = netreg[type];
+    entry = *_head(type, demux_ctx);
 
     while (entry != NULL) {
         if (entry->demux_ctx == demux_ctx) {
@@ -34,6 +34,11 @@
 
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/icmpv6/echo.h"
+#ifdef MODULE_GNRC_IPV6_PMTU
+#include "net/ipv6.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/ipv6/pmtu.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -57,6 +62,35 @@ static inline uint16_t _calc_csum(gnrc_pktsnip_t *hdr,
     return ~csum;
 }
 
+#ifdef MODULE_GNRC_IPV6_PMTU
+static void _pkt_too_big_handle(icmpv6_error_pkt_too_big_t *ptb, size_t size)
+{
+    /* invoking packet's IPv6 header follows the Packet Too Big message */
+    ipv6_hdr_t *orig_hdr = (ipv6_hdr_t *)(ptb + 1);
+
+    if (size < (sizeof(icmpv6_error_pkt_too_big_t) + sizeof(ipv6_hdr_t))) {
+        DEBUG("icmpv6: packet too big message too short.\n");
+        return;
+    }
+    if (!ipv6_hdr_is(orig_hdr)) {
+        DEBUG("icmpv6: packet too big message does not contain IPv6 packet.\n");
+        return;
+    }
+    /* only packets sent by this node may change its path MTU estimates,
+     * otherwise any node could shrink the path MTU of arbitrary destinations */
+    if (gnrc_ipv6_netif_find_by_addr(NULL, &orig_hdr->src) == KERNEL_PID_UNDEF) {
+        DEBUG("icmpv6: invoking packet of packet too big message not sent "
+              "by this node.\n");
+        return;
+    }
+    if (byteorder_ntohl(ptb->mtu) < IPV6_MIN_MTU) {
+        DEBUG("icmpv6: packet too big message with MTU below minimum.\n");
+        return;
+    }
+    gnrc_ipv6_pmtu_update(&orig_hdr->dst, byteorder_ntohl(ptb->mtu));
+}
+#endif
+
 void gnrc_icmpv6_demux(kernel_pid_t iface, gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *icmpv6, *ipv6;
@@ -98,6 +132,14 @@ void gnrc_icmpv6_demux(kernel_pid_t iface, gnrc_pktsnip_t *pkt)
             break;
 #endif
 
+#ifdef MODULE_GNRC_IPV6_PMTU
+        case ICMPV6_PKT_TOO_BIG:
+            DEBUG("icmpv6: packet too big message received.\n");
+            _pkt_too_big_handle((icmpv6_error_pkt_too_big_t *)hdr,
+                                icmpv6->size);
+            break;
+#endif
+
 #ifndef MODULE_GNRC_IPV6_NIB
 #if (defined(MODULE_GNRC_NDP_ROUTER) || defined(MODULE_GNRC_SIXLOWPAN_ND_ROUTER))
         case ICMPV6_RTR_SOL:
@@ -20,9 +20,60 @@
 
 #include "net/gnrc/ipv6/ext.h"
 
+#ifdef MODULE_GNRC_MPL
+#include "net/gnrc/mpl.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+static inline bool _is_ext(uint8_t nh)
+{
+    switch (nh) {
+        case PROTNUM_IPV6_EXT_HOPOPT:
+        case PROTNUM_IPV6_EXT_DST:
+        case PROTNUM_IPV6_EXT_RH:
+        case PROTNUM_IPV6_EXT_FRAG:
+        case PROTNUM_IPV6_EXT_AH:
+        case PROTNUM_IPV6_EXT_ESP:
+        case PROTNUM_IPV6_EXT_MOB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void gnrc_ipv6_ext_iter_init(gnrc_ipv6_ext_iter_t *iter, gnrc_pktsnip_t *snip,
+                             uint8_t nh)
+{
+    iter->data = snip->data;
+    iter->size = snip->size;
+    iter->offset = 0;
+    iter->nh = nh;
+}
+
+int gnrc_ipv6_ext_iter_next(gnrc_ipv6_ext_iter_t *iter, ipv6_ext_t **ext)
+{
+    ipv6_ext_t *hdr;
+    size_t len;
+
+    if (!_is_ext(iter->nh)) {
+        return 0;
+    }
+    if ((iter->size - iter->offset) < sizeof(ipv6_ext_t)) {
+        return -EOVERFLOW;
+    }
+    hdr = (ipv6_ext_t *)(iter->data + iter->offset);
+    len = (hdr->len * IPV6_EXT_LEN_UNIT) + IPV6_EXT_LEN_UNIT;
+    if ((iter->size - iter->offset) < len) {
+        return -EOVERFLOW;
+    }
+    iter->offset += len;
+    iter->nh = hdr->nh;
+    *ext = hdr;
+    return 1;
+}
+
 #ifdef MODULE_GNRC_RPL_SRH
 
 enum gnrc_ipv6_ext_demux_status {
@@ -31,10 +82,13 @@ enum gnrc_ipv6_ext_demux_status {
     GNRC_IPV6_EXT_ERROR,
 };
 
-static enum gnrc_ipv6_ext_demux_status _handle_rh(gnrc_pktsnip_t *current, gnrc_pktsnip_t *pkt)
+/* ext_offset: offset of the routing header within current */
+static enum gnrc_ipv6_ext_demux_status _handle_rh(gnrc_pktsnip_t *current,
+                                                  gnrc_pktsnip_t *pkt,
+                                                  size_t ext_offset)
 {
     gnrc_pktsnip_t *ipv6;
-    ipv6_ext_t *ext = (ipv6_ext_t *) current->data;
+    ipv6_ext_t *ext = (ipv6_ext_t *)(((uint8_t *)current->data) + ext_offset);
     size_t current_offset;
     ipv6_hdr_t *hdr;
 
@@ -57,7 +111,8 @@ static enum gnrc_ipv6_ext_demux_status _handle_rh(gnrc_pktsnip_t *current, gnrc_
         }
         pkt = ipv6;
         hdr = ipv6->data;
-        ext = (ipv6_ext_t *)(((uint8_t *)ipv6->data) + current_offset);
+        ext = (ipv6_ext_t *)(((uint8_t *)ipv6->data) + current_offset +
+                             ext_offset);
     }
     else {
         ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
@@ -89,79 +144,15 @@ static enum gnrc_ipv6_ext_demux_status _handle_rh(gnrc_pktsnip_t *current, gnrc_
 
 #endif
 
-/**
- * @brief marks IPv6 extension header if needed.
- *   updates pkt and returns next header.
- * @param[in] current  The current header
- * @param[in,out] pkt  The whole packet
- * @return The next header
- * @return NULL on error
- */
-static gnrc_pktsnip_t *_mark_extension_header(gnrc_pktsnip_t *current,
-                                              gnrc_pktsnip_t **pkt)
+/* returns the snip following current in direction of the payload (pkt) */
+static gnrc_pktsnip_t *_prev_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *current)
 {
-    gnrc_pktsnip_t *tmp, *next;
-    ipv6_ext_t *ext = (ipv6_ext_t *) current->data;
-    size_t offset = ((ext->len * IPV6_EXT_LEN_UNIT) + IPV6_EXT_LEN_UNIT);
-
-    if (current == *pkt) {
-        gnrc_pktsnip_t *ext_snip;
-        if ((tmp = gnrc_pktbuf_start_write(*pkt)) == NULL) {
-            DEBUG("ipv6: could not get a copy of pkt\n");
-            gnrc_pktbuf_release(*pkt);
-            return NULL;
-        }
-        *pkt = tmp;
-
-        ext_snip = gnrc_pktbuf_mark(*pkt, offset, GNRC_NETTYPE_IPV6_EXT);
-        next = *pkt;
-
-        if (ext_snip == NULL) {
-            gnrc_pktbuf_release(*pkt);
-            return NULL;
+    for (gnrc_pktsnip_t *tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        if (tmp->next == current) {
+            return tmp;
         }
     }
-    else {
-        /* the header is already marked */
-
-        next = NULL;
-
-        for (tmp = *pkt; tmp != NULL; tmp = tmp->next) {
-            if (tmp->next == current) {
-                next = tmp;
-                break;
-            }
-        }
-
-        assert(next != NULL);
-    }
-
-    return next;
-}
-
-static inline bool _has_valid_size(gnrc_pktsnip_t *pkt, uint8_t nh)
-{
-    ipv6_ext_t *ext;
-
-    if (pkt->size < sizeof(ipv6_ext_t)) {
-        return false;
-    }
-
-    ext = pkt->data;
-
-    switch (nh) {
-        case PROTNUM_IPV6_EXT_RH:
-        case PROTNUM_IPV6_EXT_HOPOPT:
-        case PROTNUM_IPV6_EXT_DST:
-        case PROTNUM_IPV6_EXT_FRAG:
-        case PROTNUM_IPV6_EXT_AH:
-        case PROTNUM_IPV6_EXT_ESP:
-        case PROTNUM_IPV6_EXT_MOB:
-            return ((ext->len * IPV6_EXT_LEN_UNIT) + IPV6_EXT_LEN_UNIT) <= pkt->size;
-
-        default:
-            return true;
-    }
+    return NULL;
 }
 
 /*
@@ -175,83 +166,91 @@ void gnrc_ipv6_ext_demux(kernel_pid_t iface,
                          gnrc_pktsnip_t *pkt,
                          uint8_t nh)
 {
+    gnrc_ipv6_ext_iter_t iter;
     ipv6_ext_t *ext;
+    int res;
 
+    gnrc_ipv6_ext_iter_init(&iter, current, nh);
     while (true) {
-        ext = (ipv6_ext_t *) current->data;
-
-        switch (nh) {
-            case PROTNUM_IPV6_EXT_RH:
+#if defined(MODULE_GNRC_RPL_SRH) || defined(MODULE_GNRC_MPL)
+        const uint8_t type = iter.nh;
+#endif
 #ifdef MODULE_GNRC_RPL_SRH
-                /* if current != pkt, size is already checked */
-                if (current == pkt && !_has_valid_size(pkt, nh)) {
-                    DEBUG("ipv6_ext: invalid size\n");
-                    gnrc_pktbuf_release(pkt);
-                    return;
-                }
-
-                switch (_handle_rh(current, pkt)) {
-                    case GNRC_IPV6_EXT_OK:
-                        /* We are the final destination. So proceeds like normal packet. */
-                        nh = ext->nh;
-                        DEBUG("ipv6_ext: next header = %" PRIu8 "\n", nh);
-
-                        if ((current = _mark_extension_header(current, &pkt)) == NULL) {
-                            return;
-                        }
-
-                        gnrc_ipv6_demux(iface, current, pkt, nh); /* demultiplex next header */
-
-                        return;
-
-                    case GNRC_IPV6_EXT_ERROR:
-                        /* already released by _handle_rh, so no release here */
-                        return;
-
-                    case GNRC_IPV6_EXT_FORWARDED:
-                        /* the packet is forwarded and released. finish processing */
-                        return;
-                }
-
-                break;
+        const size_t offset = iter.offset;
 #endif
 
-            case PROTNUM_IPV6_EXT_HOPOPT:
-            case PROTNUM_IPV6_EXT_DST:
-            case PROTNUM_IPV6_EXT_FRAG:
-            case PROTNUM_IPV6_EXT_AH:
-            case PROTNUM_IPV6_EXT_ESP:
-            case PROTNUM_IPV6_EXT_MOB:
-                /* TODO: add handling of types */
-
-                /* if current != pkt, size is already checked */
-                if (current == pkt && !_has_valid_size(pkt, nh)) {
-                    DEBUG("ipv6_ext: invalid size\n");
-                    gnrc_pktbuf_release(pkt);
+        res = gnrc_ipv6_ext_iter_next(&iter, &ext);
+        if ((res < 0) && (current != pkt) && (iter.offset == current->size)) {
+            /* header was already marked: continue with next snip */
+            current = _prev_snip(pkt, current);
+            assert(current != NULL);
+            gnrc_ipv6_ext_iter_init(&iter, current, iter.nh);
+            continue;
+        }
+        if (res < 0) {
+            DEBUG("ipv6_ext: invalid size\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        if (res == 0) {
+            /* upper layer header reached */
+            break;
+        }
+        DEBUG("ipv6_ext: next header = %" PRIu8 "\n", iter.nh);
+#ifdef MODULE_GNRC_MPL
+        if ((type == PROTNUM_IPV6_EXT_HOPOPT) &&
+            (gnrc_mpl_process_hbh(iface, current, ext) < 0)) {
+            DEBUG("ipv6_ext: dropping MPL message\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+#endif
+#ifdef MODULE_GNRC_RPL_SRH
+        /* TODO: add handling of other types */
+        if (type == PROTNUM_IPV6_EXT_RH) {
+            switch (_handle_rh(current, pkt, offset)) {
+                case GNRC_IPV6_EXT_OK:
+                    /* We are the final destination. So proceeds like normal packet. */
+                    break;
+
+                case GNRC_IPV6_EXT_ERROR:
+                    /* already released by _handle_rh, so no release here */
                     return;
-                }
 
-                nh = ext->nh;
-                DEBUG("ipv6_ext: next header = %" PRIu8 "\n", nh);
-
-                if ((current = _mark_extension_header(current, &pkt)) == NULL) {
+                case GNRC_IPV6_EXT_FORWARDED:
+                    /* the packet is forwarded and released. finish processing */
                     return;
-                }
-
-                gnrc_pktbuf_hold(pkt, 1);   /* don't release on next dispatch */
-                if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
-                    gnrc_pktbuf_release(pkt);
-                }
+            }
+        }
+#endif
+    }
 
-                break;
+    if ((current != pkt) && (iter.offset == current->size)) {
+        /* all headers in current were already marked: the upper layer header
+         * starts with the next snip */
+        current = _prev_snip(pkt, current);
+        assert(current != NULL);
+    }
+    else if (iter.offset > 0) {
+        /* split all extension headers still in current off at once */
+        if (current == pkt) {
+            gnrc_pktsnip_t *tmp;
 
-            default:
-                gnrc_ipv6_demux(iface, current, pkt, nh); /* demultiplex next header */
+            if ((tmp = gnrc_pktbuf_start_write(pkt)) == NULL) {
+                DEBUG("ipv6: could not get a copy of pkt\n");
+                gnrc_pktbuf_release(pkt);
                 return;
+            }
+            pkt = current = tmp;
+        }
+        if (gnrc_pktbuf_mark(current, iter.offset, GNRC_NETTYPE_IPV6_EXT) == NULL) {
+            DEBUG("ipv6_ext: could not mark extension headers\n");
+            gnrc_pktbuf_release(pkt);
+            return;
         }
     }
 
-    assert(false); /* never reaches here */
+    gnrc_ipv6_demux(iface, current, pkt, iter.nh); /* demultiplex next header */
 }
 
 gnrc_pktsnip_t *gnrc_ipv6_ext_build(gnrc_pktsnip_t *ipv6, gnrc_pktsnip_t *next,
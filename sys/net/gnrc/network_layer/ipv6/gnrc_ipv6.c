@@ -40,6 +40,10 @@
 
 #include "net/gnrc/ipv6.h"
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+#include "net/gnrc/rpl/srh.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
@@ -224,8 +228,10 @@ static void _dispatch_next_header(gnrc_pktsnip_t *current, gnrc_pktsnip_t *pkt,
 
     DEBUG("ipv6: forward nh = %u to other threads\n", nh);
 
-    /* dispatch IPv6 extension header only once */
-    if (should_dispatch_current_type) {
+    /* dispatch IPv6 extension header only once. An encapsulated IPv6 packet
+     * is not dispatched as IPv6 packet: that would hand it to this thread a
+     * second time, next to _decapsulate() */
+    if (should_dispatch_current_type && (nh != PROTNUM_IPV6)) {
         bool should_release = (gnrc_netreg_num(GNRC_NETTYPE_IPV6, nh) == 0) &&
                               (!interested);
 
@@ -681,6 +687,134 @@ static inline kernel_pid_t _next_hop_l2addr(uint8_t *l2addr, uint8_t *l2addr_len
 }
 #endif   /* MODULE_GNRC_IPV6_NIB */
 
+static void _send_to_next_hop(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
+                              gnrc_pktsnip_t *ipv6, gnrc_pktsnip_t *payload,
+                              bool prep_hdr)
+{
+    ipv6_hdr_t *hdr = ipv6->data;
+#ifndef MODULE_GNRC_IPV6_NIB
+    uint8_t l2addr_len = GNRC_IPV6_NC_L2_ADDR_MAX;
+    uint8_t l2addr[l2addr_len];
+
+    iface = _next_hop_l2addr(l2addr, &l2addr_len, iface, &hdr->dst, pkt);
+
+    if (iface == KERNEL_PID_UNDEF) {
+        DEBUG("ipv6: error determining next hop's link layer address\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+
+    if (prep_hdr) {
+        if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
+            /* error on filling up header */
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+    }
+
+    _send_unicast(iface, l2addr, l2addr_len, pkt);
+#else   /* MODULE_GNRC_IPV6_NIB */
+    gnrc_ipv6_nib_nc_t nce;
+
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, iface, pkt,
+                                          &nce) < 0) {
+        /* packet is released by NIB */
+        return;
+    }
+
+    if (prep_hdr) {
+        if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
+            /* error on filling up header */
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+    }
+
+    _send_unicast(gnrc_ipv6_nib_nc_get_iface(&nce), nce.l2addr,
+                  nce.l2addr_len, pkt);
+#endif  /* MODULE_GNRC_IPV6_NIB */
+}
+
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+/* inserts a source routing header if the destination is a node down a
+ * non-storing mode DODAG this node is root of */
+static int _add_srh(kernel_pid_t iface, gnrc_pktsnip_t *ipv6, bool *prep_hdr)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_hdr_t *hdr = ipv6->data;
+    ipv6_addr_t first_hop;
+    gnrc_pktsnip_t *srh;
+    int len;
+
+    if (!(*prep_hdr) ||
+        ((ipv6->next != NULL) && (ipv6->next->type == GNRC_NETTYPE_IPV6_EXT))) {
+        return 0;
+    }
+    len = gnrc_rpl_srh_root_get(&hdr->dst, &first_hop, buf, sizeof(buf));
+    if (len <= 0) {
+        /* no source route needed */
+        return 0;
+    }
+    /* the checksum of the upper layer covers the final destination */
+    if (_fill_ipv6_hdr(iface, ipv6, ipv6->next) < 0) {
+        return -1;
+    }
+    *prep_hdr = false;
+    if ((srh = gnrc_pktbuf_add(ipv6->next, buf, len, GNRC_NETTYPE_IPV6_EXT)) == NULL) {
+        DEBUG("ipv6: no space left in packet buffer for source routing header\n");
+        return -1;
+    }
+    ipv6->next = srh;
+    ((gnrc_rpl_srh_t *)srh->data)->nh = hdr->nh;
+    hdr->nh = PROTNUM_IPV6_EXT_RH;
+    hdr->len = byteorder_htons(byteorder_ntohs(hdr->len) + len);
+    hdr->dst = first_hop;
+    DEBUG("ipv6: inserted source routing header, first hop %s\n",
+          ipv6_addr_to_str(addr_str, &first_hop, sizeof(addr_str)));
+    return 0;
+}
+
+#ifdef MODULE_GNRC_IPV6_ROUTER
+/* tunnels a forwarded packet to a node down a non-storing mode DODAG this
+ * node is root of. Headers must not be inserted into packets of other nodes
+ * (RFC 8200, section 4), so the packet is encapsulated in an IPv6 header
+ * with a source routing header instead (RFC 6554, section 4) */
+static gnrc_pktsnip_t *_encap_srh(gnrc_pktsnip_t *ipv6)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_hdr_t *hdr = ipv6->data;
+    ipv6_addr_t first_hop;
+    gnrc_pktsnip_t *srh, *outer;
+    int len;
+
+    len = gnrc_rpl_srh_root_get(&hdr->dst, &first_hop, buf, sizeof(buf));
+    if (len <= 0) {
+        /* no source route needed */
+        return ipv6;
+    }
+    if ((srh = gnrc_pktbuf_add(ipv6, buf, len, GNRC_NETTYPE_IPV6_EXT)) == NULL) {
+        DEBUG("ipv6: no space left in packet buffer for source routing header\n");
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    ((gnrc_rpl_srh_t *)srh->data)->nh = PROTNUM_IPV6;
+    if ((outer = gnrc_ipv6_hdr_build(srh, NULL, &first_hop)) == NULL) {
+        DEBUG("ipv6: no space left in packet buffer for outer header\n");
+        gnrc_pktbuf_release(srh);
+        return NULL;
+    }
+    ((ipv6_hdr_t *)outer->data)->nh = PROTNUM_IPV6_EXT_RH;
+    if (_fill_ipv6_hdr(KERNEL_PID_UNDEF, outer, srh) < 0) {
+        gnrc_pktbuf_release(outer);
+        return NULL;
+    }
+    DEBUG("ipv6: encapsulated packet with source routing header, first hop %s\n",
+          ipv6_addr_to_str(addr_str, &first_hop, sizeof(addr_str)));
+    return outer;
+}
+#endif /* MODULE_GNRC_IPV6_ROUTER */
+#endif /* MODULE_GNRC_RPL_SRH_ROOT */
+
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
 {
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -771,47 +905,14 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
         }
     }
     else {
-#ifndef MODULE_GNRC_IPV6_NIB
-        uint8_t l2addr_len = GNRC_IPV6_NC_L2_ADDR_MAX;
-        uint8_t l2addr[l2addr_len];
-
-        iface = _next_hop_l2addr(l2addr, &l2addr_len, iface, &hdr->dst, pkt);
-
-        if (iface == KERNEL_PID_UNDEF) {
-            DEBUG("ipv6: error determining next hop's link layer address\n");
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+        if (_add_srh(iface, ipv6, &prep_hdr) < 0) {
             gnrc_pktbuf_release(pkt);
             return;
         }
-
-        if (prep_hdr) {
-            if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
-                /* error on filling up header */
-                gnrc_pktbuf_release(pkt);
-                return;
-            }
-        }
-
-        _send_unicast(iface, l2addr, l2addr_len, pkt);
-#else   /* MODULE_GNRC_IPV6_NIB */
-        gnrc_ipv6_nib_nc_t nce;
-
-        if (gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, iface, pkt,
-                                              &nce) < 0) {
-            /* packet is released by NIB */
-            return;
-        }
-
-        if (prep_hdr) {
-            if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
-                /* error on filling up header */
-                gnrc_pktbuf_release(pkt);
-                return;
-            }
-        }
-
-        _send_unicast(gnrc_ipv6_nib_nc_get_iface(&nce), nce.l2addr,
-                      nce.l2addr_len, pkt);
-#endif  /* MODULE_GNRC_IPV6_NIB */
+        payload = ipv6->next;
+#endif
+        _send_to_next_hop(iface, pkt, ipv6, payload, prep_hdr);
     }
 }
 
@@ -835,6 +936,82 @@ static inline bool _pkt_not_for_me(kernel_pid_t *iface, ipv6_hdr_t *hdr)
     }
 }
 
+#ifdef MODULE_GNRC_IPV6_ROUTER
+/* Forwarding fast path: the destination was already found to be non-local by
+ * _pkt_not_for_me() so the packet is neither demultiplexed to upper layers nor
+ * checked for local delivery again in _send() */
+static void _forward(gnrc_pktsnip_t *pkt, ipv6_hdr_t *hdr)
+{
+    gnrc_pktsnip_t *reversed_pkt = NULL, *ptr = pkt;
+
+    /* RFC 4291, section 2.5.6 states: "Routers must not forward any
+     * packets with Link-Local source or destination addresses to other
+     * links."
+     */
+    if ((ipv6_addr_is_link_local(&(hdr->src))) || (ipv6_addr_is_link_local(&(hdr->dst)))) {
+        DEBUG("ipv6: do not forward packets with link-local source or"
+              " destination address\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    /* TODO: check if receiving interface is router */
+    if (hdr->hl <= 1) {     /* drop packets that would *reach* Hop Limit 0 */
+        DEBUG("ipv6: hop limit reached 0: drop packet\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+
+    DEBUG("ipv6: forward packet to next hop\n");
+
+    /* reverse packet snip list order and remove L2 headers around IPv6.
+     * A received packet typically has only one user, so this neither copies
+     * nor allocates anything */
+    while (ptr != NULL) {
+        gnrc_pktsnip_t *next = ptr->next;
+
+        if (ptr->type == GNRC_NETTYPE_NETIF) {
+            ptr->next = NULL;
+            gnrc_pktbuf_release(ptr);
+            ptr = next;
+            continue;
+        }
+        next = gnrc_pktbuf_start_write(ptr);   /* duplicate if not already done */
+        if (next == NULL) {
+            DEBUG("ipv6: unable to get write access to packet: dropping it\n");
+            gnrc_pktbuf_release(reversed_pkt);
+            gnrc_pktbuf_release(ptr);
+            return;
+        }
+        ptr = next;
+        next = ptr->next;
+        ptr->next = reversed_pkt;
+        reversed_pkt = ptr;
+        ptr = next;
+    }
+
+    /* IPv6 header is now at the front and writable: decrement hop limit in
+     * place */
+    assert(reversed_pkt->type == GNRC_NETTYPE_IPV6);
+    hdr = reversed_pkt->data;
+    hdr->hl--;
+    DEBUG("ipv6: decremented hop limit to %u\n", hdr->hl);
+    if (ipv6_addr_is_multicast(&hdr->dst)) {
+        /* multicast beyond link-local scope has no next hop to resolve */
+        _send_multicast(KERNEL_PID_UNDEF, reversed_pkt, reversed_pkt,
+                        reversed_pkt->next, false);
+    }
+    else {
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+        if ((reversed_pkt = _encap_srh(reversed_pkt)) == NULL) {
+            return;
+        }
+#endif
+        _send_to_next_hop(KERNEL_PID_UNDEF, reversed_pkt, reversed_pkt,
+                          reversed_pkt->next, false);
+    }
+}
+#endif /* MODULE_GNRC_IPV6_ROUTER */
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -953,63 +1130,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
         DEBUG("ipv6: packet destination not this host\n");
 
 #ifdef MODULE_GNRC_IPV6_ROUTER    /* only routers redirect */
-        /* redirect to next hop */
-        DEBUG("ipv6: decrement hop limit to %u\n", (uint8_t) (hdr->hl - 1));
-
-        /* RFC 4291, section 2.5.6 states: "Routers must not forward any
-         * packets with Link-Local source or destination addresses to other
-         * links."
-         */
-        if ((ipv6_addr_is_link_local(&(hdr->src))) || (ipv6_addr_is_link_local(&(hdr->dst)))) {
-            DEBUG("ipv6: do not forward packets with link-local source or"
-                  " destination address\n");
-            gnrc_pktbuf_release(pkt);
-            return;
-        }
-        /* TODO: check if receiving interface is router */
-        else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
-            gnrc_pktsnip_t *reversed_pkt = NULL, *ptr = pkt;
-
-            DEBUG("ipv6: forward packet to next hop\n");
-
-            /* pkt might not be writable yet, if header was given above */
-            ipv6 = gnrc_pktbuf_start_write(ipv6);
-            if (ipv6 == NULL) {
-                DEBUG("ipv6: unable to get write access to packet: dropping it\n");
-                gnrc_pktbuf_release(pkt);
-                return;
-            }
-
-            /* remove L2 headers around IPV6 */
-            netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
-            if (netif != NULL) {
-                gnrc_pktbuf_remove_snip(pkt, netif);
-            }
-
-            /* reverse packet snip list order */
-            while (ptr != NULL) {
-                gnrc_pktsnip_t *next;
-                ptr = gnrc_pktbuf_start_write(ptr);     /* duplicate if not already done */
-                if (ptr == NULL) {
-                    DEBUG("ipv6: unable to get write access to packet: dropping it\n");
-                    gnrc_pktbuf_release(reversed_pkt);
-                    gnrc_pktbuf_release(pkt);
-                    return;
-                }
-                next = ptr->next;
-                ptr->next = reversed_pkt;
-                reversed_pkt = ptr;
-                ptr = next;
-            }
-            _send(reversed_pkt, false);
-            return;
-        }
-        else {
-            DEBUG("ipv6: hop limit reached 0: drop packet\n");
-            gnrc_pktbuf_release(pkt);
-            return;
-        }
-
+        _forward(pkt, hdr);
+        return;
 #else  /* MODULE_GNRC_IPV6_ROUTER */
         DEBUG("ipv6: dropping packet\n");
         /* non rounting hosts just drop the packet */
@@ -1029,8 +1151,14 @@ static void _decapsulate(gnrc_pktsnip_t *pkt)
     pkt->type = GNRC_NETTYPE_UNDEF; /* prevent payload (the encapsulated packet)
                                      * from being removed */
 
-    /* Remove encapsulating IPv6 header */
-    while ((ptr->next != NULL) && (ptr->next->type == GNRC_NETTYPE_IPV6)) {
+    /* Remove encapsulating IPv6 header and its extension headers, e.g. the
+     * Hop-by-Hop header of an MPL message */
+    while ((ptr->next != NULL) &&
+           ((ptr->next->type == GNRC_NETTYPE_IPV6)
+#ifdef MODULE_GNRC_IPV6_EXT
+            || (ptr->next->type == GNRC_NETTYPE_IPV6_EXT)
+#endif
+           )) {
         gnrc_pktbuf_remove_snip(pkt, pkt->next);
     }
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ipv6.h"
+#include "xtimer.h"
+
+#include "net/gnrc/ipv6/pmtu.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+typedef struct {
+    ipv6_addr_t dst;    /**< destination address */
+    uint32_t expires;   /**< expiry time in seconds (system time) */
+    uint16_t mtu;       /**< path MTU, 0 if entry is unused */
+} _pmtu_entry_t;
+
+static _pmtu_entry_t _cache[GNRC_IPV6_PMTU_CACHE_SIZE];
+static mutex_t _mutex = MUTEX_INIT;
+
+#if ENABLE_DEBUG
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+#endif
+
+static inline uint32_t _now_sec(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+}
+
+static inline bool _expired(const _pmtu_entry_t *entry, uint32_t now)
+{
+    return (int32_t)(entry->expires - now) <= 0;
+}
+
+/* returns entry for dst; expired entries are freed on the way */
+static _pmtu_entry_t *_get(const ipv6_addr_t *dst, uint32_t now)
+{
+    for (unsigned i = 0; i < GNRC_IPV6_PMTU_CACHE_SIZE; i++) {
+        _pmtu_entry_t *entry = &_cache[i];
+
+        if (entry->mtu == 0) {
+            continue;
+        }
+        if (_expired(entry, now)) {
+            DEBUG("ipv6 pmtu: entry for %s expired\n",
+                  ipv6_addr_to_str(addr_str, &entry->dst, sizeof(addr_str)));
+            entry->mtu = 0;
+            continue;
+        }
+        if (ipv6_addr_equal(&entry->dst, dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_ipv6_pmtu_update(const ipv6_addr_t *dst, uint32_t mtu)
+{
+    uint32_t now = _now_sec();
+    _pmtu_entry_t *entry;
+
+    if (mtu < IPV6_MIN_MTU) {
+        /* RFC 8201, section 4: such a Packet Too Big message must be
+         * discarded */
+        DEBUG("ipv6 pmtu: ignore MTU %" PRIu32 " below minimum\n", mtu);
+        return;
+    }
+    else if (mtu > UINT16_MAX) {
+        mtu = UINT16_MAX;
+    }
+    mutex_lock(&_mutex);
+    entry = _get(dst, now);
+    if (entry != NULL) {
+        if (mtu >= entry->mtu) {
+            /* RFC 8201, section 4: never increase estimate on Packet Too Big */
+            mutex_unlock(&_mutex);
+            return;
+        }
+    }
+    else {
+        entry = &_cache[0];
+        for (unsigned i = 0; i < GNRC_IPV6_PMTU_CACHE_SIZE; i++) {
+            if (_cache[i].mtu == 0) {
+                entry = &_cache[i];
+                break;
+            }
+            /* replace entry that expires first */
+            if ((int32_t)(_cache[i].expires - entry->expires) < 0) {
+                entry = &_cache[i];
+            }
+        }
+        memcpy(&entry->dst, dst, sizeof(entry->dst));
+    }
+    entry->mtu = (uint16_t)mtu;
+    entry->expires = now + GNRC_IPV6_PMTU_TIMEOUT;
+    DEBUG("ipv6 pmtu: set path MTU for %s to %u\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)), entry->mtu);
+    mutex_unlock(&_mutex);
+}
+
+uint16_t gnrc_ipv6_pmtu_get(const ipv6_addr_t *dst)
+{
+    _pmtu_entry_t *entry;
+    uint16_t mtu = 0;
+
+    mutex_lock(&_mutex);
+    entry = _get(dst, _now_sec());
+    if (entry != NULL) {
+        mtu = entry->mtu;
+    }
+    mutex_unlock(&_mutex);
+    return mtu;
+}
+
+void gnrc_ipv6_pmtu_del(const ipv6_addr_t *dst)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < GNRC_IPV6_PMTU_CACHE_SIZE; i++) {
+        if (ipv6_addr_equal(&_cache[i].dst, dst)) {
+            _cache[i].mtu = 0;
+        }
+    }
+    mutex_unlock(&_mutex);
+}
+
+void gnrc_ipv6_pmtu_flush(void)
+{
+    mutex_lock(&_mutex);
+    memset(_cache, 0, sizeof(_cache));
+    mutex_unlock(&_mutex);
+}
+
+/** @} */
@@ -10,24 +10,41 @@
  * @{
  *
  * @file
+ *
+ * Contexts are read on every packet but rarely changed. Changes are made with
+ * interrupts disabled and increment the version of the context buffer, so
+ * readers scan the buffer without locking and scan again if the version
+ * changed meanwhile.
  */
 
 #include <stdbool.h>
 #include <inttypes.h>
+#include <string.h>
 
-#include "mutex.h"
+#include "irq.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "xtimer.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#define LTIME_TICK      (60U * US_PER_SEC)  /**< lifetimes are in minutes */
+
+/**
+ * @brief   Prefix of a context in a form that is quick to compare
+ */
+typedef struct {
+    uint8_t bytes;      /**< number of bytes fully covered by the prefix */
+    uint8_t mask;       /**< mask for the remaining bits of the prefix */
+} _ctx_match_t;
+
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
-static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
-static mutex_t _ctx_mutex = MUTEX_INIT;
+static _ctx_match_t _ctx_matches[GNRC_SIXLOWPAN_CTX_SIZE];
+static volatile uint16_t _ctx_version;
+static xtimer_t _ltime_timer;
+static bool _ltime_timer_set;
 
-static uint32_t _current_minute(void);
-static void _update_lifetime(uint8_t id);
+static void _ltime_tick(void *arg);
 
 #if ENABLE_DEBUG
 static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
@@ -35,29 +52,43 @@ static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
 
 static inline bool _valid(uint8_t id)
 {
-    _update_lifetime(id);
     return (_ctxs[id].prefix_len > 0);
 }
 
-gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
+static inline bool _match(uint8_t id, const ipv6_addr_t *addr)
 {
-    uint8_t best = 0;
-    gnrc_sixlowpan_ctx_t *res = NULL;
+    const _ctx_match_t *match = &_ctx_matches[id];
 
-    mutex_lock(&_ctx_mutex);
+    return (memcmp(&_ctxs[id].prefix, addr, match->bytes) == 0) &&
+           ((match->mask == 0) ||
+            (((_ctxs[id].prefix.u8[match->bytes] ^ addr->u8[match->bytes]) &
+              match->mask) == 0));
+}
 
-    for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
-        if (_valid(id)) {
-            uint8_t match = ipv6_addr_match_prefix(&_ctxs[id].prefix, addr);
+static gnrc_sixlowpan_ctx_t *_lookup_addr(const ipv6_addr_t *addr)
+{
+    gnrc_sixlowpan_ctx_t *res = NULL;
 
-            if ((_ctxs[id].prefix_len <= match) && (match > best)) {
-                best = match;
-                res = &(_ctxs[id]);
-            }
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (_valid(id) && _match(id, addr) &&
+            ((res == NULL) || (_ctxs[id].prefix_len > res->prefix_len))) {
+            res = &(_ctxs[id]);
         }
     }
+    return res;
+}
+
+gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
+{
+    gnrc_sixlowpan_ctx_t *res;
+    uint16_t version;
 
-    mutex_unlock(&_ctx_mutex);
+    do {
+        version = _ctx_version;
+        __asm__ volatile ("" : : : "memory");
+        res = _lookup_addr(addr);
+        __asm__ volatile ("" : : : "memory");
+    } while (version != _ctx_version);
 
 #if ENABLE_DEBUG
     if (res != NULL) {
@@ -78,18 +109,13 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id(uint8_t id)
         return NULL;
     }
 
-    mutex_lock(&_ctx_mutex);
-
     if (_valid(id)) {
         DEBUG("6lo ctx: found context (%u, %s/%" PRIu8 ")\n", id,
               ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
               _ctxs[id].prefix_len);
-        mutex_unlock(&_ctx_mutex);
         return &(_ctxs[id]);
     }
 
-    mutex_unlock(&_ctx_mutex);
-
     return NULL;
 }
 
@@ -97,72 +123,105 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp)
 {
+    unsigned state;
+
     if ((id >= GNRC_SIXLOWPAN_CTX_SIZE) || (prefix_len == 0)) {
         return NULL;
     }
 
-    mutex_lock(&_ctx_mutex);
-
-    _ctxs[id].ltime = ltime;
+    if (prefix_len > IPV6_ADDR_BIT_LEN) {
+        prefix_len = IPV6_ADDR_BIT_LEN;
+    }
 
     if (ltime == 0) {
         comp = false;
     }
 
-    if (prefix_len > IPV6_ADDR_BIT_LEN) {
-        _ctxs[id].prefix_len = IPV6_ADDR_BIT_LEN;
-    }
-    else {
-        _ctxs[id].prefix_len = prefix_len;
-    }
+    state = irq_disable();
 
+    _ctxs[id].ltime = ltime;
+    _ctxs[id].prefix_len = prefix_len;
     _ctxs[id].flags_id = (comp) ? (GNRC_SIXLOWPAN_CTX_FLAGS_COMP | id) : id;
 
     if (!ipv6_addr_equal(&(_ctxs[id].prefix), prefix)) {
         ipv6_addr_set_unspecified(&(_ctxs[id].prefix));
-        ipv6_addr_init_prefix(&(_ctxs[id].prefix), prefix, _ctxs[id].prefix_len);
+        ipv6_addr_init_prefix(&(_ctxs[id].prefix), prefix, prefix_len);
+    }
+    _ctx_matches[id].bytes = prefix_len / 8;
+    _ctx_matches[id].mask = (uint8_t)(0xff00 >> (prefix_len % 8));
+    _ctx_version++;
+
+    if ((ltime > 0) && !_ltime_timer_set) {
+        _ltime_timer.callback = _ltime_tick;
+        xtimer_set(&_ltime_timer, LTIME_TICK);
+        _ltime_timer_set = true;
     }
+
+    irq_restore(state);
+
     DEBUG("6lo ctx: update context (%u, %s/%" PRIu8 "), lifetime: %" PRIu16 " min\n",
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
-    _ctx_inval_times[id] = ltime + _current_minute();
-
-    mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
-static uint32_t _current_minute(void)
-{
-    return xtimer_now_usec() / (US_PER_SEC * 60);
-}
-
-static void _update_lifetime(uint8_t id)
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
 {
-    uint32_t now;
+    unsigned state;
 
-    if (_ctxs[id].ltime == 0) {
-        _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
         return;
     }
 
-    now = _current_minute();
+    DEBUG("6lo ctx: remove context %u\n", id);
+    state = irq_disable();
+    _ctxs[id].prefix_len = 0;
+    _ctx_version++;
+    irq_restore(state);
+}
+
+uint16_t gnrc_sixlowpan_ctx_version(void)
+{
+    return _ctx_version;
+}
 
-    if (now >= _ctx_inval_times[id]) {
-        DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
-        _ctxs[id].ltime = 0;
-        _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+static void _ltime_tick(void *arg)
+{
+    bool running = false;
+
+    (void)arg;
+    /* called in interrupt context, so this does not interleave with readers
+     * or other updates */
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (!_valid(id) || (_ctxs[id].ltime == 0)) {
+            continue;
+        }
+        if (--_ctxs[id].ltime == 0) {
+            /* context may still be used for decompression */
+            _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+            _ctx_version++;
+        }
+        else {
+            running = true;
+        }
     }
-    else {
-        _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
+    if (running) {
+        xtimer_set(&_ltime_timer, LTIME_TICK);
     }
+    _ltime_timer_set = running;
 }
 
 #ifdef TEST_SUITES
-#include <string.h>
-
 void gnrc_sixlowpan_ctx_reset(void)
 {
+    unsigned state = irq_disable();
+
+    xtimer_remove(&_ltime_timer);
+    _ltime_timer_set = false;
     memset(_ctxs, 0, sizeof(_ctxs));
+    memset(_ctx_matches, 0, sizeof(_ctx_matches));
+    _ctx_version++;
+    irq_restore(state);
 }
 #endif
 
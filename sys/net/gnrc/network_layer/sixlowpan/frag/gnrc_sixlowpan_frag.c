@@ -24,8 +24,10 @@
 #include "net/gnrc/sixlowpan/netif.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
+#include "xtimer.h"
 
 #include "rbuf.h"
+#include "vrb.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -36,6 +38,18 @@
 #endif
 
 static uint16_t _tag;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+static gnrc_sixlowpan_frag_stats_t _stats;
+#endif
+/* schedules paced fragments and retries */
+static xtimer_t _pacing_timer;
+static msg_t _pacing_msg;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PACING
+static uint32_t _gap = GNRC_SIXLOWPAN_FRAG_GAP;
+#if GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE
+static uint32_t _tx_time;
+#endif
+#endif
 
 static inline uint16_t _floor8(uint16_t length)
 {
@@ -82,7 +96,8 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
 }
 
 static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t *pkt,
-                                   size_t payload_len, size_t datagram_size)
+                                   size_t payload_len, size_t datagram_size,
+                                   uint16_t tag)
 {
     gnrc_pktsnip_t *frag;
     uint16_t local_offset = 0;
@@ -110,7 +125,7 @@ static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
 
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
-    hdr->tag = byteorder_htons(_tag);
+    hdr->tag = byteorder_htons(tag);
 
     pkt = pkt->next;    /* don't copy netif header */
 
@@ -129,10 +144,11 @@ static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
 
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
-          (unsigned int)datagram_size, _tag, local_offset);
+          (unsigned int)datagram_size, tag, local_offset);
     if (gnrc_netapi_send(iface->pid, frag) < 1) {
         DEBUG("6lo frag: unable to send first fragment\n");
         gnrc_pktbuf_release(frag);
+        return 0;
     }
 
     return local_offset;
@@ -140,7 +156,7 @@ static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
 
 static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t *pkt,
                                    size_t payload_len, size_t datagram_size,
-                                   uint16_t offset)
+                                   uint16_t offset, uint16_t tag)
 {
     gnrc_pktsnip_t *frag;
     /* since dispatches aren't supposed to go into subsequent fragments, we need not account
@@ -166,7 +182,7 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     /* XXX: truncation of datagram_size > 4095 may happen here */
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
-    hdr->tag = byteorder_htons(_tag);
+    hdr->tag = byteorder_htons(tag);
     /* don't mention payload diff in offset */
     hdr->offset = (uint8_t)((offset + (datagram_size - payload_len)) >> 3);
     pkt = pkt->next;    /* don't copy netif header */
@@ -206,16 +222,87 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     DEBUG("6lo frag: send subsequent fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", offset: %" PRIu8 " (%u bytes), "
           "fragment size: %" PRIu16 ")\n",
-          (unsigned int)datagram_size, _tag, hdr->offset, hdr->offset << 3,
+          (unsigned int)datagram_size, tag, hdr->offset, hdr->offset << 3,
           local_offset);
     if (gnrc_netapi_send(iface->pid, frag) < 1) {
         DEBUG("6lo frag: unable to send subsequent fragment\n");
         gnrc_pktbuf_release(frag);
+        return 0;
     }
 
     return local_offset;
 }
 
+uint16_t gnrc_sixlowpan_frag_next_tag(void)
+{
+    /* increment tag for successive, fragmented datagrams */
+    return ++_tag;
+}
+
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_PACING) && GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE
+static void _adapt_gap(kernel_pid_t pid, uint32_t start)
+{
+    uint32_t sample;
+    uint8_t retries = 0;
+
+    /* the interface handles its messages in order, so this returns after the
+     * fragment was sent */
+    if (gnrc_netapi_get(pid, NETOPT_TX_RETRIES_NEEDED, 0, &retries,
+                        sizeof(retries)) < 0) {
+        retries = 0;
+    }
+    sample = xtimer_now_usec() - start;
+    /* smooth like TCP's RTT estimation with a gain of 1/8 */
+    _tx_time = (_tx_time == 0) ? sample : (_tx_time - (_tx_time >> 3) +
+                                           (sample >> 3));
+    _gap = _tx_time * GNRC_SIXLOWPAN_FRAG_PACING_FACTOR * (retries + 1U);
+    if (_gap < GNRC_SIXLOWPAN_FRAG_GAP) {
+        _gap = GNRC_SIXLOWPAN_FRAG_GAP;
+    }
+    else if (_gap > GNRC_SIXLOWPAN_FRAG_GAP_MAX) {
+        _gap = GNRC_SIXLOWPAN_FRAG_GAP_MAX;
+    }
+    DEBUG("6lo frag: send time %" PRIu32 " us (smoothed %" PRIu32 " us), "
+          "%u retries => gap %" PRIu32 " us\n", sample, _tx_time,
+          (unsigned)retries, _gap);
+}
+#endif
+
+static void _schedule(gnrc_sixlowpan_msg_frag_t *fragment_msg, uint32_t delay)
+{
+    _pacing_msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    _pacing_msg.content.ptr = fragment_msg;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    _stats.pacing_delay += delay;
+#endif
+    xtimer_set_msg(&_pacing_timer, delay, &_pacing_msg, sched_active_pid);
+}
+
+static void _schedule_retry(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+    /* the interface or the packet buffer is busy: back off linearly */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PACING
+    _schedule(fragment_msg, _gap * fragment_msg->retries);
+#else
+    _schedule(fragment_msg, GNRC_SIXLOWPAN_FRAG_GAP * fragment_msg->retries);
+#endif
+}
+
+static void _schedule_next(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PACING
+    _schedule(fragment_msg, _gap);
+#else
+    msg_t msg;
+
+    /* send message to self*/
+    msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    msg.content.ptr = (void *)fragment_msg;
+    msg_send_to_self(&msg);
+    thread_yield();
+#endif
+}
+
 void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
 {
     gnrc_sixlowpan_netif_t *iface = gnrc_sixlowpan_netif_get(fragment_msg->pid);
@@ -223,7 +310,9 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     size_t payload_len = gnrc_pkt_len(fragment_msg->pkt->next);
-    msg_t msg;
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_PACING) && GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE
+    uint32_t start = xtimer_now_usec();
+#endif
 
 #if defined(DEVELHELP) && defined(ENABLE_DEBUG)
     if (iface == NULL) {
@@ -238,48 +327,53 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
 
     /* Check weater to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
-        /* increment tag for successive, fragmented datagrams */
-        _tag++;
-        if ((res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len, fragment_msg->datagram_size)) == 0) {
-            /* error sending first fragment */
-            DEBUG("6lo frag: error sending 1st fragment\n");
-            gnrc_pktbuf_release(fragment_msg->pkt);
-            fragment_msg->pkt = NULL;
-            return;
+        if (fragment_msg->retries == 0) {
+            fragment_msg->tag = gnrc_sixlowpan_frag_next_tag();
         }
-        fragment_msg->offset += res;
-
-        /* send message to self*/
-        msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-        msg.content.ptr = (void *)fragment_msg;
-        msg_send_to_self(&msg);
-        thread_yield();
+        res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len,
+                                 fragment_msg->datagram_size, fragment_msg->tag);
+    }
+    /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
+    else if (fragment_msg->offset < payload_len) {
+        res = _send_nth_fragment(iface, fragment_msg->pkt, payload_len,
+                                 fragment_msg->datagram_size,
+                                 fragment_msg->offset, fragment_msg->tag);
     }
     else {
-        /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
-        if (fragment_msg->offset < payload_len) {
-            if ((res = _send_nth_fragment(iface, fragment_msg->pkt, payload_len, fragment_msg->datagram_size,
-                                          fragment_msg->offset)) == 0) {
-                /* error sending subsequent fragment */
-                DEBUG("6lo frag: error sending subsequent fragment (offset = %" PRIu16
-                      ")\n", fragment_msg->offset);
-                gnrc_pktbuf_release(fragment_msg->pkt);
-                fragment_msg->pkt = NULL;
-                return;
-                }
-            fragment_msg->offset += res;
-
-            /* send message to self*/
-            msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-            msg.content.ptr = (void *)fragment_msg;
-            msg_send_to_self(&msg);
-            thread_yield();
-        }
-        else {
-            gnrc_pktbuf_release(fragment_msg->pkt);
-            fragment_msg->pkt = NULL;
+        /* all fragments sent; with pacing this also waited for the gap after
+         * the last fragment, so the next datagram does not follow it
+         * back-to-back */
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+        return;
+    }
+
+    if (res == 0) {
+        if (fragment_msg->retries < GNRC_SIXLOWPAN_FRAG_RETRIES) {
+            DEBUG("6lo frag: retry fragment (offset = %" PRIu16 ")\n",
+                  fragment_msg->offset);
+            fragment_msg->retries++;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+            _stats.frag_retries++;
+#endif
+            _schedule_retry(fragment_msg);
+            return;
         }
+        DEBUG("6lo frag: error sending fragment (offset = %" PRIu16 ")\n",
+              fragment_msg->offset);
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+        return;
     }
+    fragment_msg->offset += res;
+    fragment_msg->retries = 0;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    _stats.frags_sent++;
+#endif
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_PACING) && GNRC_SIXLOWPAN_FRAG_PACING_ADAPTIVE
+    _adapt_gap(fragment_msg->pid, start);
+#endif
+    _schedule_next(fragment_msg);
 }
 
 void gnrc_sixlowpan_frag_handle_pkt(gnrc_pktsnip_t *pkt)
@@ -306,9 +400,22 @@ void gnrc_sixlowpan_frag_handle_pkt(gnrc_pktsnip_t *pkt)
             return;
     }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    if (vrb_forward(hdr, pkt, frag_size, offset)) {
+        return;
+    }
+#endif
+
     rbuf_add(hdr, pkt, frag_size, offset);
 
     gnrc_pktbuf_release(pkt);
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void)
+{
+    return &_stats;
+}
+#endif
+
 /** @} */
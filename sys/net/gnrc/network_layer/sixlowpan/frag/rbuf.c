@@ -29,39 +29,39 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
-#endif
-
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(GNRC_IPV6_NETIF_DEFAULT_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * RBUF_SIZE)
-#endif
-
-static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
+#define RBUF_FRAG_NEW       (0)     /**< fragment not received before */
+#define RBUF_FRAG_DUP       (1)     /**< fragment received before */
+#define RBUF_FRAG_OVERLAP   (-1)    /**< fragment overlaps partially */
 
 static rbuf_t rbuf[RBUF_SIZE];
+static rbuf_t *_buckets[RBUF_HASH_SIZE];
+static rbuf_t *_free;
+static rbuf_t *_exp_queue;   /* oldest entry first */
 
 #if ENABLE_DEBUG
 static char l2addr_str[3 * RBUF_L2ADDR_MAX_LEN];
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#define _STATS_INC(field)   (gnrc_sixlowpan_frag_stats_get()->field++)
+#else
+#define _STATS_INC(field)
+#endif
+
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static rbuf_int_t *_rbuf_int_get_free(void);
+/* checks and marks the units of a fragment in the entry's bitmap */
+static int _rbuf_update_units(rbuf_t *entry, uint16_t offset, size_t frag_size);
 /* remove entry from reassembly buffer */
 static void _rbuf_rem(rbuf_t *entry);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
-/* checks timeouts and removes entries if necessary (oldest if full) */
+/* releases the packet of an entry and removes the entry */
+static inline void _rbuf_drop(rbuf_t *entry)
+{
+    gnrc_pktbuf_release(entry->pkt);
+    _rbuf_rem(entry);
+}
+/* removes timed out entries from the front of the expiry queue */
 static void _rbuf_gc(void);
 /* gets an entry identified by its tupel */
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
@@ -77,9 +77,12 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     unsigned int data_offset = 0;
     size_t original_size = frag_size;
     sixlowpan_frag_t *frag = pkt->data;
-    rbuf_int_t *ptr;
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
 
+    if ((frag_size == 0) || (frag_size > pkt->size)) {
+        DEBUG("6lo rbuf: fragment without payload, ignoring\n");
+        return;
+    }
     _rbuf_gc();
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
@@ -91,8 +94,6 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return;
     }
 
-    ptr = entry->ints;
-
     /* dispatches in the first fragment are ignored */
     if (offset == 0) {
         if (data[0] == SIXLOWPAN_UNCOMP) {
@@ -106,8 +107,8 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                                                   sizeof(sixlowpan_frag_t), &nh_len);
             if (iphc_len == 0) {
                 DEBUG("6lo rfrag: could not decode IPHC dispatch\n");
-                gnrc_pktbuf_release(entry->pkt);
-                _rbuf_rem(entry);
+                _STATS_INC(discarded);
+                _rbuf_drop(entry);
                 return;
             }
             data += iphc_len;       /* take remaining data as data */
@@ -123,48 +124,52 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         data++; /* FRAGN header is one byte longer (offset) */
     }
 
-    if ((offset + frag_size) > entry->pkt->size) {
+    if (frag_size == 0) {
+        /* a first fragment with nothing but a dispatch marks no unit */
+        DEBUG("6lo rbuf: fragment without payload, ignoring\n");
+        return;
+    }
+
+    if ((offset + frag_size) > entry->dgram_size) {
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
-        gnrc_pktbuf_release(entry->pkt);
-        _rbuf_rem(entry);
+        _STATS_INC(discarded);
+        _rbuf_drop(entry);
         return;
     }
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-            DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
-            gnrc_pktbuf_release(entry->pkt);
-            _rbuf_rem(entry);
+    switch (_rbuf_update_units(entry, offset, frag_size)) {
+        case RBUF_FRAG_NEW:
+            DEBUG("6lo rbuf: add fragment data\n");
+            entry->cur_size += (uint16_t)frag_size;
+            memcpy(((uint8_t *)entry->pkt->data) + offset + data_offset, data,
+                   frag_size - data_offset);
+            break;
+        case RBUF_FRAG_DUP:
+            DEBUG("6lo rbuf: fragment already received\n");
+            return;
+        default:
+            /* If the fragment overlaps another fragment and differs in either
+             * the size or the offset of the overlapped fragment, discards the
+             * datagram https://tools.ietf.org/html/rfc4944#section-5.3 */
+            DEBUG("6lo rfrag: overlapping fragments, discarding datagram\n");
+            _STATS_INC(discarded);
+            _rbuf_drop(entry);
 
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
              * https://tools.ietf.org/html/rfc4944#section-5.3 */
             rbuf_add(netif_hdr, pkt, original_size, offset);
-
             return;
-        }
-
-        ptr = ptr->next;
-    }
-
-    if (_rbuf_update_ints(entry, offset, frag_size)) {
-        DEBUG("6lo rbuf: add fragment data\n");
-        entry->cur_size += (uint16_t)frag_size;
-        memcpy(((uint8_t *)entry->pkt->data) + offset + data_offset, data,
-               frag_size - data_offset);
     }
 
-    if (entry->cur_size == entry->pkt->size) {
+    if (entry->cur_size == entry->dgram_size) {
         gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(entry->src, entry->src_len,
                                                      entry->dst, entry->dst_len);
 
         if (netif == NULL) {
             DEBUG("6lo rbuf: error allocating netif header\n");
-            gnrc_pktbuf_release(entry->pkt);
-            _rbuf_rem(entry);
+            _STATS_INC(discarded);
+            _rbuf_drop(entry);
             return;
         }
 
@@ -178,6 +183,7 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         new_netif_hdr->lqi = netif_hdr->lqi;
         new_netif_hdr->rssi = netif_hdr->rssi;
         LL_APPEND(entry->pkt, netif);
+        _STATS_INC(datagrams);
 
         if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL,
                                           entry->pkt)) {
@@ -189,84 +195,85 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     }
 }
 
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end)
+static int _rbuf_update_units(rbuf_t *entry, uint16_t offset, size_t frag_size)
 {
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
+    /* rbuf_add() only passes non-empty fragments within the datagram */
+    assert((frag_size > 0) && ((offset + frag_size) <= RBUF_MAX_DGRAM_SIZE));
 
-static rbuf_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
+    const unsigned first = offset / RBUF_UNIT_SIZE;
+    const unsigned last = (offset + frag_size - 1) / RBUF_UNIT_SIZE;
+    unsigned received = 0;
+
+    for (unsigned i = first; i <= last; i++) {
+        if (bf_isset(entry->received, i)) {
+            received++;
         }
     }
-
-    return NULL;
+    if (received == (last - first + 1)) {
+        return RBUF_FRAG_DUP;
+    }
+    if (received > 0) {
+        return RBUF_FRAG_OVERLAP;
+    }
+    for (unsigned i = first; i <= last; i++) {
+        bf_set(entry->received, i);
+    }
+    DEBUG("6lo rfrag: add units [%u, %u] to entry (%s, ", first, last,
+          gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), entry->src,
+                                 entry->src_len));
+    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(l2addr_str,
+            sizeof(l2addr_str), entry->dst, entry->dst_len),
+          (unsigned)entry->dgram_size, entry->tag);
+    return RBUF_FRAG_NEW;
 }
 
-static void _rbuf_rem(rbuf_t *entry)
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len,
+                           size_t size, uint16_t tag)
 {
-    while (entry->ints != NULL) {
-        rbuf_int_t *next = entry->ints->next;
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
     }
-
-    entry->pkt = NULL;
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    hash = (hash ^ (size & 0xff)) * 16777619U;
+    hash = (hash ^ (size >> 8)) * 16777619U;
+    return hash % RBUF_HASH_SIZE;
 }
 
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
+static void _rbuf_rem(rbuf_t *entry)
 {
-    rbuf_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
-    new = _rbuf_int_get_free();
-
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
-    }
-
-    new->start = offset;
-    new->end = end;
+    rbuf_t **bucket = &_buckets[_rbuf_hash(entry->src, entry->src_len,
+                                           entry->dst, entry->dst_len,
+                                           entry->dgram_size, entry->tag)];
 
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(l2addr_str,
-                  sizeof(l2addr_str), entry->src, entry->src_len));
-    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(l2addr_str,
-            sizeof(l2addr_str), entry->dst, entry->dst_len),
-          (unsigned)entry->pkt->size, entry->tag);
-
-    LL_PREPEND(entry->ints, new);
-
-    return true;
+    LL_DELETE(*bucket, entry);
+    DL_DELETE2(_exp_queue, entry, exp_prev, exp_next);
+    entry->pkt = NULL;
+    LL_PREPEND(_free, entry);
 }
 
 static void _rbuf_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
-
-    for (i = 0; i < RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].pkt != NULL) &&
-              ((now_usec - rbuf[i].arrival) > RBUF_TIMEOUT)) {
-            DEBUG("6lo rfrag: entry (%s, ", gnrc_netif_addr_to_str(l2addr_str,
-                    sizeof(l2addr_str), rbuf[i].src, rbuf[i].src_len));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), rbuf[i].dst,
-                                         rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
-
-            gnrc_pktbuf_release(rbuf[i].pkt);
-            _rbuf_rem(&(rbuf[i]));
-        }
+
+    /* since pkt occupies pktbuf, aggressivly collect garbage */
+    while ((_exp_queue != NULL) &&
+           ((now_usec - _exp_queue->arrival) > RBUF_TIMEOUT)) {
+        DEBUG("6lo rfrag: entry (%s, ", gnrc_netif_addr_to_str(l2addr_str,
+                sizeof(l2addr_str), _exp_queue->src, _exp_queue->src_len));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
+                                     _exp_queue->dst, _exp_queue->dst_len),
+              (unsigned)_exp_queue->dgram_size, _exp_queue->tag);
+        _STATS_INC(expired);
+        _rbuf_drop(_exp_queue);
     }
 }
 
@@ -274,56 +281,65 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          const void *dst, size_t dst_len,
                          size_t size, uint16_t tag)
 {
-    rbuf_t *res = NULL, *oldest = NULL;
+    static bool initialized = false;
+    rbuf_t *res;
     uint32_t now_usec = xtimer_now_usec();
+    rbuf_t **bucket = &_buckets[_rbuf_hash(src, src_len, dst, dst_len, size,
+                                           tag)];
+
+    if (!initialized) {
+        for (unsigned i = 0; i < RBUF_SIZE; i++) {
+            LL_PREPEND(_free, &rbuf[i]);
+        }
+        initialized = true;
+    }
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+    LL_FOREACH(*bucket, res) {
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].pkt->size == size) &&
-            (rbuf[i].tag == tag) && (rbuf[i].src_len == src_len) &&
-            (rbuf[i].dst_len == dst_len) &&
-            (memcmp(rbuf[i].src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
+        if ((res->dgram_size == size) && (res->tag == tag) &&
+            (res->src_len == src_len) && (res->dst_len == dst_len) &&
+            (memcmp(res->src, src, src_len) == 0) &&
+            (memcmp(res->dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].src, rbuf[i].src_len));
+                                         res->src, res->src_len));
             DEBUG("%s, %u, %u) found\n",
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].dst, rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
-            rbuf[i].arrival = now_usec;
-            return &(rbuf[i]);
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && (rbuf[i].pkt == NULL)) {
-            res = &(rbuf[i]);
+                                         res->dst, res->dst_len),
+                  (unsigned)res->dgram_size, res->tag);
+            res->arrival = now_usec;
+            /* move to the end of the expiry queue */
+            DL_DELETE2(_exp_queue, res, exp_prev, exp_next);
+            DL_APPEND2(_exp_queue, res, exp_prev, exp_next);
+            return res;
         }
+    }
 
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
-        }
+    if ((size > RBUF_MAX_DGRAM_SIZE) || (src_len > RBUF_L2ADDR_MAX_LEN) ||
+        (dst_len > RBUF_L2ADDR_MAX_LEN)) {
+        DEBUG("6lo rfrag: can not reassemble datagram of size %u\n",
+              (unsigned)size);
+        _STATS_INC(discarded);
+        return NULL;
     }
 
     /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
-        assert(oldest != NULL);
-        assert(oldest->pkt != NULL); /* if oldest->pkt == NULL, res must not be NULL */
+    if (_free == NULL) {
+        assert(_exp_queue != NULL);
         DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-        gnrc_pktbuf_release(oldest->pkt);
-        _rbuf_rem(oldest);
-        res = oldest;
+        _STATS_INC(rbuf_full);
+        _rbuf_drop(_exp_queue);
     }
 
     /* now we have an empty spot */
-
+    res = _free;
     res->pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_IPV6);
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        _STATS_INC(discarded);
         return NULL;
     }
+    LL_DELETE(_free, res);
 
     *((uint64_t *)res->pkt->data) = 0;  /* clean first few bytes for later
                                          * look-ups */
@@ -332,18 +348,36 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     memcpy(res->dst, dst, dst_len);
     res->src_len = src_len;
     res->dst_len = dst_len;
+    res->dgram_size = size;
     res->tag = tag;
     res->cur_size = 0;
+    memset(res->received, 0, sizeof(res->received));
+    LL_PREPEND(*bucket, res);
+    DL_APPEND2(_exp_queue, res, exp_prev, exp_next);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), res->src,
                                  res->src_len));
     DEBUG("%s, %u, %u) created\n",
           gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), res->dst,
-                                 res->dst_len), (unsigned)res->pkt->size,
+                                 res->dst_len), (unsigned)res->dgram_size,
           res->tag);
 
     return res;
 }
 
+#ifdef TEST_SUITES
+void rbuf_reset(void)
+{
+    while (_exp_queue != NULL) {
+        _rbuf_drop(_exp_queue);
+    }
+}
+
+const rbuf_t *rbuf_array(void)
+{
+    return rbuf;
+}
+#endif
+
 /** @} */
@@ -21,6 +21,7 @@
 
 #include <inttypes.h>
 
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 
@@ -30,27 +31,36 @@
 extern "C" {
 #endif
 
-#define RBUF_L2ADDR_MAX_LEN (8U)               /**< maximum length for link-layer addresses */
-#define RBUF_SIZE           (4U)               /**< size of the reassembly buffer */
-#define RBUF_TIMEOUT        (3U * US_PER_SEC) /**< timeout for reassembly in microseconds */
+#define RBUF_L2ADDR_MAX_LEN (8U)                /**< maximum length for link-layer addresses */
+#define RBUF_SIZE           (GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)    /**< size of the reassembly buffer */
+#define RBUF_TIMEOUT        (GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT) /**< timeout for reassembly in microseconds */
 
 /**
- * @brief   Fragment intervals to identify limits of fragments.
- *
- * @note    Fragments MUST NOT overlap and overlapping fragments are to be
- *          discarded
- *
- * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
- *          RFC 4944, section 5.3
- *      </a>
+ * @brief   Number of hash buckets of the reassembly buffer
+ */
+#ifndef RBUF_HASH_SIZE
+#define RBUF_HASH_SIZE      (RBUF_SIZE)
+#endif
+
+/**
+ * @brief   Maximum size of a datagram that can be reassembled
+ */
+#ifndef RBUF_MAX_DGRAM_SIZE
+#define RBUF_MAX_DGRAM_SIZE (1280U)
+#endif
+
+/**
+ * @brief   Size of the units the received part of a datagram is tracked in
  *
- * @internal
+ * Fragment offsets are given in units of 8 bytes and all but the last fragment
+ * must have a multiple of 8 bytes as payload (RFC 4944, section 5.3).
+ */
+#define RBUF_UNIT_SIZE      (8U)
+
+/**
+ * @brief   Number of units of a datagram of @ref RBUF_MAX_DGRAM_SIZE
  */
-typedef struct rbuf_int {
-    struct rbuf_int *next;  /**< next element in interval list */
-    uint16_t start;         /**< start byte of interval */
-    uint16_t end;           /**< end byte of interval */
-} rbuf_int_t;
+#define RBUF_UNITS          ((RBUF_MAX_DGRAM_SIZE + RBUF_UNIT_SIZE - 1) / RBUF_UNIT_SIZE)
 
 /**
  * @brief   An entry in the 6LoWPAN reassembly buffer.
@@ -59,19 +69,26 @@ typedef struct rbuf_int {
  *
  * 1. the source address,
  * 2. the destination address,
- * 3. the datagram size (gnrc_pktsnip_t::size of rbuf_t::pkt), and
+ * 3. the datagram size (rbuf_t::dgram_size), and
  * 4. the datagram tag
  *
  * to identify all fragments that belong to the given datagram.
  *
+ * Entries are looked up by a hash over these four values. Unused entries and
+ * entries of the same hash bucket are chained via rbuf_t::next, all used
+ * entries are additionally kept in an expiry queue ordered by the arrival of
+ * their latest fragment.
+ *
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
  *
  * @internal
  */
-typedef struct {
-    rbuf_int_t *ints;                   /**< intervals of the fragment */
+typedef struct rbuf {
+    struct rbuf *next;                  /**< next entry in hash bucket or free list */
+    struct rbuf *exp_prev;              /**< previous entry in expiry queue */
+    struct rbuf *exp_next;              /**< next entry in expiry queue */
     gnrc_pktsnip_t *pkt;                /**< the reassembled packet in packet buffer */
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
@@ -80,7 +97,13 @@ typedef struct {
     uint8_t src_len;                    /**< length of source address */
     uint8_t dst_len;                    /**< length of destination address */
     uint16_t tag;                       /**< the datagram's tag */
+    uint16_t dgram_size;                /**< the datagram's size, kept apart from
+                                         *   rbuf_t::pkt since the entry is
+                                         *   removed after its packet was
+                                         *   released or dispatched */
     uint16_t cur_size;                  /**< the datagram's current size */
+    BITFIELD(received, RBUF_UNITS);     /**< units of @ref RBUF_UNIT_SIZE
+                                         *   bytes received so far */
 } rbuf_t;
 
 /**
@@ -92,7 +115,8 @@ typedef struct {
  *                          gnrc_netif_hdr_t::if_pid and its source and
  *                          destination address set.
  * @param[in] frag          The fragment to add.
- * @param[in] frag_size     The fragment's size.
+ * @param[in] frag_size     The fragment's size. Fragments without payload
+ *                          are ignored.
  * @param[in] offset        The fragment's offset.
  *
  * @internal
@@ -100,6 +124,30 @@ typedef struct {
 void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
               size_t frag_size, size_t offset);
 
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Removes all entries from the reassembly buffer and releases their
+ *          packets
+ *
+ * @note    Only available with `TEST_SUITES` defined.
+ *
+ * @internal
+ */
+void rbuf_reset(void);
+
+/**
+ * @brief   Gets the entries of the reassembly buffer
+ *
+ * @note    Only available with `TEST_SUITES` defined.
+ *
+ * @return  The @ref RBUF_SIZE entries of the reassembly buffer. Unused
+ *          entries have rbuf_t::pkt set to NULL.
+ *
+ * @internal
+ */
+const rbuf_t *rbuf_array(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
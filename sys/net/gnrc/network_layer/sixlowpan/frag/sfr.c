@@ -0,0 +1,565 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "byteorder.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/netif.h"
+#include "net/sixlowpan.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "rbuf.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+
+#define SFR_BITMAP_FULL     (0xffffffffU)
+
+/* bitmaps are kept in RFRAG-ACK order: the MSB stands for sequence number 0 */
+#define SFR_BIT(seq)        (0x80000000U >> (seq))
+
+/* bits of the sequence numbers 0 to frags - 1 */
+static inline uint32_t _frags_mask(uint8_t frags)
+{
+    /* shifting by the full width of the bitmap would be undefined */
+    return (frags == 0) ? 0 : (SFR_BITMAP_FULL << (SIXLOWPAN_SFR_ACK_BITMAP_SIZE - frags));
+}
+
+typedef struct {
+    uint8_t l2addr[RBUF_L2ADDR_MAX_LEN];
+    uint8_t l2addr_len;
+} _sfr_peer_t;
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;        /* netif header and compressed datagram */
+    xtimer_t timer;
+    msg_t timer_msg;
+    uint32_t to_send;           /* fragments to send in the current round */
+    uint16_t size;              /* size of the compressed datagram */
+    uint16_t frag_size;         /* payload size of all but the last fragment */
+    uint8_t frags;              /* number of fragments */
+    uint8_t tag;
+    uint8_t retries;
+} _sfr_tx_t;
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;        /* compressed datagram */
+    uint32_t arrival;
+    uint32_t received;          /* received fragments */
+    BITFIELD(covered, RBUF_MAX_DGRAM_SIZE); /* received bytes, overlapping
+                                             * fragments are only counted
+                                             * once */
+    uint8_t src[RBUF_L2ADDR_MAX_LEN];
+    uint8_t dst[RBUF_L2ADDR_MAX_LEN];
+    uint8_t src_len;            /* 0 for unused entries */
+    uint8_t dst_len;
+    uint8_t tag;
+    bool done;                  /* datagram was completed, kept to answer
+                                 * retransmitted acknowledgment requests */
+    uint16_t size;              /* size of the compressed datagram, 0 if
+                                 * not known yet */
+    uint16_t cur_size;
+} _sfr_rx_t;
+
+static mutex_t _peers_mutex = MUTEX_INIT;
+static _sfr_peer_t _peers[GNRC_SIXLOWPAN_SFR_PEERS_NUMOF];
+static unsigned _peers_next;
+static _sfr_tx_t _tx;
+static _sfr_rx_t _rx[GNRC_SIXLOWPAN_SFR_RBUF_SIZE];
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#define _STATS_INC(field)   (gnrc_sixlowpan_frag_stats_get()->field++)
+#else
+#define _STATS_INC(field)
+#endif
+
+static bool _peer_supports_sfr(const uint8_t *l2addr, size_t l2addr_len)
+{
+    bool res = false;
+
+    mutex_lock(&_peers_mutex);
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_SFR_PEERS_NUMOF; i++) {
+        if ((_peers[i].l2addr_len == l2addr_len) && (l2addr_len > 0) &&
+            (memcmp(_peers[i].l2addr, l2addr, l2addr_len) == 0)) {
+            res = true;
+            break;
+        }
+    }
+    mutex_unlock(&_peers_mutex);
+    return res;
+}
+
+int gnrc_sixlowpan_frag_sfr_peer_add(const uint8_t *l2addr, size_t l2addr_len)
+{
+    if ((l2addr_len == 0) || (l2addr_len > RBUF_L2ADDR_MAX_LEN)) {
+        return -EINVAL;
+    }
+    if (_peer_supports_sfr(l2addr, l2addr_len)) {
+        return 0;
+    }
+    mutex_lock(&_peers_mutex);
+    memcpy(_peers[_peers_next].l2addr, l2addr, l2addr_len);
+    _peers[_peers_next].l2addr_len = l2addr_len;
+    _peers_next = (_peers_next + 1) % GNRC_SIXLOWPAN_SFR_PEERS_NUMOF;
+    mutex_unlock(&_peers_mutex);
+    return 0;
+}
+
+/* sending */
+static void _tx_finish(void)
+{
+    xtimer_remove(&_tx.timer);
+    gnrc_pktbuf_release(_tx.pkt);
+    _tx.pkt = NULL;
+}
+
+static void _copy_from_pkt(gnrc_pktsnip_t *pkt, size_t offset, uint8_t *data,
+                           size_t len)
+{
+    while ((pkt != NULL) && (len > 0)) {
+        if (offset < pkt->size) {
+            size_t clen = ((pkt->size - offset) < len) ? (pkt->size - offset) : len;
+
+            memcpy(data, ((uint8_t *)pkt->data) + offset, clen);
+            data += clen;
+            len -= clen;
+            offset = 0;
+        }
+        else {
+            offset -= pkt->size;
+        }
+        pkt = pkt->next;
+    }
+}
+
+static void _send_rfrag(uint8_t seq, bool ack_req)
+{
+    gnrc_netif_hdr_t *hdr = _tx.pkt->data;
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_sfr_rfrag_t *rfrag;
+    size_t offset = seq * _tx.frag_size;
+    size_t len = ((_tx.size - offset) < _tx.frag_size) ? (_tx.size - offset)
+                                                          : _tx.frag_size;
+
+    netif = gnrc_netif_hdr_build(gnrc_netif_hdr_get_src_addr(hdr),
+                                 hdr->src_l2addr_len,
+                                 gnrc_netif_hdr_get_dst_addr(hdr),
+                                 hdr->dst_l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating netif header\n");
+        return;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = hdr->if_pid;
+    ((gnrc_netif_hdr_t *)netif->data)->flags = hdr->flags;
+    frag = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_rfrag_t) + len,
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: error allocating fragment\n");
+        gnrc_pktbuf_release(netif);
+        return;
+    }
+    netif->next = frag;
+    rfrag = frag->data;
+    rfrag->disp_ecn = SIXLOWPAN_SFR_RFRAG_DISP;
+    rfrag->tag = _tx.tag;
+    rfrag->ar_seq_fs = byteorder_htons((ack_req ? SIXLOWPAN_SFR_ACK_REQ : 0) |
+                                       (seq << SIXLOWPAN_SFR_SEQ_POS) |
+                                       (uint16_t)len);
+    /* the first fragment carries the datagram size instead of its offset */
+    rfrag->offset = byteorder_htons((seq == 0) ? _tx.size : (uint16_t)offset);
+    _copy_from_pkt(_tx.pkt->next, offset, (uint8_t *)(rfrag + 1), len);
+    DEBUG("6lo sfr: send fragment %u of datagram %u (size: %u, ack: %u)\n",
+          seq, _tx.tag, (unsigned)len, ack_req);
+    if (gnrc_netapi_send(hdr->if_pid, netif) < 1) {
+        DEBUG("6lo sfr: unable to send fragment\n");
+        gnrc_pktbuf_release(netif);
+    }
+}
+
+bool gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->data;
+    gnrc_sixlowpan_netif_t *iface = gnrc_sixlowpan_netif_get(hdr->if_pid);
+    size_t size = gnrc_pkt_len(pkt->next);
+    size_t frag_size;
+    msg_t msg;
+
+    if ((_tx.pkt != NULL) || (iface == NULL) ||
+        (iface->max_frag_size <= sizeof(sixlowpan_sfr_rfrag_t)) ||
+        !_peer_supports_sfr(gnrc_netif_hdr_get_dst_addr(hdr),
+                            hdr->dst_l2addr_len)) {
+        return false;
+    }
+    frag_size = iface->max_frag_size - sizeof(sixlowpan_sfr_rfrag_t);
+    if (frag_size > SIXLOWPAN_SFR_FRAG_SIZE_MASK) {
+        frag_size = SIXLOWPAN_SFR_FRAG_SIZE_MASK;
+    }
+    if ((size == 0) || (size > UINT16_MAX) ||
+        (((size + frag_size - 1) / frag_size) > SIXLOWPAN_SFR_ACK_BITMAP_SIZE)) {
+        return false;
+    }
+    _tx.pkt = pkt;
+    _tx.size = size;
+    _tx.frag_size = frag_size;
+    _tx.frags = (size + frag_size - 1) / frag_size;
+    _tx.tag = (uint8_t)gnrc_sixlowpan_frag_next_tag();
+    _tx.retries = 0;
+    _tx.to_send = _frags_mask(_tx.frags);
+    _tx.timer_msg.type = GNRC_SIXLOWPAN_MSG_SFR_ACK_TIMEOUT;
+    msg.type = GNRC_SIXLOWPAN_MSG_SFR_SND;
+    msg_send_to_self(&msg);
+    return true;
+}
+
+void gnrc_sixlowpan_frag_sfr_send_next(void)
+{
+    uint8_t seq = 0;
+
+    if ((_tx.pkt == NULL) || (_tx.to_send == 0)) {
+        return;
+    }
+    while (!(_tx.to_send & SFR_BIT(seq))) {
+        seq++;
+    }
+    _tx.to_send &= ~SFR_BIT(seq);
+    /* request an acknowledgment with the last fragment of a round */
+    _send_rfrag(seq, (_tx.to_send == 0));
+    if (_tx.to_send != 0) {
+        msg_t msg = { .type = GNRC_SIXLOWPAN_MSG_SFR_SND };
+
+        msg_send_to_self(&msg);
+        thread_yield();
+    }
+    else {
+        xtimer_set_msg(&_tx.timer, GNRC_SIXLOWPAN_SFR_ACK_TIMEOUT,
+                       &_tx.timer_msg, sched_active_pid);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_ack_timeout(void)
+{
+    if ((_tx.pkt == NULL) || (_tx.to_send != 0)) {
+        return;
+    }
+    if (++_tx.retries > GNRC_SIXLOWPAN_SFR_RETRIES) {
+        DEBUG("6lo sfr: no acknowledgment for datagram %u, giving up\n",
+              _tx.tag);
+        _STATS_INC(sfr_aborted);
+        _tx_finish();
+        return;
+    }
+    DEBUG("6lo sfr: acknowledgment timeout for datagram %u\n", _tx.tag);
+    _STATS_INC(sfr_retries);
+    /* ask again for an acknowledgment with the last fragment */
+    _tx.to_send = SFR_BIT(_tx.frags - 1);
+    gnrc_sixlowpan_frag_sfr_send_next();
+}
+
+static void _handle_ack(gnrc_netif_hdr_t *netif_hdr, sixlowpan_sfr_ack_t *ack)
+{
+    gnrc_netif_hdr_t *hdr;
+    uint32_t bitmap = byteorder_ntohl(ack->bitmap);
+    uint32_t sent;
+
+    if (_tx.pkt == NULL) {
+        return;
+    }
+    sent = _frags_mask(_tx.frags);
+    hdr = _tx.pkt->data;
+    if ((ack->tag != _tx.tag) ||
+        (netif_hdr->src_l2addr_len != hdr->dst_l2addr_len) ||
+        (memcmp(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                gnrc_netif_hdr_get_dst_addr(hdr), hdr->dst_l2addr_len) != 0)) {
+        DEBUG("6lo sfr: acknowledgment for unknown datagram %u\n", ack->tag);
+        return;
+    }
+    if ((bitmap & sent) == sent) {
+        DEBUG("6lo sfr: datagram %u acknowledged\n", _tx.tag);
+        _tx_finish();
+        return;
+    }
+    if (bitmap == 0) {
+        DEBUG("6lo sfr: datagram %u aborted by receiver\n", _tx.tag);
+        _STATS_INC(sfr_aborted);
+        _tx_finish();
+        return;
+    }
+    xtimer_remove(&_tx.timer);
+    if (++_tx.retries > GNRC_SIXLOWPAN_SFR_RETRIES) {
+        DEBUG("6lo sfr: too many retries for datagram %u\n", _tx.tag);
+        _STATS_INC(sfr_aborted);
+        _tx_finish();
+        return;
+    }
+    _STATS_INC(sfr_retries);
+    _tx.to_send = sent & ~bitmap;
+    DEBUG("6lo sfr: resend fragments 0x%08lx of datagram %u\n",
+          (unsigned long)_tx.to_send, _tx.tag);
+    gnrc_sixlowpan_frag_sfr_send_next();
+}
+
+/* receiving */
+static void _send_ack(gnrc_netif_hdr_t *netif_hdr, uint8_t tag, uint32_t bitmap)
+{
+    gnrc_pktsnip_t *netif, *ack_snip;
+    sixlowpan_sfr_ack_t *ack;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                 netif_hdr->src_l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating netif header\n");
+        return;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = netif_hdr->if_pid;
+    ack_snip = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_ack_t),
+                               GNRC_NETTYPE_SIXLOWPAN);
+    if (ack_snip == NULL) {
+        DEBUG("6lo sfr: error allocating acknowledgment\n");
+        gnrc_pktbuf_release(netif);
+        return;
+    }
+    netif->next = ack_snip;
+    ack = ack_snip->data;
+    ack->disp_ecn = SIXLOWPAN_SFR_ACK_DISP;
+    ack->tag = tag;
+    ack->bitmap = byteorder_htonl(bitmap);
+    DEBUG("6lo sfr: acknowledge 0x%08lx of datagram %u\n",
+          (unsigned long)bitmap, tag);
+    if (gnrc_netapi_send(netif_hdr->if_pid, netif) < 1) {
+        DEBUG("6lo sfr: unable to send acknowledgment\n");
+        gnrc_pktbuf_release(netif);
+    }
+}
+
+static void _rx_rem(_sfr_rx_t *entry)
+{
+    if (entry->pkt != NULL) {
+        gnrc_pktbuf_release(entry->pkt);
+        entry->pkt = NULL;
+    }
+    entry->src_len = 0;
+}
+
+static _sfr_rx_t *_rx_get(gnrc_netif_hdr_t *netif_hdr, uint8_t tag,
+                          bool create)
+{
+    _sfr_rx_t *res = NULL;
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_SFR_RBUF_SIZE; i++) {
+        _sfr_rx_t *entry = &_rx[i];
+
+        if ((entry->src_len != 0) &&
+            ((now_usec - entry->arrival) > RBUF_TIMEOUT)) {
+            DEBUG("6lo sfr: datagram %u timed out\n", entry->tag);
+            if (!entry->done) {
+                _STATS_INC(expired);
+            }
+            _rx_rem(entry);
+        }
+        if (entry->src_len == 0) {
+            if ((res == NULL) || (res->src_len != 0)) {
+                res = entry;
+            }
+            continue;
+        }
+        if ((entry->tag == tag) &&
+            (entry->src_len == netif_hdr->src_l2addr_len) &&
+            (entry->dst_len == netif_hdr->dst_l2addr_len) &&
+            (memcmp(entry->src, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    entry->src_len) == 0) &&
+            (memcmp(entry->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    entry->dst_len) == 0)) {
+            entry->arrival = now_usec;
+            return entry;
+        }
+        if (entry->done && (res == NULL)) {
+            /* completed datagrams make room for new ones */
+            res = entry;
+        }
+    }
+    if (!create || (res == NULL)) {
+        return NULL;
+    }
+    memcpy(res->src, gnrc_netif_hdr_get_src_addr(netif_hdr),
+           netif_hdr->src_l2addr_len);
+    memcpy(res->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    res->src_len = netif_hdr->src_l2addr_len;
+    res->dst_len = netif_hdr->dst_l2addr_len;
+    res->tag = tag;
+    res->arrival = now_usec;
+    res->received = 0;
+    res->size = 0;
+    res->cur_size = 0;
+    memset(res->covered, 0, sizeof(res->covered));
+    res->done = false;
+    res->pkt = NULL;
+    return res;
+}
+
+static void _dispatch(_sfr_rx_t *entry, gnrc_netif_hdr_t *netif_hdr)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(entry->src, entry->src_len,
+                                                 entry->dst, entry->dst_len);
+
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating netif header\n");
+        _STATS_INC(discarded);
+        _rx_rem(entry);
+        return;
+    }
+    /* take link-layer information of the last fragment like rbuf does */
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = netif_hdr->if_pid;
+    ((gnrc_netif_hdr_t *)netif->data)->flags = netif_hdr->flags;
+    ((gnrc_netif_hdr_t *)netif->data)->lqi = netif_hdr->lqi;
+    ((gnrc_netif_hdr_t *)netif->data)->rssi = netif_hdr->rssi;
+    entry->pkt->next = netif;
+    _STATS_INC(datagrams);
+    /* hand the compressed datagram to 6LoWPAN as if it was received in one
+     * frame */
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, entry->pkt)) {
+        DEBUG("6lo sfr: No receivers for this packet found\n");
+        gnrc_pktbuf_release(entry->pkt);
+    }
+    entry->pkt = NULL;
+    entry->done = true;
+}
+
+static void _handle_rfrag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    uint16_t ar_seq_fs = byteorder_ntohs(rfrag->ar_seq_fs);
+    uint8_t seq = (ar_seq_fs & SIXLOWPAN_SFR_SEQ_MASK) >> SIXLOWPAN_SFR_SEQ_POS;
+    size_t frag_size = ar_seq_fs & SIXLOWPAN_SFR_FRAG_SIZE_MASK;
+    size_t offset = (seq == 0) ? 0 : byteorder_ntohs(rfrag->offset);
+    bool ack_req = (ar_seq_fs & SIXLOWPAN_SFR_ACK_REQ);
+    _sfr_rx_t *entry;
+
+    if ((pkt->size < (sizeof(sixlowpan_sfr_rfrag_t) + frag_size)) ||
+        ((offset + frag_size) > RBUF_MAX_DGRAM_SIZE) ||
+        ((seq == 0) && (byteorder_ntohs(rfrag->offset) > RBUF_MAX_DGRAM_SIZE))) {
+        DEBUG("6lo sfr: invalid fragment\n");
+        return;
+    }
+    /* the peer evidently supports recoverable fragments */
+    gnrc_sixlowpan_frag_sfr_peer_add(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                     netif_hdr->src_l2addr_len);
+    entry = _rx_get(netif_hdr, rfrag->tag, true);
+    if (entry == NULL) {
+        DEBUG("6lo sfr: reassembly buffer full\n");
+        _STATS_INC(rbuf_full);
+        if (ack_req) {
+            /* abort the datagram */
+            _send_ack(netif_hdr, rfrag->tag, 0);
+        }
+        return;
+    }
+    if (entry->done) {
+        /* the acknowledgment for a completed datagram was lost */
+        if (ack_req) {
+            _send_ack(netif_hdr, entry->tag, SFR_BITMAP_FULL);
+        }
+        return;
+    }
+    if (!(entry->received & SFR_BIT(seq))) {
+        size_t capacity = (seq == 0) ? byteorder_ntohs(rfrag->offset)
+                                     : (offset + frag_size);
+
+        if (seq == 0) {
+            entry->size = capacity;
+        }
+        if ((entry->size != 0) &&
+            (((offset + frag_size) > entry->size) ||
+             ((entry->pkt != NULL) && (entry->pkt->size > entry->size)))) {
+            DEBUG("6lo sfr: fragment exceeds datagram, discarding datagram\n");
+            _STATS_INC(discarded);
+            _rx_rem(entry);
+            if (ack_req) {
+                _send_ack(netif_hdr, rfrag->tag, 0);
+            }
+            return;
+        }
+        if (entry->pkt == NULL) {
+            entry->pkt = gnrc_pktbuf_add(NULL, NULL, capacity,
+                                         GNRC_NETTYPE_SIXLOWPAN);
+        }
+        else if ((entry->pkt->size < capacity) || (seq == 0)) {
+            /* grow for out-of-order fragments until size is known */
+            if (gnrc_pktbuf_realloc_data(entry->pkt, capacity) != 0) {
+                gnrc_pktbuf_release(entry->pkt);
+                entry->pkt = NULL;
+            }
+        }
+        if (entry->pkt == NULL) {
+            DEBUG("6lo sfr: can not allocate reassembly buffer space\n");
+            _STATS_INC(discarded);
+            _rx_rem(entry);
+            return;
+        }
+        memcpy(((uint8_t *)entry->pkt->data) + offset, rfrag + 1, frag_size);
+        entry->received |= SFR_BIT(seq);
+        for (size_t i = offset; i < (offset + frag_size); i++) {
+            if (!bf_isset(entry->covered, i)) {
+                bf_set(entry->covered, i);
+                entry->cur_size++;
+            }
+        }
+    }
+    if ((entry->size != 0) && (entry->cur_size >= entry->size)) {
+        _dispatch(entry, netif_hdr);
+        if (ack_req) {
+            _send_ack(netif_hdr, entry->tag, SFR_BITMAP_FULL);
+        }
+    }
+    else if (ack_req) {
+        _send_ack(netif_hdr, entry->tag, entry->received);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_handle_pkt(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->next->data;
+    uint8_t *dispatch = pkt->data;
+
+    if ((hdr->src_l2addr_len > RBUF_L2ADDR_MAX_LEN) ||
+        (hdr->dst_l2addr_len > RBUF_L2ADDR_MAX_LEN)) {
+        DEBUG("6lo sfr: unsupported link-layer address length\n");
+    }
+    else if (sixlowpan_sfr_ack_is(dispatch)) {
+        if (pkt->size >= sizeof(sixlowpan_sfr_ack_t)) {
+            _handle_ack(hdr, pkt->data);
+        }
+    }
+    else if (pkt->size >= sizeof(sixlowpan_sfr_rfrag_t)) {
+        _handle_rfrag(hdr, pkt);
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+typedef int dont_be_pedantic;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+
+/** @} */
@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "bitfield.h"
+#include "byteorder.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/sixlowpan/netif.h"
+#include "net/ipv6/hdr.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "xtimer.h"
+#ifdef MODULE_GNRC_IPV6_NIB
+#include "net/gnrc/ipv6/nib.h"
+#elif defined(MODULE_GNRC_SIXLOWPAN_ND)
+#include "net/gnrc/sixlowpan/nd.h"
+#endif
+
+#include "vrb.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+
+static vrb_t _vrb[VRB_SIZE];
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#define _STATS_INC(field)   (gnrc_sixlowpan_frag_stats_get()->field++)
+#else
+#define _STATS_INC(field)
+#endif
+
+vrb_t *vrb_get(gnrc_netif_hdr_t *netif_hdr, size_t size, uint16_t tag)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < VRB_SIZE; i++) {
+        vrb_t *entry = &_vrb[i];
+
+        if (entry->out_dst_len == 0) {
+            continue;
+        }
+        if ((now_usec - entry->arrival) > RBUF_TIMEOUT) {
+            DEBUG("6lo vrb: entry %u timed out\n", i);
+            entry->out_dst_len = 0;
+            continue;
+        }
+        if ((entry->size == size) && (entry->tag == tag) &&
+            (entry->src_len == netif_hdr->src_l2addr_len) &&
+            (entry->dst_len == netif_hdr->dst_l2addr_len) &&
+            (memcmp(entry->src, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    entry->src_len) == 0) &&
+            (memcmp(entry->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    entry->dst_len) == 0)) {
+            entry->arrival = now_usec;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+vrb_t *vrb_add(const uint8_t *src, uint8_t src_len,
+               const uint8_t *dst, uint8_t dst_len,
+               size_t size, uint16_t tag, kernel_pid_t out_iface,
+               const uint8_t *out_dst, uint8_t out_dst_len)
+{
+    vrb_t *res = NULL;
+
+    for (unsigned i = 0; i < VRB_SIZE; i++) {
+        vrb_t *entry = &_vrb[i];
+
+        if (entry->out_dst_len == 0) {
+            res = entry;
+            break;
+        }
+        /* otherwise replace the entry that waited the longest for a
+         * fragment */
+        if ((res == NULL) || ((int32_t)(entry->arrival - res->arrival) < 0)) {
+            res = entry;
+        }
+    }
+    DEBUG("6lo vrb: add entry %u\n", (unsigned)(res - _vrb));
+    memcpy(res->src, src, src_len);
+    memcpy(res->dst, dst, dst_len);
+    memcpy(res->out_dst, out_dst, out_dst_len);
+    res->src_len = src_len;
+    res->dst_len = dst_len;
+    res->out_dst_len = out_dst_len;
+    res->out_iface = out_iface;
+    res->size = size;
+    res->tag = tag;
+    res->out_tag = gnrc_sixlowpan_frag_next_tag();
+    res->cur_size = 0;
+    memset(res->forwarded, 0, sizeof(res->forwarded));
+    res->arrival = xtimer_now_usec();
+    return res;
+}
+
+static kernel_pid_t _next_hop(const ipv6_addr_t *dst, uint8_t *l2addr,
+                              uint8_t *l2addr_len)
+{
+#if defined(MODULE_GNRC_IPV6_NIB)
+    gnrc_ipv6_nib_nc_t nce;
+
+    if ((gnrc_ipv6_nib_get_next_hop_l2addr(dst, KERNEL_PID_UNDEF, NULL,
+                                           &nce) < 0) ||
+        (nce.l2addr_len > *l2addr_len)) {
+        return KERNEL_PID_UNDEF;
+    }
+    memcpy(l2addr, nce.l2addr, nce.l2addr_len);
+    *l2addr_len = nce.l2addr_len;
+    return gnrc_ipv6_nib_nc_get_iface(&nce);
+#elif defined(MODULE_GNRC_SIXLOWPAN_ND)
+    kernel_pid_t iface = gnrc_sixlowpan_nd_next_hop_l2addr(l2addr, l2addr_len,
+                                                           KERNEL_PID_UNDEF,
+                                                           (ipv6_addr_t *)dst);
+
+    return (iface > KERNEL_PID_UNDEF) ? iface : KERNEL_PID_UNDEF;
+#else
+    (void)dst;
+    (void)l2addr;
+    (void)l2addr_len;
+    return KERNEL_PID_UNDEF;
+#endif
+}
+
+/* checks if the datagram with IPv6 header @p ipv6_hdr is to be forwarded and
+ * finds its next hop */
+static kernel_pid_t _route(const ipv6_hdr_t *ipv6_hdr, uint8_t *l2addr,
+                           uint8_t *l2addr_len)
+{
+    kernel_pid_t iface;
+
+    /* multicast, link-local and local datagrams as well as those that will
+     * hit hop limit 0 are left to the IPv6 layer */
+    if (ipv6_addr_is_multicast(&ipv6_hdr->dst) ||
+        ipv6_addr_is_link_local(&ipv6_hdr->dst) ||
+        ipv6_addr_is_link_local(&ipv6_hdr->src) ||
+        ipv6_addr_is_loopback(&ipv6_hdr->dst) ||
+        (ipv6_hdr->hl <= 1) ||
+        (gnrc_ipv6_netif_find_by_addr(NULL, &ipv6_hdr->dst) != KERNEL_PID_UNDEF)) {
+        return KERNEL_PID_UNDEF;
+    }
+    iface = _next_hop(&ipv6_hdr->dst, l2addr, l2addr_len);
+    if ((iface == KERNEL_PID_UNDEF) || (*l2addr_len == 0) ||
+        (gnrc_sixlowpan_netif_get(iface) == NULL)) {
+        DEBUG("6lo vrb: no 6LoWPAN next hop known, reassemble datagram\n");
+        return KERNEL_PID_UNDEF;
+    }
+    return iface;
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC
+/* decompresses the IPHC header of a first fragment and compresses it again
+ * for the next hop */
+static gnrc_pktsnip_t *_recompress(gnrc_pktsnip_t *pkt, size_t size,
+                                   size_t *frag_size, kernel_pid_t *iface,
+                                   uint8_t *l2addr, uint8_t *l2addr_len)
+{
+    gnrc_sixlowpan_netif_t *sixlowpan_iface;
+    gnrc_pktsnip_t *ipv6, *payload, *netif, *frag;
+    uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
+    size_t iphc_len, nh_len = 0;
+
+    /* the decompressed headers are larger than the compressed ones: reserve
+     * room for the IPv6 and a UDP header */
+    payload = gnrc_pktbuf_add(NULL, NULL, *frag_size + sizeof(ipv6_hdr_t) +
+                              sizeof(udp_hdr_t), GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        DEBUG("6lo vrb: unable to allocate space for first fragment\n");
+        return NULL;
+    }
+    iphc_len = gnrc_sixlowpan_iphc_decode(&payload, pkt, size,
+                                          sizeof(sixlowpan_frag_t), &nh_len);
+    if ((iphc_len == 0) ||
+        ((*iface = _route(payload->data, l2addr, l2addr_len)) == KERNEL_PID_UNDEF)) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    ((ipv6_hdr_t *)payload->data)->hl--;
+    /* append the rest of the fragment to the decompressed headers and split
+     * off the IPv6 header for the IPHC encoder */
+    memcpy(((uint8_t *)payload->data) + sizeof(ipv6_hdr_t) + nh_len,
+           data + iphc_len, *frag_size - iphc_len);
+    *frag_size += sizeof(ipv6_hdr_t) + nh_len - iphc_len;
+    gnrc_pktbuf_realloc_data(payload, *frag_size);
+    ipv6 = gnrc_pktbuf_mark(payload, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    payload->next = NULL;
+    ipv6->next = payload;
+    netif = gnrc_netif_hdr_build(NULL, 0, l2addr, *l2addr_len);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = *iface;
+    netif->next = ipv6;
+    sixlowpan_iface = gnrc_sixlowpan_netif_get(*iface);
+    if (!sixlowpan_iface->iphc_enabled || !gnrc_sixlowpan_iphc_encode(netif) ||
+        ((gnrc_pkt_len(netif->next) + sizeof(sixlowpan_frag_t)) >
+         sixlowpan_iface->max_frag_size)) {
+        DEBUG("6lo vrb: unable to recompress first fragment\n");
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    frag = gnrc_pktbuf_add(netif->next, pkt->data, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo vrb: unable to allocate fragment header\n");
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    netif->next = frag;
+    return netif;
+}
+#endif
+
+/* replaces the netif header of a received fragment with one to the next hop.
+ * On error, @p pkt is left untouched and NULL is returned. */
+static gnrc_pktsnip_t *_relabel(gnrc_pktsnip_t *pkt, kernel_pid_t iface,
+                                uint8_t *l2addr, uint8_t l2addr_len)
+{
+    gnrc_pktsnip_t *netif, *tmp;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, l2addr, l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating netif header\n");
+        return NULL;
+    }
+    tmp = gnrc_pktbuf_start_write(pkt);
+    if (tmp == NULL) {
+        DEBUG("6lo vrb: unable to get write access to fragment\n");
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_remove_snip(tmp, tmp->next);
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = iface;
+    netif->next = pkt;
+    return netif;
+}
+
+static void _send(vrb_t *entry, gnrc_pktsnip_t *pkt, size_t frag_size,
+                  size_t offset)
+{
+    bf_set(entry->forwarded, offset / RBUF_UNIT_SIZE);
+    entry->cur_size += frag_size;
+    if (entry->cur_size >= entry->size) {
+        /* all of the datagram was forwarded */
+        entry->out_dst_len = 0;
+    }
+    DEBUG("6lo vrb: forward fragment (tag %u => %u) over interface %"
+          PRIkernel_pid "\n", entry->tag, entry->out_tag, entry->out_iface);
+    if (gnrc_netapi_send(entry->out_iface, pkt) < 1) {
+        DEBUG("6lo vrb: unable to forward fragment\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    _STATS_INC(forwarded);
+}
+
+/* forwards the first fragment and creates an entry for its datagram */
+static bool _forward_first(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                           size_t frag_size)
+{
+    sixlowpan_frag_t *frag = pkt->data;
+    size_t size = byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK;
+    uint16_t tag = byteorder_ntohs(frag->tag);
+    uint8_t *data = (uint8_t *)(frag + 1);
+    uint8_t l2addr[RBUF_L2ADDR_MAX_LEN];
+    uint8_t l2addr_len = sizeof(l2addr);
+    uint8_t src[RBUF_L2ADDR_MAX_LEN], dst[RBUF_L2ADDR_MAX_LEN];
+    uint8_t src_len = netif_hdr->src_l2addr_len;
+    uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    gnrc_pktsnip_t *out = NULL;
+    vrb_t *entry;
+
+    if ((src_len > RBUF_L2ADDR_MAX_LEN) || (dst_len > RBUF_L2ADDR_MAX_LEN)) {
+        return false;
+    }
+    /* netif_hdr is part of pkt, which is released or relabeled below */
+    memcpy(src, gnrc_netif_hdr_get_src_addr(netif_hdr), src_len);
+    memcpy(dst, gnrc_netif_hdr_get_dst_addr(netif_hdr), dst_len);
+    if ((data[0] == SIXLOWPAN_UNCOMP) &&
+        (frag_size >= (1 + sizeof(ipv6_hdr_t)))) {
+        if ((iface = _route((ipv6_hdr_t *)(data + 1), l2addr,
+                            &l2addr_len)) == KERNEL_PID_UNDEF) {
+            return false;
+        }
+        if ((out = _relabel(pkt, iface, l2addr, l2addr_len)) == NULL) {
+            return false;
+        }
+        data = ((uint8_t *)out->next->data) + sizeof(sixlowpan_frag_t);
+        ((ipv6_hdr_t *)(data + 1))->hl--;
+        /* uncompressed dispatch does not count to the datagram */
+        frag_size--;
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC
+    else if (sixlowpan_iphc_is(data)) {
+        if ((out = _recompress(pkt, size, &frag_size, &iface, l2addr,
+                               &l2addr_len)) == NULL) {
+            return false;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+#endif
+    else {
+        return false;
+    }
+    entry = vrb_add(src, src_len, dst, dst_len, size, tag, iface, l2addr,
+                    l2addr_len);
+    ((sixlowpan_frag_t *)out->next->data)->tag = byteorder_htons(entry->out_tag);
+    _send(entry, out, frag_size, 0);
+    return true;
+}
+
+bool vrb_forward(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                 size_t frag_size, size_t offset)
+{
+    sixlowpan_frag_t *frag = pkt->data;
+    size_t size = byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK;
+    vrb_t *entry;
+
+    if ((offset >= size) || (size > RBUF_MAX_DGRAM_SIZE)) {
+        /* left to the reassembly buffer, which drops it */
+        return false;
+    }
+    entry = vrb_get(netif_hdr, size, byteorder_ntohs(frag->tag));
+    if (entry == NULL) {
+        return (offset == 0) ? _forward_first(netif_hdr, pkt, frag_size) : false;
+    }
+    if (bf_isset(entry->forwarded, offset / RBUF_UNIT_SIZE)) {
+        /* e.g. a link-layer retransmission whose ACK got lost */
+        DEBUG("6lo vrb: fragment already forwarded\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    if ((pkt = _relabel(pkt, entry->out_iface, entry->out_dst,
+                        entry->out_dst_len)) == NULL) {
+        return false;
+    }
+    ((sixlowpan_frag_t *)pkt->next->data)->tag = byteorder_htons(entry->out_tag);
+    _send(entry, pkt, frag_size, offset);
+    return true;
+}
+
+#ifdef TEST_SUITES
+void vrb_reset(void)
+{
+    memset(_vrb, 0, sizeof(_vrb));
+}
+#endif
+
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+typedef int dont_be_pedantic;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+/** @} */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @{
+ *
+ * @file
+ * @internal
+ * @brief   6LoWPAN virtual reassembly buffer
+ *
+ * Routers that are not the destination of a fragmented datagram forward its
+ * fragments right away instead of reassembling the datagram first. When the
+ * first fragment is received, its IPv6 header is decompressed to find the
+ * next hop and a new entry maps the incoming datagram to an outgoing datagram
+ * tag and next hop. All subsequent fragments are only relabeled with the
+ * outgoing tag and link-layer destination.
+ *
+ * @see <a href="https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-00">
+ *          draft-ietf-lwig-6lowpan-virtual-reassembly-00
+ *      </a>
+ */
+#ifndef VRB_H
+#define VRB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitfield.h"
+#include "kernel_types.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pkt.h"
+
+#include "rbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VRB_SIZE        (GNRC_SIXLOWPAN_FRAG_VRB_SIZE)  /**< size of the virtual reassembly buffer */
+
+/**
+ * @brief   An entry in the 6LoWPAN virtual reassembly buffer.
+ *
+ * The incoming datagram is identified by the same tuple as in the
+ * @ref rbuf_t "reassembly buffer".
+ */
+typedef struct {
+    uint32_t arrival;                       /**< time in microseconds of the
+                                             *   latest fragment */
+    uint8_t src[RBUF_L2ADDR_MAX_LEN];       /**< source address */
+    uint8_t dst[RBUF_L2ADDR_MAX_LEN];       /**< destination address */
+    uint8_t out_dst[RBUF_L2ADDR_MAX_LEN];   /**< link-layer address of the
+                                             *   next hop */
+    uint8_t src_len;                        /**< length of vrb_t::src */
+    uint8_t dst_len;                        /**< length of vrb_t::dst */
+    uint8_t out_dst_len;                    /**< length of vrb_t::out_dst,
+                                             *   0 for unused entries */
+    kernel_pid_t out_iface;                 /**< interface to the next hop */
+    uint16_t size;                          /**< datagram size */
+    uint16_t tag;                           /**< incoming datagram tag */
+    uint16_t out_tag;                       /**< outgoing datagram tag */
+    uint16_t cur_size;                      /**< bytes of the datagram
+                                             *   forwarded so far */
+    BITFIELD(forwarded, RBUF_UNITS);        /**< offsets in units of
+                                             *   @ref RBUF_UNIT_SIZE bytes of
+                                             *   the fragments forwarded so
+                                             *   far */
+} vrb_t;
+
+/**
+ * @brief   Adds an entry for a datagram to the virtual reassembly buffer.
+ *
+ * If the buffer is full, the entry that waited the longest for a fragment is
+ * replaced.
+ *
+ * @param[in] src           The link-layer source address of the datagram.
+ * @param[in] src_len       Length of @p src.
+ * @param[in] dst           The link-layer destination address of the
+ *                          datagram.
+ * @param[in] dst_len       Length of @p dst.
+ * @param[in] size          The datagram size.
+ * @param[in] tag           The incoming datagram tag.
+ * @param[in] out_iface     The interface to the next hop.
+ * @param[in] out_dst       The link-layer address of the next hop.
+ * @param[in] out_dst_len   Length of @p out_dst. Must be greater than 0.
+ *
+ * @return  The new entry.
+ */
+vrb_t *vrb_add(const uint8_t *src, uint8_t src_len,
+               const uint8_t *dst, uint8_t dst_len,
+               size_t size, uint16_t tag, kernel_pid_t out_iface,
+               const uint8_t *out_dst, uint8_t out_dst_len);
+
+/**
+ * @brief   Gets the entry of a datagram from the virtual reassembly buffer.
+ *
+ * Entries that timed out after @ref RBUF_TIMEOUT are removed on the way. The
+ * arrival time of the entry found is updated.
+ *
+ * @param[in] netif_hdr The interface header of a fragment of the datagram.
+ * @param[in] size      The datagram size.
+ * @param[in] tag       The incoming datagram tag.
+ *
+ * @return  The entry of the datagram.
+ * @return  NULL, if there is none.
+ */
+vrb_t *vrb_get(gnrc_netif_hdr_t *netif_hdr, size_t size, uint16_t tag);
+
+/**
+ * @brief   Forwards a fragment without reassembling its datagram, if the
+ *          datagram is not destined to this node.
+ *
+ * @param[in] netif_hdr The interface header of the fragment.
+ * @param[in] pkt       The fragment.
+ * @param[in] frag_size The fragment's size without its fragment header.
+ * @param[in] offset    The fragment's offset.
+ *
+ * Fragments whose offset was already forwarded are dropped.
+ *
+ * @return  true, if the fragment was handled (forwarded or dropped). @p pkt
+ *          was released in that case.
+ * @return  false, if the fragment must be reassembled by @ref rbuf_add().
+ */
+bool vrb_forward(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                 size_t frag_size, size_t offset);
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Removes all entries from the virtual reassembly buffer
+ *
+ * @note    Only available with `TEST_SUITES` defined.
+ */
+void vrb_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VRB_H */
+/** @} */
@@ -20,6 +20,7 @@
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/sixlowpan/netif.h"
 #include "net/sixlowpan.h"
@@ -35,7 +36,9 @@
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-static gnrc_sixlowpan_msg_frag_t fragment_msg = {KERNEL_PID_UNDEF, NULL, 0, 0};
+/* datagrams waiting for fragmentation, the one at _frag_head is fragmented */
+static gnrc_sixlowpan_msg_frag_t _frag_queue[GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE];
+static unsigned _frag_head, _frag_len;
 #endif
 
 #if ENABLE_DEBUG
@@ -127,6 +130,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
         return;
     }
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (sixlowpan_sfr_rfrag_is(dispatch) || sixlowpan_sfr_ack_is(dispatch)) {
+        DEBUG("6lo: received recoverable fragment or acknowledgment\n");
+        gnrc_sixlowpan_frag_sfr_handle_pkt(pkt);
+        return;
+    }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
     else if (sixlowpan_iphc_is(dispatch)) {
         size_t dispatch_size, nh_len;
@@ -188,6 +198,31 @@ static inline bool _add_uncompr_disp(gnrc_pktsnip_t *pkt)
     return true;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+static void _frag_start(void)
+{
+    msg_t msg;
+
+    /* set the outgoing message's fields */
+    msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    msg.content.ptr = &_frag_queue[_frag_head];
+    /* send message to self */
+    msg_send_to_self(&msg);
+}
+
+static void _frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+    gnrc_sixlowpan_frag_send(fragment_msg);
+    if (fragment_msg->pkt == NULL) {
+        /* datagram is done, continue with the next one */
+        _frag_head = (_frag_head + 1) % GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE;
+        if (--_frag_len > 0) {
+            _frag_start();
+        }
+    }
+}
+#endif
+
 static void _send(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_hdr_t *hdr;
@@ -271,28 +306,35 @@ static void _send(gnrc_pktsnip_t *pkt)
 
         return;
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (gnrc_sixlowpan_frag_sfr_send(pkt2)) {
+        DEBUG("6lo: Send as recoverable fragments (%u > %" PRIu16 ")\n",
+              (unsigned int)gnrc_pkt_len(pkt2->next), iface->max_frag_size);
+        return;
+    }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-    else if (fragment_msg.pkt != NULL) {
-        DEBUG("6lo: Fragmentation already ongoing. Dropping packet\n");
+    else if (_frag_len >= GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE) {
+        DEBUG("6lo: Fragmentation queue full. Dropping packet\n");
         gnrc_pktbuf_release(pkt2);
         return;
     }
     else if (datagram_size <= SIXLOWPAN_FRAG_MAX_LEN) {
+        gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
         DEBUG("6lo: Send fragmented (%u > %" PRIu16 ")\n",
               (unsigned int)datagram_size, iface->max_frag_size);
-        msg_t msg;
-
-        fragment_msg.pid = hdr->if_pid;
-        fragment_msg.pkt = pkt2;
-        fragment_msg.datagram_size = datagram_size;
+        fragment_msg = &_frag_queue[(_frag_head + _frag_len) %
+                                    GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE];
+        fragment_msg->pid = hdr->if_pid;
+        fragment_msg->pkt = pkt2;
+        fragment_msg->datagram_size = datagram_size;
         /* Sending the first fragment has an offset==0 */
-        fragment_msg.offset = 0;
-
-        /* set the outgoing message's fields */
-        msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-        msg.content.ptr = &fragment_msg;
-        /* send message to self */
-        msg_send_to_self(&msg);
+        fragment_msg->offset = 0;
+        fragment_msg->retries = 0;
+        if (_frag_len++ == 0) {
+            _frag_start();
+        }
     }
     else {
         DEBUG("6lo: packet too big (%u > %" PRIu16 ")\n",
@@ -347,7 +389,17 @@ static void *_event_loop(void *args)
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
             case GNRC_SIXLOWPAN_MSG_FRAG_SND:
                 DEBUG("6lo: send fragmented event received\n");
-                gnrc_sixlowpan_frag_send(msg.content.ptr);
+                _frag_send(msg.content.ptr);
+                break;
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+            case GNRC_SIXLOWPAN_MSG_SFR_SND:
+                DEBUG("6lo: send recoverable fragment event received\n");
+                gnrc_sixlowpan_frag_sfr_send_next();
+                break;
+            case GNRC_SIXLOWPAN_MSG_SFR_ACK_TIMEOUT:
+                DEBUG("6lo: recoverable fragment acknowledgment timeout\n");
+                gnrc_sixlowpan_frag_sfr_ack_timeout();
                 break;
 #endif
 
@@ -581,126 +581,143 @@ inline static size_t iphc_nhc_udp_encode(gnrc_pktsnip_t *udp, ipv6_hdr_t *ipv6_h
 }
 #endif
 
-bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+/**
+ * @brief   Compressed addresses of a flow
+ *
+ * The addresses are only described by the second IPHC byte, the CID
+ * extension, and their inline values, so these are replayed for subsequent
+ * packets of a flow. Traffic class, flow label, next header, and hop limit
+ * are compressed for every packet.
+ */
+typedef struct {
+    ipv6_addr_t src;                    /**< source address */
+    ipv6_addr_t dst;                    /**< destination address */
+    /**
+     * @brief   link-layer source address the IID of a link-local or
+     *          context-based source address is derived from
+     */
+    uint8_t src_l2addr[IEEE802154_LONG_ADDRESS_LEN];
+    /**
+     * @brief   link-layer destination address the IID of a link-local or
+     *          context-based destination address is derived from
+     */
+    uint8_t dst_l2addr[IEEE802154_LONG_ADDRESS_LEN];
+    kernel_pid_t if_pid;                /**< interface, KERNEL_PID_UNDEF if unused */
+    uint16_t ctx_version;               /**< version of the context buffer */
+    uint8_t src_l2addr_len;             /**< length of _cache_t::src_l2addr */
+    uint8_t dst_l2addr_len;             /**< length of _cache_t::dst_l2addr */
+    uint8_t iphc2;                      /**< second IPHC byte */
+    uint8_t cid;                        /**< CID extension */
+    uint8_t addrs_len;                  /**< length of _cache_t::addrs */
+    uint8_t addrs[2 * sizeof(ipv6_addr_t)]; /**< inline addresses */
+} _cache_t;
+
+static _cache_t _cache[GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _cache_next;
+static gnrc_sixlowpan_iphc_cache_stats_t _cache_stats;
+
+static _cache_t *_cache_get(gnrc_netif_hdr_t *netif_hdr, ipv6_hdr_t *ipv6_hdr)
 {
-    gnrc_netif_hdr_t *netif_hdr = pkt->data;
-    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
-    uint8_t *iphc_hdr;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-    bool addr_comp = false, nhc_comp = false;
-    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    gnrc_pktsnip_t *dispatch = gnrc_pktbuf_add(NULL, NULL, pkt->next->size,
-                                               GNRC_NETTYPE_SIXLOWPAN);
-
-    if (dispatch == NULL) {
-        DEBUG("6lo iphc: error allocating dispatch space\n");
-        return false;
+    uint16_t ctx_version = gnrc_sixlowpan_ctx_version();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        _cache_t *cache = &_cache[i];
+
+        if ((cache->if_pid == netif_hdr->if_pid) &&
+            (cache->src_l2addr_len == netif_hdr->src_l2addr_len) &&
+            (cache->dst_l2addr_len == netif_hdr->dst_l2addr_len) &&
+            ipv6_addr_equal(&cache->dst, &ipv6_hdr->dst) &&
+            ipv6_addr_equal(&cache->src, &ipv6_hdr->src) &&
+            (memcmp(cache->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    cache->dst_l2addr_len) == 0) &&
+            (memcmp(cache->src_l2addr, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    cache->src_l2addr_len) == 0)) {
+            if (cache->ctx_version != ctx_version) {
+                DEBUG("6lo iphc: cached flow outdated\n");
+                cache->if_pid = KERNEL_PID_UNDEF;
+                break;
+            }
+            _cache_stats.hits++;
+            return cache;
+        }
     }
+    _cache_stats.misses++;
+    return NULL;
+}
 
-    iphc_hdr = dispatch->data;
+static void _cache_add(gnrc_netif_hdr_t *netif_hdr, ipv6_hdr_t *ipv6_hdr,
+                       const uint8_t *iphc_hdr, uint16_t addrs_pos,
+                       uint16_t addrs_end)
+{
+    _cache_t *cache = NULL;
 
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
+    if ((netif_hdr->if_pid == KERNEL_PID_UNDEF) ||
+        (netif_hdr->src_l2addr_len > sizeof(cache->src_l2addr)) ||
+        (netif_hdr->dst_l2addr_len > sizeof(cache->dst_l2addr))) {
+        return;
+    }
+    /* prefer the entry _cache_get() invalidated */
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        if (_cache[i].if_pid == KERNEL_PID_UNDEF) {
+            cache = &_cache[i];
+            break;
+        }
+    }
+    if (cache == NULL) {
+        cache = &_cache[_cache_next];
+        _cache_next = (_cache_next + 1) % GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    }
+    memcpy(&cache->src, &ipv6_hdr->src, sizeof(cache->src));
+    memcpy(&cache->dst, &ipv6_hdr->dst, sizeof(cache->dst));
+    memcpy(cache->src_l2addr, gnrc_netif_hdr_get_src_addr(netif_hdr),
+           netif_hdr->src_l2addr_len);
+    memcpy(cache->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    cache->src_l2addr_len = netif_hdr->src_l2addr_len;
+    cache->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    cache->ctx_version = gnrc_sixlowpan_ctx_version();
+    cache->iphc2 = iphc_hdr[IPHC2_IDX];
+    cache->cid = iphc_hdr[CID_EXT_IDX];
+    cache->addrs_len = addrs_end - addrs_pos;
+    memcpy(cache->addrs, iphc_hdr + addrs_pos, cache->addrs_len);
+    cache->if_pid = netif_hdr->if_pid;
+}
+
+gnrc_sixlowpan_iphc_cache_stats_t *gnrc_sixlowpan_iphc_cache_stats_get(void)
+{
+    return &_cache_stats;
+}
+#endif
 
-    /* check for available contexts */
+static void _lookup_ctxs(ipv6_hdr_t *ipv6_hdr, gnrc_sixlowpan_ctx_t **src_ctx,
+                         gnrc_sixlowpan_ctx_t **dst_ctx)
+{
     if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+        *src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
         /* do not use source context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            src_ctx = NULL;
+        if (*src_ctx && !((*src_ctx)->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            *src_ctx = NULL;
         }
     }
 
     if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+        *dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
         /* do not use destination context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            dst_ctx = NULL;
-        }
-    }
-
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
-
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
-    }
-
-    /* compress flow label and traffic class */
-    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
-        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
-            /* elide both traffic class and flow label */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
-        }
-        else {
-            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        if (*dst_ctx && !((*dst_ctx)->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            *dst_ctx = NULL;
         }
     }
-    else {
-        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
-            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
-                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
-        }
-        else {
-            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
-        }
-
-        /* copy remaining byteos of flow label */
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff) >> 8);
-    }
-
-    /* compress next header */
-    switch (ipv6_hdr->nh) {
-#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
-        case PROTNUM_UDP:
-            iphc_nhc_udp_encode(pkt->next->next, ipv6_hdr);
-            iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
-            nhc_comp = true;
-            break;
-#endif
-
-        default:
-            iphc_hdr[inline_pos++] = ipv6_hdr->nh;
-            break;
-    }
-
-    /* compress hop limit */
-    switch (ipv6_hdr->hl) {
-        case 1:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
-            break;
-
-        case 64:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
-            break;
-
-        case 255:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
-            break;
+}
 
-        default:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
-            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
-            break;
-    }
+static uint16_t _encode_addrs(uint8_t *iphc_hdr, uint16_t inline_pos,
+                              gnrc_netif_hdr_t *netif_hdr, ipv6_hdr_t *ipv6_hdr,
+                              gnrc_sixlowpan_ctx_t *src_ctx,
+                              gnrc_sixlowpan_ctx_t *dst_ctx)
+{
+    bool addr_comp = false;
 
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
@@ -877,6 +894,149 @@ bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
         inline_pos += 16;
     }
 
+    return inline_pos;
+}
+
+bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *netif_hdr = pkt->data;
+    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+    uint8_t *iphc_hdr;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    bool nhc_comp = false;
+    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    _cache_t *cache;
+#endif
+    gnrc_pktsnip_t *dispatch = gnrc_pktbuf_add(NULL, NULL, pkt->next->size,
+                                               GNRC_NETTYPE_SIXLOWPAN);
+
+    if (dispatch == NULL) {
+        DEBUG("6lo iphc: error allocating dispatch space\n");
+        return false;
+    }
+
+    iphc_hdr = dispatch->data;
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = 0;
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    if ((cache = _cache_get(netif_hdr, ipv6_hdr)) != NULL) {
+        /* the second IPHC byte and the CID extension only describe the
+         * addresses */
+        iphc_hdr[IPHC2_IDX] = cache->iphc2;
+        iphc_hdr[CID_EXT_IDX] = cache->cid;
+    }
+    else
+#endif
+    {
+        /* check for available contexts */
+        _lookup_ctxs(ipv6_hdr, &src_ctx, &dst_ctx);
+
+        /* if contexts available and both != 0 */
+        if (((src_ctx != NULL) &&
+                ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
+            ((dst_ctx != NULL) &&
+                ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
+            /* add context identifier extension */
+            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+            iphc_hdr[CID_EXT_IDX] = 0;
+        }
+    }
+
+    /* since this moves inline_pos we have to do this ahead*/
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    /* compress flow label and traffic class */
+    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
+        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
+            /* elide both traffic class and flow label */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
+        }
+        else {
+            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        }
+    }
+    else {
+        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
+            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
+                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
+        }
+        else {
+            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
+        }
+
+        /* copy remaining byteos of flow label */
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff) >> 8);
+    }
+
+    /* compress next header */
+    switch (ipv6_hdr->nh) {
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+        case PROTNUM_UDP:
+            iphc_nhc_udp_encode(pkt->next->next, ipv6_hdr);
+            iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
+            nhc_comp = true;
+            break;
+#endif
+
+        default:
+            iphc_hdr[inline_pos++] = ipv6_hdr->nh;
+            break;
+    }
+
+    /* compress hop limit */
+    switch (ipv6_hdr->hl) {
+        case 1:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
+            break;
+
+        case 64:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
+            break;
+
+        case 255:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
+            break;
+
+        default:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
+            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
+            break;
+    }
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    if (cache != NULL) {
+        memcpy(iphc_hdr + inline_pos, cache->addrs, cache->addrs_len);
+        inline_pos += cache->addrs_len;
+    }
+    else
+#endif
+    {
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+        uint16_t addrs_pos = inline_pos;
+#endif
+
+        inline_pos = _encode_addrs(iphc_hdr, inline_pos, netif_hdr, ipv6_hdr,
+                                   src_ctx, dst_ctx);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+        _cache_add(netif_hdr, ipv6_hdr, iphc_hdr, addrs_pos, inline_pos);
+#endif
+    }
+
     if (nhc_comp) {
         iphc_hdr[inline_pos++] = ipv6_hdr->nh;
     }
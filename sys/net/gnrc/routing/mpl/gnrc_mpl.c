@@ -0,0 +1,499 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/ipv6/hdr.h"
+#include "random.h"
+#include "trickle.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#include "net/gnrc/mpl.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/* the only header this implementation sends: MPL option with S = 0 followed by
+ * a PadN option to align the Hop-by-Hop header to 8 bytes */
+#define _HBH_LEN        (sizeof(ipv6_ext_t) + sizeof(gnrc_mpl_opt_t) + 2)
+#define _OPT_PAD1       (0x00)
+#define _OPT_PADN       (0x01)
+
+typedef struct {
+    ipv6_addr_t id;     /**< seed ID */
+    uint32_t expires;   /**< expiry time in seconds (system time) */
+    uint8_t min_seq;    /**< lower bound of sequence numbers still accepted */
+    bool used;          /**< entry is in use */
+} _seed_t;
+
+typedef struct {
+    trickle_t trickle;      /**< trickle timer of the message */
+    gnrc_pktsnip_t *pkt;    /**< the message, NULL if entry is unused */
+    _seed_t *seed;          /**< seed of the message */
+    kernel_pid_t iface;     /**< interface to send over */
+    uint8_t seq;            /**< sequence number of the message */
+    uint8_t expirations;    /**< trickle intervals passed so far */
+    uint8_t gen;            /**< generation of the entry, identifies the
+                             *   trickle messages of the current message */
+} _buf_msg_t;
+
+static char _stack[GNRC_MPL_STACK_SIZE];
+static msg_t _msg_q[GNRC_MPL_MSG_QUEUE_SIZE];
+static mutex_t _mutex = MUTEX_INIT;
+static _seed_t _seeds[GNRC_MPL_SEED_SET_NUMOF];
+static _buf_msg_t _msgs[GNRC_MPL_BUFFERED_MSG_NUMOF];
+static kernel_pid_t _iface = KERNEL_PID_UNDEF;
+static uint8_t _seq;
+static const ipv6_addr_t _all_forwarders = GNRC_MPL_ALL_FORWARDERS_ADDR;
+
+kernel_pid_t gnrc_mpl_pid = KERNEL_PID_UNDEF;
+gnrc_mpl_stats_t gnrc_mpl_stats;
+
+static void *_event_loop(void *args);
+
+static inline uint32_t _now_sec(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+}
+
+/* serial number arithmetic on 8-bit sequence numbers (RFC 1982) */
+static inline bool _seq_lt(uint8_t a, uint8_t b)
+{
+    return (int8_t)(a - b) < 0;
+}
+
+static bool _seed_has_msgs(const _seed_t *seed)
+{
+    for (unsigned i = 0; i < GNRC_MPL_BUFFERED_MSG_NUMOF; i++) {
+        if ((_msgs[i].pkt != NULL) && (_msgs[i].seed == seed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* returns the seed set entry for id and creates it if it does not exist */
+static _seed_t *_seed_get(const ipv6_addr_t *id, uint8_t seq, uint32_t now)
+{
+    _seed_t *res = NULL;
+
+    for (unsigned i = 0; i < GNRC_MPL_SEED_SET_NUMOF; i++) {
+        _seed_t *seed = &_seeds[i];
+
+        if (seed->used && ipv6_addr_equal(&seed->id, id)) {
+            seed->expires = now + GNRC_MPL_SEED_SET_ENTRY_LIFETIME;
+            return seed;
+        }
+        if (seed->used && ((int32_t)(seed->expires - now) <= 0) &&
+            !_seed_has_msgs(seed)) {
+            seed->used = false;
+        }
+        if (!seed->used && (res == NULL)) {
+            res = seed;
+        }
+    }
+    if (res != NULL) {
+        res->id = *id;
+        res->min_seq = seq;
+        res->expires = now + GNRC_MPL_SEED_SET_ENTRY_LIFETIME;
+        res->used = true;
+    }
+    return res;
+}
+
+static _buf_msg_t *_msg_get(const _seed_t *seed, uint8_t seq)
+{
+    for (unsigned i = 0; i < GNRC_MPL_BUFFERED_MSG_NUMOF; i++) {
+        if ((_msgs[i].pkt != NULL) && (_msgs[i].seed == seed) &&
+            (_msgs[i].seq == seq)) {
+            return &_msgs[i];
+        }
+    }
+    return NULL;
+}
+
+static void _seed_advance(_seed_t *seed, uint8_t seq)
+{
+    if (!_seq_lt(seq, seed->min_seq)) {
+        seed->min_seq = seq + 1;
+    }
+}
+
+static void _msg_free(_buf_msg_t *msg)
+{
+    trickle_stop(&msg->trickle);
+    gnrc_pktbuf_release(msg->pkt);
+    msg->pkt = NULL;
+    /* the message is forgotten: without advancing MinSequence past it, a
+     * copy that is still on its way would be taken for a new message and
+     * delivered again. Messages of the seed that are still buffered are
+     * found by _msg_get() before MinSequence is checked. */
+    _seed_advance(msg->seed, msg->seq);
+}
+
+static void _transmit(void *args)
+{
+    _buf_msg_t *msg = args;
+    gnrc_pktsnip_t *payload, *pkt;
+
+    payload = gnrc_pktbuf_add(NULL, (uint8_t *)msg->pkt->data + sizeof(ipv6_hdr_t),
+                              msg->pkt->size - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        DEBUG("mpl: unable to copy message payload\n");
+        return;
+    }
+    pkt = gnrc_pktbuf_add(payload, msg->pkt->data, sizeof(ipv6_hdr_t),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        DEBUG("mpl: unable to copy message header\n");
+        gnrc_pktbuf_release(payload);
+        return;
+    }
+    if (msg->iface != KERNEL_PID_UNDEF) {
+        gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+        if (netif == NULL) {
+            DEBUG("mpl: unable to allocate netif header\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        ((gnrc_netif_hdr_t *)netif->data)->if_pid = msg->iface;
+        LL_PREPEND(pkt, netif);
+    }
+    DEBUG("mpl: transmit message %u\n", (unsigned)msg->seq);
+    if (gnrc_netapi_send(gnrc_ipv6_pid, pkt) < 1) {
+        DEBUG("mpl: unable to send message\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    gnrc_mpl_stats.tx++;
+}
+
+/* adds pkt to the buffered message set and starts its trickle timer */
+static void _msg_add(kernel_pid_t iface, _seed_t *seed, uint8_t seq,
+                     gnrc_pktsnip_t *pkt)
+{
+    _buf_msg_t *msg = NULL;
+
+    for (unsigned i = 0; i < GNRC_MPL_BUFFERED_MSG_NUMOF; i++) {
+        if (_msgs[i].pkt == NULL) {
+            msg = &_msgs[i];
+            break;
+        }
+        if ((msg == NULL) || (_msgs[i].expirations > msg->expirations)) {
+            msg = &_msgs[i];
+        }
+    }
+    if (msg->pkt != NULL) {
+        DEBUG("mpl: buffered message set full, dropping message %u\n",
+              (unsigned)msg->seq);
+        _msg_free(msg);
+        gnrc_mpl_stats.evicted++;
+    }
+    msg->pkt = pkt;
+    msg->seed = seed;
+    msg->iface = iface;
+    msg->seq = seq;
+    msg->expirations = 0;
+    msg->trickle.callback.func = _transmit;
+    msg->trickle.callback.args = msg;
+    /* trickle_stop() only removes the timer of an evicted message, but its
+     * last trickle message may still be queued: tag the messages with the
+     * generation of the entry, so that one is ignored instead of driving the
+     * trickle timer of the new message */
+    msg->gen++;
+    trickle_start(gnrc_mpl_pid, &msg->trickle,
+                  GNRC_MPL_MSG_TYPE_TRICKLE_MSG |
+                  (msg->gen & GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK),
+                  GNRC_MPL_DATA_MESSAGE_IMIN, GNRC_MPL_DATA_MESSAGE_IMAX,
+                  GNRC_MPL_DATA_MESSAGE_K);
+}
+
+kernel_pid_t gnrc_mpl_init(kernel_pid_t if_pid)
+{
+    if (gnrc_mpl_pid == KERNEL_PID_UNDEF) {
+        gnrc_mpl_pid = thread_create(_stack, sizeof(_stack), GNRC_MPL_PRIO,
+                                     THREAD_CREATE_STACKTEST,
+                                     _event_loop, NULL, "MPL");
+        if (gnrc_mpl_pid == KERNEL_PID_UNDEF) {
+            DEBUG("mpl: could not start the event loop\n");
+            return KERNEL_PID_UNDEF;
+        }
+        _seq = (uint8_t)random_uint32();
+        memset(&gnrc_mpl_stats, 0, sizeof(gnrc_mpl_stats));
+    }
+    if (gnrc_ipv6_netif_add_addr(if_pid, &_all_forwarders, IPV6_ADDR_BIT_LEN,
+                                 0) == NULL) {
+        DEBUG("mpl: unable to join ff03::fc on interface %" PRIkernel_pid "\n",
+              if_pid);
+        return KERNEL_PID_UNDEF;
+    }
+    if (_iface == KERNEL_PID_UNDEF) {
+        _iface = if_pid;
+    }
+    return gnrc_mpl_pid;
+}
+
+int gnrc_mpl_send(gnrc_pktsnip_t *pkt)
+{
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    gnrc_pktsnip_t *ipv6, *payload, *msg;
+    ipv6_hdr_t *hdr, *outer;
+    ipv6_ext_t *hbh;
+    gnrc_mpl_opt_t *opt;
+    uint8_t *data;
+    _seed_t *seed;
+    int res;
+
+    if (gnrc_mpl_pid == KERNEL_PID_UNDEF) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOTCONN;
+    }
+    if (pkt->type == GNRC_NETTYPE_NETIF) {
+        iface = ((gnrc_netif_hdr_t *)pkt->data)->if_pid;
+        pkt = gnrc_pktbuf_remove_snip(pkt, pkt);
+    }
+    if ((pkt == NULL) || (pkt->type != GNRC_NETTYPE_IPV6)) {
+        gnrc_pktbuf_release(pkt);
+        return -EINVAL;
+    }
+    /* header and upper layer header are filled in below */
+    if ((ipv6 = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt = ipv6;
+    if (pkt->next != NULL) {
+        if ((payload = gnrc_pktbuf_start_write(pkt->next)) == NULL) {
+            gnrc_pktbuf_release(pkt);
+            return -ENOMEM;
+        }
+        pkt->next = payload;
+    }
+    payload = pkt->next;
+    hdr = ipv6->data;
+
+    hdr->len = byteorder_htons(gnrc_pkt_len(payload));
+    if ((hdr->nh == PROTNUM_RESERVED) && (payload != NULL)) {
+        hdr->nh = gnrc_nettype_to_protnum(payload->type);
+    }
+    if (hdr->nh == PROTNUM_RESERVED) {
+        hdr->nh = PROTNUM_IPV6_NONXT;
+    }
+    if (hdr->hl == 0) {
+        hdr->hl = GNRC_IPV6_NETIF_DEFAULT_HL;
+    }
+    if (ipv6_addr_is_unspecified(&hdr->src)) {
+        kernel_pid_t src_if = (iface == KERNEL_PID_UNDEF) ? _iface : iface;
+        ipv6_addr_t *src = gnrc_ipv6_netif_find_best_src_addr(src_if, &hdr->dst,
+                                                              false);
+
+        if (src == NULL) {
+            DEBUG("mpl: no source address for message\n");
+            gnrc_pktbuf_release(pkt);
+            return -EADDRNOTAVAIL;
+        }
+        hdr->src = *src;
+    }
+    if ((payload != NULL) &&
+        ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) && (res != -ENOENT)) {
+        DEBUG("mpl: checksum calculation failed\n");
+        gnrc_pktbuf_release(pkt);
+        return res;
+    }
+
+    /* flatten into outer IPv6 header, Hop-by-Hop header and inner packet */
+    msg = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t) + _HBH_LEN +
+                          gnrc_pkt_len(pkt), GNRC_NETTYPE_UNDEF);
+    if (msg == NULL) {
+        DEBUG("mpl: packet buffer full\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    outer = msg->data;
+    memset(outer, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(outer);
+    outer->len = byteorder_htons(msg->size - sizeof(ipv6_hdr_t));
+    outer->nh = PROTNUM_IPV6_EXT_HOPOPT;
+    outer->hl = GNRC_MPL_HOP_LIMIT;
+    outer->src = hdr->src;
+    outer->dst = _all_forwarders;
+    hbh = (ipv6_ext_t *)(outer + 1);
+    hbh->nh = PROTNUM_IPV6;
+    hbh->len = 0;
+    opt = (gnrc_mpl_opt_t *)(hbh + 1);
+    opt->type = GNRC_MPL_OPT_TYPE;
+    opt->len = sizeof(gnrc_mpl_opt_t) - 2;
+    opt->flags = 0;
+    data = (uint8_t *)(opt + 1);
+    data[0] = _OPT_PADN;
+    data[1] = 0;
+    data += 2;
+    for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
+        memcpy(data, ptr->data, ptr->size);
+        data += ptr->size;
+    }
+    gnrc_pktbuf_release(pkt);
+
+    mutex_lock(&_mutex);
+    opt->seq = _seq;
+    if ((seed = _seed_get(&outer->src, _seq, _now_sec())) == NULL) {
+        mutex_unlock(&_mutex);
+        DEBUG("mpl: seed set full\n");
+        gnrc_pktbuf_release(msg);
+        return -ENOMEM;
+    }
+    _msg_add(iface, seed, _seq++, msg);
+    gnrc_mpl_stats.seeded++;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+/* returns the MPL option in hbh or NULL if there is none */
+static gnrc_mpl_opt_t *_find_opt(ipv6_ext_t *hbh)
+{
+    uint8_t *opt = (uint8_t *)(hbh + 1);
+    uint8_t *end = (uint8_t *)hbh + ((hbh->len + 1) * IPV6_EXT_LEN_UNIT);
+
+    while (opt < end) {
+        if (opt[0] == _OPT_PAD1) {
+            opt++;
+            continue;
+        }
+        if (((opt + 2) > end) || ((opt + 2 + opt[1]) > end)) {
+            return NULL;
+        }
+        if ((opt[0] == GNRC_MPL_OPT_TYPE) &&
+            (opt[1] >= (sizeof(gnrc_mpl_opt_t) - 2))) {
+            return (gnrc_mpl_opt_t *)opt;
+        }
+        opt += 2 + opt[1];
+    }
+    return NULL;
+}
+
+int gnrc_mpl_process_hbh(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
+                         ipv6_ext_t *hbh)
+{
+    gnrc_pktsnip_t *ipv6 = pkt->next;
+    gnrc_mpl_opt_t *opt;
+    ipv6_hdr_t *hdr;
+    _buf_msg_t *msg;
+    _seed_t *seed;
+    int res = 0;
+
+    if ((opt = _find_opt(hbh)) == NULL) {
+        return 0;
+    }
+    if ((opt->flags & (GNRC_MPL_OPT_S_MASK | GNRC_MPL_OPT_V)) != 0) {
+        DEBUG("mpl: unsupported option flags %02x\n", (unsigned)opt->flags);
+        return -ENOTSUP;
+    }
+    if ((ipv6 == NULL) || (ipv6->type != GNRC_NETTYPE_IPV6) ||
+        (pkt->data != (void *)hbh) || (gnrc_mpl_pid == KERNEL_PID_UNDEF)) {
+        return 0;
+    }
+    hdr = ipv6->data;
+
+    mutex_lock(&_mutex);
+    if ((seed = _seed_get(&hdr->src, opt->seq, _now_sec())) == NULL) {
+        /* deliver, but do not forward what we can not keep track of */
+        DEBUG("mpl: seed set full\n");
+    }
+    else if ((msg = _msg_get(seed, opt->seq)) != NULL) {
+        DEBUG("mpl: duplicate message %u\n", (unsigned)opt->seq);
+        trickle_increment_counter(&msg->trickle);
+        gnrc_mpl_stats.rx_dup++;
+        res = -EALREADY;
+    }
+    else if (_seq_lt(opt->seq, seed->min_seq)) {
+        DEBUG("mpl: old message %u\n", (unsigned)opt->seq);
+        gnrc_mpl_stats.rx_dup++;
+        res = -EALREADY;
+    }
+    else {
+        gnrc_pktsnip_t *copy = NULL;
+
+        DEBUG("mpl: new message %u\n", (unsigned)opt->seq);
+        gnrc_mpl_stats.rx++;
+        if (hdr->hl > 1) {
+            copy = gnrc_pktbuf_add(NULL, NULL, ipv6->size + pkt->size,
+                                   GNRC_NETTYPE_UNDEF);
+        }
+        if (copy != NULL) {
+            memcpy(copy->data, ipv6->data, ipv6->size);
+            memcpy((uint8_t *)copy->data + ipv6->size, pkt->data, pkt->size);
+            ((ipv6_hdr_t *)copy->data)->hl--;
+            _msg_add(iface, seed, opt->seq, copy);
+        }
+        else {
+            /* not forwarded: only remember that it was seen */
+            _seed_advance(seed, opt->seq);
+        }
+    }
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+static void *_event_loop(void *args)
+{
+    msg_t msg;
+
+    (void)args;
+    msg_init_queue(_msg_q, GNRC_MPL_MSG_QUEUE_SIZE);
+
+    while (1) {
+        msg_receive(&msg);
+
+        switch (msg.type & ~GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK) {
+            case GNRC_MPL_MSG_TYPE_TRICKLE_MSG: {
+                _buf_msg_t *buf_msg = container_of(msg.content.ptr, _buf_msg_t,
+                                                   trickle);
+
+                mutex_lock(&_mutex);
+                /* the message might have been evicted in the meantime */
+                if ((buf_msg->pkt != NULL) &&
+                    ((buf_msg->gen & GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK) ==
+                     (msg.type & GNRC_MPL_MSG_TYPE_TRICKLE_GEN_MASK))) {
+                    if (++buf_msg->expirations > GNRC_MPL_DATA_MESSAGE_TIMER_EXPIRATIONS) {
+                        DEBUG("mpl: message %u expired\n", (unsigned)buf_msg->seq);
+                        _msg_free(buf_msg);
+                    }
+                    else {
+                        trickle_callback(&buf_msg->trickle);
+                    }
+                }
+                mutex_unlock(&_mutex);
+                break;
+            }
+            default:
+                DEBUG("mpl: unknown message type %04x\n", msg.type);
+                break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @}
+ */
@@ -14,6 +14,7 @@
  * @author  Cenk Gündoğan <cnkgndgn@gmail.com>
  */
 
+#include "kernel_defines.h"
 #include "net/icmpv6.h"
 #include "net/ipv6.h"
 #include "net/gnrc/ipv6/netif.h"
@@ -26,6 +27,10 @@
 #include "net/gnrc/rpl/p2p_dodag.h"
 #endif
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+#include "net/gnrc/rpl/srh.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
@@ -120,6 +125,12 @@ gnrc_rpl_instance_t *gnrc_rpl_root_init(uint8_t instance_id, ipv6_addr_t *dodag_
     dodag->dio_opts |= GNRC_RPL_REQ_DIO_OPT_PREFIX_INFO;
 #endif
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+    if (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) {
+        gnrc_rpl_srh_root_init(dodag_id);
+    }
+#endif
+
     trickle_start(gnrc_rpl_pid, &dodag->trickle, GNRC_RPL_MSG_TYPE_TRICKLE_MSG,
                   (1 << dodag->dio_min), dodag->dio_interval_doubl,
                   dodag->dio_redun);
@@ -195,6 +206,21 @@ static void _receive(gnrc_pktsnip_t *icmpv6)
     gnrc_pktbuf_release(icmpv6);
 }
 
+/* all trickle timers of RPL belong to a DODAG */
+static void _trickle_callback(trickle_t *trickle)
+{
+    gnrc_rpl_dodag_t *dodag = container_of(trickle, gnrc_rpl_dodag_t, trickle);
+
+#ifdef MODULE_GNRC_RPL_ADAPTIVE_REDUN
+    gnrc_rpl_density_update(dodag);
+#endif
+    /* k = 0 is handled like k = infinity */
+    if ((trickle->k != 0) && (trickle->c >= trickle->k)) {
+        dodag->stats.dio_suppressed++;
+    }
+    trickle_callback(trickle);
+}
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
@@ -220,7 +246,7 @@ static void *_event_loop(void *args)
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_TRICKLE_MSG received\n");
                 trickle = msg.content.ptr;
                 if (trickle && (trickle->callback.func != NULL)) {
-                    trickle_callback(trickle);
+                    _trickle_callback(trickle);
                 }
                 break;
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -294,13 +320,29 @@ void _update_lifetime(void)
     xtimer_set_msg(&_lt_timer, _lt_time, &_lt_msg, gnrc_rpl_pid);
 }
 
-void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
+static void _schedule_dao(gnrc_rpl_dodag_t *dodag, uint8_t delay)
 {
-    dodag->dao_time = GNRC_RPL_DEFAULT_DAO_DELAY;
+    /* a DAO that is not sent yet and due within delay carries the change too */
+    if ((dodag->dao_counter == 0) && !dodag->dao_ack_received &&
+        (dodag->dao_time <= delay)) {
+        dodag->stats.dao_merged++;
+        return;
+    }
+    dodag->dao_time = delay;
     dodag->dao_counter = 0;
     dodag->dao_ack_received = false;
 }
 
+void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
+{
+    _schedule_dao(dodag, GNRC_RPL_DEFAULT_DAO_DELAY);
+}
+
+void gnrc_rpl_aggregate_dao(gnrc_rpl_dodag_t *dodag)
+{
+    _schedule_dao(dodag, GNRC_RPL_DAO_AGGREGATION_WINDOW);
+}
+
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
     dodag->dao_time = GNRC_RPL_REGULAR_DAO_INTERVAL;
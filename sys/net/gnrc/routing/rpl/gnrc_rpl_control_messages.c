@@ -32,6 +32,10 @@
 #include "gnrc_rpl_internal/validation.h"
 #endif
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+#include "net/gnrc/rpl/srh.h"
+#endif
+
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p_structs.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -52,6 +56,7 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #define GNRC_RPL_SHIFTED_MOP_MASK           (0x7)
 #define GNRC_RPL_PRF_MASK                   (0x7)
 #define GNRC_RPL_PREFIX_AUTO_ADDRESS_BIT    (1 << 6)
+#define GNRC_RPL_PREFIX_ROUTER_ADDRESS_BIT  (1 << 5)
 
 void gnrc_rpl_send(gnrc_pktsnip_t *pkt, kernel_pid_t iface, ipv6_addr_t *src, ipv6_addr_t *dst,
                    ipv6_addr_t *dodag_id)
@@ -141,19 +146,48 @@ gnrc_pktsnip_t *_dio_prefix_info_build(gnrc_pktsnip_t *pkt, gnrc_rpl_dodag_t *do
     prefix_info = opt_snip->data;
     prefix_info->type = GNRC_RPL_OPT_PREFIX_INFO;
     prefix_info->length = GNRC_RPL_OPT_PREFIX_INFO_LEN;
-    /* auto-address configuration */
-    prefix_info->LAR_flags = GNRC_RPL_PREFIX_AUTO_ADDRESS_BIT;
+    /* auto-address configuration, the prefix field carries the global
+     * address of this node (RFC 6550, section 6.7.10) */
+    prefix_info->LAR_flags = GNRC_RPL_PREFIX_AUTO_ADDRESS_BIT |
+                             GNRC_RPL_PREFIX_ROUTER_ADDRESS_BIT;
     prefix_info->valid_lifetime = dodag->netif_addr->valid;
     prefix_info->pref_lifetime = dodag->netif_addr->preferred;
     prefix_info->prefix_len = dodag->netif_addr->prefix_len;
     prefix_info->reserved = 0;
 
-    memset(&prefix_info->prefix, 0, sizeof(prefix_info->prefix));
-    ipv6_addr_init_prefix(&prefix_info->prefix, &dodag->dodag_id, dodag->netif_addr->prefix_len);
+    memcpy(&prefix_info->prefix, &dodag->netif_addr->addr, sizeof(prefix_info->prefix));
     return opt_snip;
 }
 #endif
 
+/* stores the global address a DIO sender advertises with the router address
+ * flag of a Prefix Information option. Must be called before
+ * _parse_options(), which overwrites the interface identifier of the prefix */
+static void _parent_global_addr(gnrc_rpl_parent_t *parent, gnrc_rpl_opt_t *opt, uint16_t len)
+{
+    uint16_t l = 0;
+
+    while ((l + sizeof(gnrc_rpl_opt_t)) <= len) {
+        if (opt->type == GNRC_RPL_OPT_PAD1) {
+            l += 1;
+            opt = (gnrc_rpl_opt_t *) (((uint8_t *) opt) + 1);
+            continue;
+        }
+        if ((opt->type == GNRC_RPL_OPT_PREFIX_INFO) &&
+            ((l + sizeof(gnrc_rpl_opt_prefix_info_t)) <= len)) {
+            gnrc_rpl_opt_prefix_info_t *pi = (gnrc_rpl_opt_prefix_info_t *) opt;
+
+            if ((pi->LAR_flags & GNRC_RPL_PREFIX_ROUTER_ADDRESS_BIT) &&
+                !ipv6_addr_is_link_local(&pi->prefix)) {
+                memcpy(&parent->global_addr, &pi->prefix, sizeof(ipv6_addr_t));
+                return;
+            }
+        }
+        l += opt->length + sizeof(gnrc_rpl_opt_t);
+        opt = (gnrc_rpl_opt_t *) (((uint8_t *) (opt + 1)) + opt->length);
+    }
+}
+
 void gnrc_rpl_send_DIO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
 {
     if (inst == NULL) {
@@ -225,6 +259,7 @@ void gnrc_rpl_send_DIO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
 #endif
 
     gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
+    dodag->stats.dio_sent++;
 }
 
 void gnrc_rpl_send_DIS(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
@@ -261,6 +296,9 @@ void gnrc_rpl_send_DIS(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
 #endif
 
     gnrc_rpl_send(pkt, KERNEL_PID_UNDEF, NULL, destination, (inst? &(inst->dodag.dodag_id) : NULL));
+    if (inst != NULL) {
+        inst->dodag.stats.dis_sent++;
+    }
 }
 
 void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src,
@@ -281,6 +319,7 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
     }
 #endif
 
+    /* a DIS is only counted by the instances that respond to it */
     if (ipv6_addr_is_multicast(dst)) {
         for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
             if ((gnrc_rpl_instances[i].state != 0)
@@ -292,6 +331,7 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
                     continue;
                 }
 #endif
+                gnrc_rpl_instances[i].dodag.stats.dis_received++;
                 trickle_reset_timer(&(gnrc_rpl_instances[i].dodag.trickle));
             }
         }
@@ -299,6 +339,7 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
     else {
         for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
             if (gnrc_rpl_instances[i].state != 0) {
+                gnrc_rpl_instances[i].dodag.stats.dis_received++;
                 gnrc_rpl_instances[i].dodag.dio_opts |= GNRC_RPL_REQ_DIO_OPT_DODAG_CONF;
                 gnrc_rpl_send_DIO(&gnrc_rpl_instances[i], src);
             }
@@ -306,9 +347,22 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
     }
 }
 
+/* checks if dst is routed over next_hop already */
+static bool _route_known(ipv6_addr_t *dst, ipv6_addr_t *next_hop)
+{
+    ipv6_addr_t hop;
+    size_t hop_size = sizeof(hop);
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    uint32_t hop_flags = 0;
+
+    return (fib_get_next_hop(&gnrc_ipv6_fib_table, &iface, hop.u8, &hop_size,
+                             &hop_flags, dst->u8, sizeof(ipv6_addr_t), 0) == 0) &&
+           ipv6_addr_equal(&hop, next_hop);
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt, uint16_t len,
-                    ipv6_addr_t *src, uint32_t *included_opts)
+                    ipv6_addr_t *src, uint32_t *included_opts, bool *routes_changed)
 {
     uint16_t l = 0;
     gnrc_rpl_opt_target_t *first_target = NULL;
@@ -393,6 +447,14 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                     first_target = target;
                 }
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+                /* the root of a non-storing mode DODAG uses source routes,
+                 * which are added with the transit information */
+                if (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) {
+                    break;
+                }
+#endif
+
                 uint32_t fib_dst_flags = 0;
 
                 if (target->prefix_length <= IPV6_ADDR_BIT_LEN) {
@@ -404,6 +466,11 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                       target->prefix_length,
                       fib_dst_flags);
 
+                if ((routes_changed != NULL) && !(*routes_changed) &&
+                    !_route_known(&target->target, src)) {
+                    *routes_changed = true;
+                }
+
                 fib_add_entry(&gnrc_ipv6_fib_table, dodag->iface, target->target.u8,
                               sizeof(ipv6_addr_t), fib_dst_flags, src->u8,
                               sizeof(ipv6_addr_t), FIB_FLAG_RPL_ROUTE,
@@ -421,6 +488,40 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                     break;
                 }
 
+                /* a No-Path removes the routes */
+                if ((routes_changed != NULL) && (transit->path_lifetime == 0)) {
+                    *routes_changed = true;
+                }
+
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+                if (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) {
+                    ipv6_addr_t *parent = (ipv6_addr_t *) (transit + 1);
+
+                    /* the validation may be compiled out, so check that the
+                     * parent address is within the option and the message */
+                    if ((opt->length < (GNRC_RPL_OPT_TRANSIT_INFO_LEN +
+                                        sizeof(ipv6_addr_t))) ||
+                        ((l + sizeof(gnrc_rpl_opt_t) + opt->length) > len)) {
+                        DEBUG("RPL: RPL TRANSIT INFO DAO option without parent "
+                              "address\n");
+                        first_target = NULL;
+                        break;
+                    }
+
+                    do {
+                        gnrc_rpl_srh_root_update(&first_target->target, parent,
+                                                 transit->path_lifetime *
+                                                 dodag->lifetime_unit);
+                        first_target = (gnrc_rpl_opt_target_t *) (((uint8_t *) (first_target)) +
+                                       sizeof(gnrc_rpl_opt_t) + first_target->length);
+                    }
+                    while (first_target->type == GNRC_RPL_OPT_TARGET);
+
+                    first_target = NULL;
+                    break;
+                }
+#endif
+
                 do {
                     DEBUG("RPL: updating fib entry %s/%d\n",
                           ipv6_addr_to_str(addr_str, &(first_target->target), sizeof(addr_str)),
@@ -493,6 +594,10 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
         gnrc_rpl_dodag_init(inst, &dio->dodag_id, iface, NULL);
 
         dodag = &inst->dodag;
+        dodag->stats.dio_received++;
+#ifdef MODULE_GNRC_RPL_ADAPTIVE_REDUN
+        gnrc_rpl_density_heard(dodag, src);
+#endif
 
         DEBUG("RPL: Joined DODAG (%s).\n",
                ipv6_addr_to_str(addr_str, &dio->dodag_id, sizeof(addr_str)));
@@ -510,10 +615,11 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
         dodag->prf = dio->g_mop_prf & GNRC_RPL_PRF_MASK;
 
         parent->rank = byteorder_ntohs(dio->rank);
+        _parent_global_addr(parent, (gnrc_rpl_opt_t *)(dio + 1), len);
 
         uint32_t included_opts = 0;
         if(!_parse_options(GNRC_RPL_ICMPV6_CODE_DIO, inst, (gnrc_rpl_opt_t *)(dio + 1), len,
-                           src, &included_opts)) {
+                           src, &included_opts, NULL)) {
             DEBUG("RPL: Error encountered during DIO option parsing - remove DODAG\n");
             gnrc_rpl_instance_remove(inst);
             return;
@@ -573,6 +679,11 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
             DEBUG("RPL: DIO received from another DODAG, but same instance - ignore\n");
             return;
         }
+
+        dodag->stats.dio_received++;
+#ifdef MODULE_GNRC_RPL_ADAPTIVE_REDUN
+        gnrc_rpl_density_heard(dodag, src);
+#endif
     }
 
     if (inst->mop != ((dio->g_mop_prf >> GNRC_RPL_MOP_SHIFT) & GNRC_RPL_SHIFTED_MOP_MASK)) {
@@ -626,6 +737,7 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
     assert(parent != NULL);
 
     parent->rank = byteorder_ntohs(dio->rank);
+    _parent_global_addr(parent, (gnrc_rpl_opt_t *)(dio + 1), len);
 
     gnrc_rpl_parent_update(dodag, parent);
 
@@ -648,7 +760,7 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
         dodag->prf = dio->g_mop_prf & GNRC_RPL_PRF_MASK;
         uint32_t included_opts = 0;
         if(!_parse_options(GNRC_RPL_ICMPV6_CODE_DIO, inst, (gnrc_rpl_opt_t *)(dio + 1), len,
-                           src, &included_opts)) {
+                           src, &included_opts, NULL)) {
             DEBUG("RPL: Error encountered during DIO option parsing - remove DODAG\n");
             gnrc_rpl_instance_remove(inst);
             return;
@@ -675,12 +787,18 @@ gnrc_pktsnip_t *_dao_target_build(gnrc_pktsnip_t *pkt, ipv6_addr_t *addr, uint8_
     return opt_snip;
 }
 
-gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool external)
+gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool external,
+                                   ipv6_addr_t *parent)
 {
     gnrc_rpl_opt_transit_t *transit;
     gnrc_pktsnip_t *opt_snip;
-    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_opt_transit_t),
-                               GNRC_NETTYPE_UNDEF)) == NULL) {
+    size_t size = sizeof(gnrc_rpl_opt_transit_t);
+
+    /* the parent address is only included in non-storing mode */
+    if (parent != NULL) {
+        size += sizeof(ipv6_addr_t);
+    }
+    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, size, GNRC_NETTYPE_UNDEF)) == NULL) {
         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
         gnrc_pktbuf_release(pkt);
         return NULL;
@@ -693,6 +811,10 @@ gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool e
     transit->path_control = 0;
     transit->path_sequence = 0;
     transit->path_lifetime = lifetime;
+    if (parent != NULL) {
+        transit->length += sizeof(ipv6_addr_t);
+        memcpy(transit + 1, parent, sizeof(ipv6_addr_t));
+    }
     return opt_snip;
 }
 
@@ -717,13 +839,19 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     }
 #endif
 
-    if (destination == NULL) {
+    /* in non-storing mode DAOs are sent to the root and carry the address
+     * of the parent */
+    bool storing = (inst->mop != GNRC_RPL_MOP_NON_STORING_MODE);
+
+    if ((destination == NULL) || !storing) {
         if (dodag->parents == NULL) {
             DEBUG("RPL: dodag has no preferred parent\n");
             return;
         }
+    }
 
-        destination = &(dodag->parents->addr);
+    if (destination == NULL) {
+        destination = (storing) ? &(dodag->parents->addr) : &dodag->dodag_id;
     }
 
     gnrc_pktsnip_t *pkt = NULL, **ptr = NULL,  *tmp = NULL, *tr_int = NULL;
@@ -738,17 +866,37 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         return;
     }
 
+    if (!storing) {
+        /* the root is known by the DODAG ID, other parents by the address
+         * they advertised in their DIOs */
+        ipv6_addr_t *parent = &dodag->parents->global_addr;
+
+        if (dodag->parents->rank == GNRC_RPL_ROOT_RANK) {
+            parent = &dodag->dodag_id;
+        }
+        else if (ipv6_addr_is_unspecified(parent)) {
+            DEBUG("RPL: Send DAO - global address of parent unknown\n");
+            return;
+        }
+        DEBUG("RPL: Send DAO - building transit with parent %s\n",
+              ipv6_addr_to_str(addr_str, parent, sizeof(addr_str)));
+        if ((pkt = _dao_transit_build(NULL, lifetime, false, parent)) == NULL) {
+            return;
+        }
+    }
+
     mutex_lock(&(gnrc_ipv6_fib_table.mtx_access));
 
-    /* add external and RPL FIB entries */
-    for (size_t i = 0; i < gnrc_ipv6_fib_table.size; ++i) {
+    /* add external and RPL FIB entries, only the own address is announced in
+     * non-storing mode */
+    for (size_t i = 0; storing && (i < gnrc_ipv6_fib_table.size); ++i) {
         fib_entry_t *fentry = &gnrc_ipv6_fib_table.data.entries[i];
         if (fentry->lifetime != 0) {
             if (!(fentry->next_hop_flags & FIB_FLAG_RPL_ROUTE)) {
                 ptr = &tmp;
                 if (!ext_processed) {
                     DEBUG("RPL: Send DAO - building external transit\n");
-                    if ((tmp = _dao_transit_build(NULL, lifetime, true)) == NULL) {
+                    if ((tmp = _dao_transit_build(NULL, lifetime, true, NULL)) == NULL) {
                         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
                         mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
                         return;
@@ -760,7 +908,7 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
                 ptr = &pkt;
                 if (!int_processed) {
                     DEBUG("RPL: Send DAO - building internal transit\n");
-                    if ((tr_int = pkt = _dao_transit_build(NULL, lifetime, false)) == NULL) {
+                    if ((tr_int = pkt = _dao_transit_build(NULL, lifetime, false, NULL)) == NULL) {
                         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
                         mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
                         return;
@@ -790,7 +938,7 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     if (tr_int) {
         tr_int->next = tmp;
     }
-    else {
+    else if (storing) {
         pkt = tmp;
     }
 
@@ -848,7 +996,9 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
                              (destination && !ipv6_addr_is_multicast(destination)));
 #endif
 
-    gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
+    /* a DAO to the root may travel several hops */
+    gnrc_rpl_send(pkt, dodag->iface, (storing) ? NULL : me, destination, &dodag->dodag_id);
+    dodag->stats.dao_sent++;
 
     GNRC_RPL_COUNTER_INCREMENT(dodag->dao_seq);
 }
@@ -901,6 +1051,7 @@ void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination,
 #endif
 
     gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
+    dodag->stats.dao_ack_sent++;
 }
 
 void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src, ipv6_addr_t *dst,
@@ -956,7 +1107,10 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
 #endif
 
     uint32_t included_opts = 0;
-    if(!_parse_options(GNRC_RPL_ICMPV6_CODE_DAO, inst, opts, len, src, &included_opts)) {
+    bool routes_changed = false;
+    dodag->stats.dao_received++;
+    if(!_parse_options(GNRC_RPL_ICMPV6_CODE_DAO, inst, opts, len, src, &included_opts,
+                       &routes_changed)) {
         DEBUG("RPL: Error encountered during DAO option parsing - ignore DAO\n");
         return;
     }
@@ -966,7 +1120,15 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
         gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
     }
 
-    gnrc_rpl_delay_dao(dodag);
+    /* refreshed routes are announced with the next regular DAO, which is sent
+     * well within the route lifetime, so only changes are sent upwards now */
+    if (routes_changed) {
+        gnrc_rpl_aggregate_dao(dodag);
+    }
+    else {
+        DEBUG("RPL: DAO changed no route - no DAO triggered\n");
+        dodag->stats.dao_suppressed++;
+    }
 }
 
 void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6_addr_t *src,
@@ -1006,6 +1168,8 @@ void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6
         }
     }
 
+    dodag->stats.dao_ack_received++;
+
     if ((dao_ack->status != 0) && (dao_ack->dao_sequence != dodag->dao_seq)) {
         DEBUG("RPL: DAO-ACK sequence (%d) does not match expected sequence (%d)\n",
                 dao_ack->dao_sequence, dodag->dao_seq);
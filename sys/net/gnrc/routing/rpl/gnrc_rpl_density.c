@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * Neighbors are kept as a hash of their IID and the number of trickle
+ * intervals since their last DIO. A hash collision only makes the number of
+ * neighbors too small, which keeps the redundancy constant on the safe side.
+ */
+
+#include <string.h>
+
+#include "net/gnrc/rpl.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   A neighbor of a DODAG
+ */
+typedef struct {
+    uint16_t id;    /**< hash of the IID of the neighbor, 0 if unused */
+    uint8_t age;    /**< trickle intervals since the last DIO of the neighbor */
+} _nb_t;
+
+static _nb_t _nbs[GNRC_RPL_INSTANCES_NUMOF][GNRC_RPL_DENSITY_NUMOF];
+
+static inline _nb_t *_get_nbs(gnrc_rpl_dodag_t *dodag)
+{
+    return _nbs[dodag->instance - gnrc_rpl_instances];
+}
+
+static uint16_t _id(const ipv6_addr_t *addr)
+{
+    uint16_t id = addr->u16[4].u16 ^ addr->u16[5].u16 ^ addr->u16[6].u16 ^
+                  addr->u16[7].u16;
+
+    return (id == 0) ? 1 : id;
+}
+
+void gnrc_rpl_density_reset(gnrc_rpl_dodag_t *dodag)
+{
+    memset(_get_nbs(dodag), 0, sizeof(_nbs[0]));
+}
+
+void gnrc_rpl_density_heard(gnrc_rpl_dodag_t *dodag, const ipv6_addr_t *src)
+{
+    _nb_t *nbs = _get_nbs(dodag), *nb = NULL;
+    uint16_t id = _id(src);
+
+    for (unsigned i = 0; i < GNRC_RPL_DENSITY_NUMOF; i++) {
+        if (nbs[i].id == id) {
+            nb = &nbs[i];
+            break;
+        }
+        /* otherwise replace a free entry or the neighbor heard least
+         * recently */
+        if ((nb == NULL) || ((nb->id != 0) &&
+                             ((nbs[i].id == 0) || (nbs[i].age > nb->age)))) {
+            nb = &nbs[i];
+        }
+    }
+    nb->id = id;
+    nb->age = 0;
+}
+
+void gnrc_rpl_density_update(gnrc_rpl_dodag_t *dodag)
+{
+    _nb_t *nbs = _get_nbs(dodag);
+    unsigned num = 0, k;
+
+    for (unsigned i = 0; i < GNRC_RPL_DENSITY_NUMOF; i++) {
+        if (nbs[i].id == 0) {
+            continue;
+        }
+        if (++nbs[i].age > GNRC_RPL_DENSITY_WINDOW) {
+            nbs[i].id = 0;
+        }
+        else {
+            num++;
+        }
+    }
+    if (dodag->dio_redun == 0) {
+        return;
+    }
+    k = (num + GNRC_RPL_DENSITY_PER_REDUN - 1) / GNRC_RPL_DENSITY_PER_REDUN;
+    if (k < GNRC_RPL_DENSITY_REDUN_MIN) {
+        k = GNRC_RPL_DENSITY_REDUN_MIN;
+    }
+    if (k > dodag->dio_redun) {
+        k = dodag->dio_redun;
+    }
+    if (dodag->trickle.k != k) {
+        DEBUG("RPL: %u neighbors, redundancy constant %u\n", num, k);
+        dodag->trickle.k = k;
+    }
+}
+
+unsigned gnrc_rpl_density_get(gnrc_rpl_dodag_t *dodag)
+{
+    _nb_t *nbs = _get_nbs(dodag);
+    unsigned num = 0;
+
+    for (unsigned i = 0; i < GNRC_RPL_DENSITY_NUMOF; i++) {
+        if (nbs[i].id != 0) {
+            num++;
+        }
+    }
+    return num;
+}
+
+/** @} */
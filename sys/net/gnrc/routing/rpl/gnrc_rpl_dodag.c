@@ -16,6 +16,7 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/netif.h"
@@ -152,9 +153,14 @@ bool gnrc_rpl_dodag_init(gnrc_rpl_instance_t *instance, ipv6_addr_t *dodag_id, k
     dodag->dtsn = 0;
     dodag->dao_ack_received = false;
     dodag->dao_counter = 0;
+    memset(&dodag->stats, 0, sizeof(dodag->stats));
     dodag->instance = instance;
     dodag->iface = iface;
     dodag->netif_addr = netif_addr;
+#ifdef MODULE_GNRC_RPL_ADAPTIVE_REDUN
+    /* the neighbors are looked up by the instance of the DODAG */
+    gnrc_rpl_density_reset(dodag);
+#endif
 
 #ifdef MODULE_GNRC_RPL_P2P
     if ((instance->mop == GNRC_RPL_P2P_MOP) && (gnrc_rpl_p2p_ext_new(dodag) == NULL)) {
@@ -247,6 +253,11 @@ void gnrc_rpl_local_repair(gnrc_rpl_dodag_t *dodag)
 
     dodag->dtsn++;
 
+    /* the local repair poisons the rank */
+    if (dodag->my_rank != GNRC_RPL_INFINITE_RANK) {
+        dodag->stats.rank_changes++;
+    }
+
     if (dodag->parents) {
         gnrc_rpl_dodag_remove_all_parents(dodag);
         fib_remove_entry(&gnrc_ipv6_fib_table,
@@ -310,6 +321,13 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
     }
 
     LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
+    /* the objective function may keep the current preferred parent, even if
+     * another one is slightly better (e.g. the hysteresis of MRHOF) */
+    if ((old_best != dodag->parents) &&
+        (dodag->instance->of->which_parent(old_best, dodag->parents) == old_best)) {
+        LL_DELETE(dodag->parents, old_best);
+        LL_PREPEND(dodag->parents, old_best);
+    }
     new_best = dodag->parents;
 
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
@@ -317,6 +335,7 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
     }
 
     if (new_best != old_best) {
+        dodag->stats.parent_switches++;
         /* no-path DAOs only for the storing mode */
         if ((dodag->instance->mop == GNRC_RPL_MOP_STORING_MODE_NO_MC) ||
             (dodag->instance->mop == GNRC_RPL_MOP_STORING_MODE_MC)) {
@@ -344,6 +363,7 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
 
     dodag->my_rank = dodag->instance->of->calc_rank(dodag->parents, 0);
     if (dodag->my_rank != old_rank) {
+        dodag->stats.rank_changes++;
         trickle_reset_timer(&dodag->trickle);
     }
 
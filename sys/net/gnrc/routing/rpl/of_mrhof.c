@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function.
+ *
+ * Implementation of MRHOF (RFC 6719) with the ETX metric. The ETX of the link
+ * to a parent is taken from @ref net_netstats_neighbor, which is fed with the
+ * transmission outcomes reported by the device. The path cost, and hence the
+ * rank, over a parent is the rank of the parent plus the ETX of the link
+ * scaled to the MinHopRankIncrease, so with perfect links MRHOF and OF0 form
+ * the same DODAG.
+ *
+ * @}
+ */
+
+#include "of_mrhof.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static uint16_t calc_rank(gnrc_rpl_parent_t *, uint16_t);
+static gnrc_rpl_parent_t *which_parent(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
+static void reset(gnrc_rpl_dodag_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    0x1,
+    calc_rank,
+    which_parent,
+    parent_cmp,
+    which_dodag,
+    reset,
+    NULL,
+    NULL,
+    NULL
+};
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    /* the link metrics are kept by netstats_neighbor */
+    (void) dodag;
+}
+
+/* scales a value in ETX units to rank units */
+static inline uint32_t _to_rank(gnrc_rpl_parent_t *parent, uint32_t etx)
+{
+    return (etx * parent->dodag->instance->min_hop_rank_inc) /
+           NETSTATS_NB_ETX_DIVISOR;
+}
+
+static uint16_t _link_etx(gnrc_rpl_parent_t *parent)
+{
+    /* parents are known by their link-local address, which carries the IID
+     * of their link layer address */
+    return netstats_nb_etx(parent->dodag->iface,
+                           (eui64_t *)&parent->addr.u64[1]);
+}
+
+static uint16_t _path_cost(gnrc_rpl_parent_t *parent)
+{
+    uint16_t etx;
+    uint32_t cost;
+
+    if (parent->rank == GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    etx = _link_etx(parent);
+    if (etx > GNRC_RPL_MRHOF_MAX_LINK_METRIC) {
+        DEBUG("RPL: MRHOF excludes parent with ETX %u/%u\n", etx,
+              NETSTATS_NB_ETX_DIVISOR);
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    cost = parent->rank + _to_rank(parent, etx);
+    if (cost >= GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return cost;
+}
+
+uint16_t calc_rank(gnrc_rpl_parent_t *parent, uint16_t base_rank)
+{
+    uint32_t add;
+
+    if (base_rank == 0) {
+        if (parent == NULL) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+
+        return _path_cost(parent);
+    }
+
+    if (parent != NULL) {
+        add = _to_rank(parent, _link_etx(parent));
+    }
+    else {
+        add = GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE;
+    }
+
+    if ((base_rank + add) >= GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    return base_rank + add;
+}
+
+/* p1 is the current preferred parent: only switch to p2 if its path cost is
+ * smaller by more than the switch threshold, so the DODAG does not churn
+ * because of small variations of the ETX */
+gnrc_rpl_parent_t *which_parent(gnrc_rpl_parent_t *p1, gnrc_rpl_parent_t *p2)
+{
+    uint16_t cost1 = _path_cost(p1);
+    uint16_t cost2 = _path_cost(p2);
+
+    if (cost1 == GNRC_RPL_INFINITE_RANK) {
+        return (cost2 < cost1) ? p2 : p1;
+    }
+    if ((cost2 + _to_rank(p1, GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD)) < cost1) {
+        DEBUG("RPL: MRHOF switches parent (path cost %u -> %u)\n", cost1, cost2);
+        return p2;
+    }
+    return p1;
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    uint16_t cost1 = _path_cost(parent1);
+    uint16_t cost2 = _path_cost(parent2);
+
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+/* Not used yet */
+gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dodag_t *d2)
+{
+    (void) d2;
+    return d1;
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * The root keeps the parent of every node and builds the source route to a
+ * node by following the parents up to itself. Since the root sends most
+ * packets to a few destinations, the built headers are cached. Any change of
+ * a parent increments the generation of the routes, which invalidates all
+ * cached headers.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/gnrc/rpl/srh.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if ENABLE_DEBUG
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+#endif
+
+/**
+ * @brief   Prefix octets elided from an address at most (4 bit field)
+ */
+#define COMPR_MAX       (15U)
+
+/**
+ * @brief   Parent of a node
+ */
+typedef struct {
+    ipv6_addr_t target;     /**< address of the node */
+    ipv6_addr_t parent;     /**< address of its parent */
+    uint32_t expires;       /**< expiry of the route in seconds,
+                             *   0 if the entry is unused */
+} _route_t;
+
+/**
+ * @brief   Built source routing header
+ */
+typedef struct {
+    ipv6_addr_t dst;        /**< destination of the route */
+    ipv6_addr_t first_hop;  /**< first hop of the route */
+    uint32_t expires;       /**< first expiry of a route on the path */
+    uint16_t gen;           /**< generation the header was built in */
+    uint8_t valid;          /**< the entry is in use */
+    uint8_t len;            /**< length of the header in hdr */
+    uint8_t hdr[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];  /**< the header */
+} _cache_t;
+
+static _route_t _routes[GNRC_RPL_SRH_ROOT_NUMOF];
+static _cache_t _cache[GNRC_RPL_SRH_ROOT_CACHE_SIZE];
+static ipv6_addr_t _root;
+static uint16_t _gen;
+static uint8_t _cache_next;
+static mutex_t _mutex = MUTEX_INIT;
+
+static inline uint32_t _now(void)
+{
+    /* start at 1 so 0 marks unused entries */
+    return (uint32_t)(xtimer_now_usec64() / US_PER_SEC) + 1;
+}
+
+static _route_t *_find(const ipv6_addr_t *target)
+{
+    for (unsigned i = 0; i < GNRC_RPL_SRH_ROOT_NUMOF; i++) {
+        if ((_routes[i].expires != 0) &&
+            ipv6_addr_equal(&_routes[i].target, target)) {
+            return &_routes[i];
+        }
+    }
+    return NULL;
+}
+
+static inline uint8_t _compr(const ipv6_addr_t *a, const ipv6_addr_t *b)
+{
+    uint8_t res = ipv6_addr_match_prefix(a, b) / 8;
+
+    return (res > COMPR_MAX) ? COMPR_MAX : res;
+}
+
+/* fills path with the hops from dst (path[0]) up to a child of the root */
+static int _path(const ipv6_addr_t *dst, const ipv6_addr_t **path,
+                 uint32_t *expires, uint32_t now)
+{
+    const ipv6_addr_t *cur = dst;
+    int hops = 0;
+
+    *expires = UINT32_MAX;
+    while (hops < (int)GNRC_RPL_SRH_ROOT_MAX_HOPS) {
+        _route_t *route = _find(cur);
+
+        if (route == NULL) {
+            return -ENOENT;
+        }
+        if (route->expires <= now) {
+            DEBUG("RPL SRH root: route to %s expired\n",
+                  ipv6_addr_to_str(addr_str, cur, sizeof(addr_str)));
+            route->expires = 0;
+            _gen++;
+            return -ENOENT;
+        }
+        if (route->expires < *expires) {
+            *expires = route->expires;
+        }
+        path[hops++] = &route->target;
+        if (ipv6_addr_equal(&route->parent, &_root)) {
+            return hops;
+        }
+        for (int i = 0; i < hops; i++) {
+            if (ipv6_addr_equal(&route->parent, path[i])) {
+                DEBUG("RPL SRH root: loop in route to %s\n",
+                      ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+                return -ENOENT;
+            }
+        }
+        cur = &route->parent;
+    }
+    return -ENOENT;
+}
+
+/* builds the header for the path from the root down to path[0], returns its
+ * length */
+static int _build(_cache_t *entry, const ipv6_addr_t **path, int hops)
+{
+    gnrc_rpl_srh_t *srh = (gnrc_rpl_srh_t *)entry->hdr;
+    uint8_t *addr_vec = (uint8_t *)(srh + 1);
+    /* the header contains all hops but the first one (path[hops - 1]), which
+     * is the destination of the IPv6 header */
+    unsigned n = hops - 1;
+    uint8_t compr_i, compr_e, pad;
+    unsigned len;
+
+    entry->first_hop = *path[hops - 1];
+    if (n == 0) {
+        return 0;
+    }
+    /* every address is expanded with the prefix of the destination address
+     * of the IPv6 header, i.e. the previous hop */
+    compr_e = _compr(path[0], path[1]);
+    compr_i = (n > 1) ? COMPR_MAX : compr_e;
+    for (unsigned i = 1; i < n; i++) {
+        uint8_t compr = _compr(path[i], path[i + 1]);
+
+        if (compr < compr_i) {
+            compr_i = compr;
+        }
+    }
+    len = sizeof(gnrc_rpl_srh_t) + ((n - 1) * (sizeof(ipv6_addr_t) - compr_i)) +
+          (sizeof(ipv6_addr_t) - compr_e);
+    pad = (8 - (len & 0x7)) & 0x7;
+    memset(srh, 0, len + pad);
+    srh->len = (len + pad - 8) / 8;
+    srh->type = GNRC_RPL_SRH_TYPE;
+    srh->seg_left = n;
+    srh->compr = (compr_i << 4) | compr_e;
+    srh->pad_resv = pad << 4;
+    for (unsigned i = 1; i < n; i++) {
+        /* path[n - 1] is the second hop and the first address */
+        memcpy(addr_vec, &path[n - i]->u8[compr_i], sizeof(ipv6_addr_t) - compr_i);
+        addr_vec += sizeof(ipv6_addr_t) - compr_i;
+    }
+    memcpy(addr_vec, &path[0]->u8[compr_e], sizeof(ipv6_addr_t) - compr_e);
+    return len + pad;
+}
+
+void gnrc_rpl_srh_root_init(const ipv6_addr_t *root)
+{
+    mutex_lock(&_mutex);
+    _root = *root;
+    memset(_routes, 0, sizeof(_routes));
+    memset(_cache, 0, sizeof(_cache));
+    _gen++;
+    mutex_unlock(&_mutex);
+}
+
+int gnrc_rpl_srh_root_update(const ipv6_addr_t *target,
+                             const ipv6_addr_t *parent, uint32_t lifetime)
+{
+    _route_t *route;
+    uint32_t now;
+
+    if (lifetime == 0) {
+        gnrc_rpl_srh_root_remove(target);
+        return 0;
+    }
+    now = _now();
+    mutex_lock(&_mutex);
+    if ((route = _find(target)) == NULL) {
+        for (unsigned i = 0; i < GNRC_RPL_SRH_ROOT_NUMOF; i++) {
+            if ((_routes[i].expires == 0) || (_routes[i].expires <= now)) {
+                route = &_routes[i];
+                route->target = *target;
+                break;
+            }
+        }
+        if (route == NULL) {
+            mutex_unlock(&_mutex);
+            DEBUG("RPL SRH root: no space left for %s\n",
+                  ipv6_addr_to_str(addr_str, target, sizeof(addr_str)));
+            return -ENOMEM;
+        }
+        _gen++;
+    }
+    else if (!ipv6_addr_equal(&route->parent, parent)) {
+        _gen++;
+    }
+    DEBUG("RPL SRH root: parent of %s ",
+          ipv6_addr_to_str(addr_str, target, sizeof(addr_str)));
+    DEBUG("is %s\n", ipv6_addr_to_str(addr_str, parent, sizeof(addr_str)));
+    route->parent = *parent;
+    route->expires = ((UINT32_MAX - now) > lifetime) ? (now + lifetime) :
+                     UINT32_MAX;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_rpl_srh_root_remove(const ipv6_addr_t *target)
+{
+    _route_t *route;
+
+    mutex_lock(&_mutex);
+    if ((route = _find(target)) != NULL) {
+        DEBUG("RPL SRH root: remove route to %s\n",
+              ipv6_addr_to_str(addr_str, target, sizeof(addr_str)));
+        route->expires = 0;
+        _gen++;
+    }
+    mutex_unlock(&_mutex);
+}
+
+int gnrc_rpl_srh_root_get(const ipv6_addr_t *dst, ipv6_addr_t *first_hop,
+                          void *srh, size_t srh_len)
+{
+    const ipv6_addr_t *path[GNRC_RPL_SRH_ROOT_MAX_HOPS];
+    _cache_t *entry = NULL;
+    uint32_t now = _now();
+    int res;
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < GNRC_RPL_SRH_ROOT_CACHE_SIZE; i++) {
+        if (_cache[i].valid && ipv6_addr_equal(&_cache[i].dst, dst)) {
+            entry = &_cache[i];
+            break;
+        }
+    }
+    if ((entry == NULL) || (entry->gen != _gen) || (entry->expires <= now)) {
+        uint32_t expires;
+
+        if ((res = _path(dst, path, &expires, now)) < 0) {
+            if (entry != NULL) {
+                entry->valid = 0;
+            }
+            mutex_unlock(&_mutex);
+            return res;
+        }
+        if (entry == NULL) {
+            entry = &_cache[_cache_next];
+            _cache_next = (_cache_next + 1) % GNRC_RPL_SRH_ROOT_CACHE_SIZE;
+        }
+        DEBUG("RPL SRH root: build route with %d hops to %s\n", res,
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        entry->dst = *dst;
+        entry->len = _build(entry, path, res);
+        entry->expires = expires;
+        entry->gen = _gen;
+        entry->valid = 1;
+    }
+    if (entry->len > srh_len) {
+        mutex_unlock(&_mutex);
+        return -ENOBUFS;
+    }
+    *first_hop = entry->first_hop;
+    memcpy(srh, entry->hdr, entry->len);
+    res = entry->len;
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+/** @} */
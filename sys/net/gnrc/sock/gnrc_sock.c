@@ -19,6 +19,9 @@
 #include "net/ipv6/hdr.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/ipv6/netif.h"
+#ifdef MODULE_GNRC_IPV6_PMTU
+#include "net/gnrc/ipv6/pmtu.h"
+#endif
 #include "net/gnrc/netreg.h"
 #include "net/udp.h"
 #include "utlist.h"
@@ -44,10 +47,33 @@ static void _callback_put(void *arg)
 }
 #endif
 
+#ifdef MODULE_GNRC_SOCK_ASYNC
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    msg_t msg = { .type = cmd, .content = { .ptr = pkt } };
+    gnrc_sock_reg_t *reg = ctx;
+
+    /* the packet is queued as without callbacks, the callback only notifies
+     * the sock */
+    if ((cmd != GNRC_NETAPI_MSG_TYPE_RCV) ||
+        (mbox_try_put(&reg->mbox, &msg) < 1)) {
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    reg->async_cb(reg, SOCK_ASYNC_MSG_RECV);
+}
+#endif
+
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    reg->netreg_cb.cb = _netapi_cb;
+    reg->netreg_cb.ctx = reg;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
@@ -128,6 +154,16 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
             ipv6_hdr_t *hdr;
+#ifdef MODULE_GNRC_IPV6_PMTU
+            uint16_t pmtu = gnrc_ipv6_pmtu_get((ipv6_addr_t *)&remote->addr.ipv6);
+
+            /* GNRC does not fragment IPv6 packets, so the packet would not
+             * make it through the path anyway */
+            if ((pmtu > 0) && ((payload_len + sizeof(ipv6_hdr_t)) > pmtu)) {
+                gnrc_pktbuf_release(payload);
+                return -EMSGSIZE;
+            }
+#endif
             pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
                                       (ipv6_addr_t *)&remote->addr.ipv6);
             if (pkt == NULL) {
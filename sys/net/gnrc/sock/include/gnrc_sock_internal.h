@@ -24,6 +24,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/gnrc.h"
@@ -57,14 +58,6 @@ extern "C" {
  */
 #define GNRC_SOCK_DYN_PORTRANGE_ERR (0)
 
-/**
- * @brief   Offset for next dynamic port
- *
- * Currently set to a static (prime) offset, but could be random, too
- * see https://tools.ietf.org/html/rfc6056#section-3.3.3
- */
-#define GNRC_SOCK_DYN_PORTRANGE_OFF (17U)
-
 /**
  * @brief   Internal helper functions for GNRC
  * @internal
@@ -96,6 +89,33 @@ static inline bool gnrc_ep_addr_any(const sock_ip_ep_t *ep)
     return true;
 }
 
+/**
+ * @brief   Gets the sock a @ref net_gnrc_netreg entry was registered by
+ * @internal
+ *
+ * @return  The registration containing @p entry.
+ * @return  NULL, if @p entry was not registered by a sock.
+ */
+static inline gnrc_sock_reg_t *gnrc_sock_reg_from_entry(gnrc_netreg_entry_t *entry)
+{
+    gnrc_sock_reg_t *reg;
+
+    /* only the address of reg->entry is calculated, so entries of other users
+     * can be checked safely */
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    if (entry->type != GNRC_NETREG_TYPE_CB) {
+        return NULL;
+    }
+    reg = container_of(entry->target.cbd, gnrc_sock_reg_t, netreg_cb);
+#else
+    if (entry->type != GNRC_NETREG_TYPE_MBOX) {
+        return NULL;
+    }
+    reg = container_of(entry->target.mbox, gnrc_sock_reg_t, mbox);
+#endif
+    return (&reg->entry == entry) ? reg : NULL;
+}
+
 /**
  * @brief   Create a sock internally
  * @internal
@@ -31,6 +31,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_GNRC_SOCK_ASYNC
+#include "net/sock/async/types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,12 +48,16 @@ extern "C" {
  * @internal
  */
 typedef struct gnrc_sock_reg {
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    struct gnrc_sock_reg *next;         /**< list-like for internal storage */
-#endif
     gnrc_netreg_entry_t entry;          /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                        /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[SOCK_MBOX_SIZE];   /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(MODULE_GNRC_SOCK_ASYNC) || defined(DOXYGEN)
+    gnrc_netreg_entry_cbd_t netreg_cb;  /**< callback of gnrc_sock_reg_t::entry */
+    /**
+     * @brief   Calls the event callback of the sock
+     */
+    void (*async_cb)(struct gnrc_sock_reg *reg, sock_async_flags_t flags);
+#endif
 } gnrc_sock_reg_t;
 
 /**
@@ -61,6 +68,10 @@ struct sock_ip {
     gnrc_sock_reg_t reg;                /**< netreg info */
     sock_ip_ep_t local;                 /**< local end-point */
     sock_ip_ep_t remote;                /**< remote end-point */
+#if defined(MODULE_GNRC_SOCK_ASYNC) || defined(DOXYGEN)
+    sock_ip_cb_t async_cb;              /**< event callback */
+    void *async_cb_arg;                 /**< argument of sock_ip::async_cb */
+#endif
     uint16_t flags;                     /**< option flags */
 };
 
@@ -72,6 +83,10 @@ struct sock_udp {
     gnrc_sock_reg_t reg;                /**< netreg info */
     sock_udp_ep_t local;                /**< local end-point */
     sock_udp_ep_t remote;               /**< remote end-point */
+#if defined(MODULE_GNRC_SOCK_ASYNC) || defined(DOXYGEN)
+    sock_udp_cb_t async_cb;             /**< event callback */
+    void *async_cb_arg;                 /**< argument of sock_udp::async_cb */
+#endif
     uint16_t flags;                     /**< option flags */
 };
 
@@ -18,6 +18,7 @@
 #include <errno.h>
 
 #include "byteorder.h"
+#include "irq.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -26,6 +27,22 @@
 
 #include "gnrc_sock_internal.h"
 
+#ifdef MODULE_GNRC_SOCK_ASYNC
+static void _async_cb(gnrc_sock_reg_t *reg, sock_async_flags_t flags)
+{
+    sock_ip_t *sock = (sock_ip_t *)reg;
+    /* callback and argument are set together by sock_ip_set_cb() */
+    unsigned state = irq_disable();
+    sock_ip_cb_t cb = sock->async_cb;
+    void *arg = sock->async_cb_arg;
+
+    irq_restore(state);
+    if (cb != NULL) {
+        cb(sock, flags, arg);
+    }
+}
+#endif
+
 int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
                    const sock_ip_ep_t *remote, uint8_t proto, uint16_t flags)
 {
@@ -53,6 +70,10 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
         }
         memcpy(&sock->remote, remote, sizeof(sock_ip_ep_t));
     }
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    sock->async_cb = NULL;
+    sock->reg.async_cb = _async_cb;
+#endif
     gnrc_sock_create(&sock->reg, GNRC_NETTYPE_IPV6,
                      proto);
     sock->flags = flags;
@@ -192,7 +213,25 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     if (res <= 0) {
         return res;
     }
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    if (sock != NULL) {
+        _async_cb(&sock->reg, SOCK_ASYNC_MSG_SENT);
+    }
+#endif
     return res;
 }
 
+#ifdef MODULE_GNRC_SOCK_ASYNC
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *arg)
+{
+    assert(sock != NULL);
+    /* the network stack may call the callback in between */
+    unsigned state = irq_disable();
+
+    sock->async_cb = cb;
+    sock->async_cb_arg = arg;
+    irq_restore(state);
+}
+#endif
+
 /** @} */
@@ -18,71 +18,91 @@
 #include <errno.h>
 
 #include "byteorder.h"
+#include "irq.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#ifdef MODULE_GNRC_IPV6_NETIF
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netif.h"
+#endif
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
+#include "random.h"
 
 #include "gnrc_sock_internal.h"
 
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-static sock_udp_t *_udp_socks = NULL;
-#endif
+#ifdef MODULE_GNRC_SOCK_ASYNC
+static void _async_cb(gnrc_sock_reg_t *reg, sock_async_flags_t flags)
+{
+    sock_udp_t *sock = (sock_udp_t *)reg;
+    /* callback and argument are set together by sock_udp_set_cb() */
+    unsigned state = irq_disable();
+    sock_udp_cb_t cb = sock->async_cb;
+    void *arg = sock->async_cb_arg;
 
-static uint16_t _dyn_port_next = 0;
+    irq_restore(state);
+    if (cb != NULL) {
+        cb(sock, flags, arg);
+    }
+}
+#endif
 
 /**
- * @brief   Checks if a given UDP port is already used by another sock
+ * @brief   Checks if a given UDP port is already registered
+ *
+ * UDP entries of @ref net_gnrc_netreg are hashed by port, so this only walks
+ * the entries sharing a bucket with @p port.
  */
-static bool _dyn_port_used(uint16_t port)
+static inline bool _dyn_port_used(uint16_t port)
 {
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
-         ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
-            continue;
-        }
-        if (ptr->local.port == port) {
-            /* port already in use by another sock */
-            return true;
-        }
-    }
-#else
-    (void) port;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
-    return false;
+    return (gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port) != NULL);
 }
 
 /**
- * @brief   returns a UDP port, and checks for reuse if required
+ * @brief   returns a free UDP port, unless @p sock allows reuse
  *
- * complies to RFC 6056, see https://tools.ietf.org/html/rfc6056#section-3.3.3
+ * complies to RFC 6056, see https://tools.ietf.org/html/rfc6056#section-3.3.1
+ * (Algorithm 1: random start, then the next free port of the range)
  */
 static uint16_t _get_dyn_port(sock_udp_t *sock)
 {
-    unsigned count = GNRC_SOCK_DYN_PORTRANGE_NUM;
-    do {
+    unsigned offset = random_uint32() % GNRC_SOCK_DYN_PORTRANGE_NUM;
+
+    for (unsigned count = 0; count < GNRC_SOCK_DYN_PORTRANGE_NUM; count++) {
         uint16_t port = GNRC_SOCK_DYN_PORTRANGE_MIN +
-               (_dyn_port_next * GNRC_SOCK_DYN_PORTRANGE_OFF) % GNRC_SOCK_DYN_PORTRANGE_NUM;
-        _dyn_port_next++;
+                        ((offset + count) % GNRC_SOCK_DYN_PORTRANGE_NUM);
+
         if ((sock == NULL) || (sock->flags & SOCK_FLAGS_REUSE_EP) ||
-                              !_dyn_port_used(port)) {
+            !_dyn_port_used(port)) {
             return port;
         }
-        --count;
-    } while (count > 0);
+    }
     return GNRC_SOCK_DYN_PORTRANGE_ERR;
 }
 
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+/**
+ * @brief   Checks if another sock is bound to @p local
+ */
+static bool _ep_used(const sock_udp_ep_t *local)
+{
+    for (gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                         local->port);
+         entry != NULL; entry = gnrc_netreg_getnext(entry)) {
+        /* all socks in the UDP registry are UDP socks */
+        sock_udp_t *ptr = (sock_udp_t *)gnrc_sock_reg_from_entry(entry);
+
+        if ((ptr != NULL) &&
+            (memcmp(&ptr->local, local, sizeof(sock_udp_ep_t)) == 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
                     const sock_udp_ep_t *remote, uint16_t flags)
 {
@@ -98,17 +118,9 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
     memset(&sock->local, 0, sizeof(sock_udp_ep_t));
     if (local != NULL) {
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-        if (!(flags & SOCK_FLAGS_REUSE_EP)) {
-            for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
-                 ptr = (sock_udp_t *)ptr->reg.next) {
-                if (memcmp(&ptr->local, local, sizeof(sock_udp_ep_t)) == 0) {
-                    return -EADDRINUSE;
-                }
-            }
+        if (!(flags & SOCK_FLAGS_REUSE_EP) && _ep_used(local)) {
+            return -EADDRINUSE;
         }
-        /* prepend to current socks */
-        sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-        _udp_socks = sock;
 #endif
         if (gnrc_af_not_supported(local->family)) {
             return -EAFNOSUPPORT;
@@ -125,6 +137,10 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
         }
         memcpy(&sock->remote, remote, sizeof(sock_udp_ep_t));
     }
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    sock->async_cb = NULL;
+    sock->reg.async_cb = _async_cb;
+#endif
     if (local != NULL) {
         /* listen only with local given */
         gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, local->port);
@@ -137,12 +153,6 @@ void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    if (_udp_socks != NULL) {
-        gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
-        LL_DELETE(head, (gnrc_sock_reg_t *)sock);
-    }
-#endif
 }
 
 int sock_udp_get_local(sock_udp_t *sock, sock_udp_ep_t *local)
@@ -165,26 +175,27 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *remote)
     return 0;
 }
 
-ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
-                      uint32_t timeout, sock_udp_ep_t *remote)
+/**
+ * @brief   Receives a UDP packet for @p sock
+ *
+ * @return  The packet, its first snip is the payload.
+ * @return  NULL on error, @p res is set to the error.
+ */
+static gnrc_pktsnip_t *_recv(sock_udp_t *sock, uint32_t timeout,
+                             sock_udp_ep_t *remote, int *res)
 {
     gnrc_pktsnip_t *pkt, *udp;
     udp_hdr_t *hdr;
     sock_ip_ep_t tmp;
-    int res;
 
-    assert((sock != NULL) && (data != NULL) && (max_len > 0));
     if (sock->local.family == AF_UNSPEC) {
-        return -EADDRNOTAVAIL;
+        *res = -EADDRNOTAVAIL;
+        return NULL;
     }
     tmp.family = sock->local.family;
-    res = gnrc_sock_recv((gnrc_sock_reg_t *)sock, &pkt, timeout, &tmp);
-    if (res < 0) {
-        return res;
-    }
-    if (pkt->size > max_len) {
-        gnrc_pktbuf_release(pkt);
-        return -ENOBUFS;
+    *res = gnrc_sock_recv((gnrc_sock_reg_t *)sock, &pkt, timeout, &tmp);
+    if (*res < 0) {
+        return NULL;
     }
     udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
     assert(udp);
@@ -202,25 +213,94 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                  sizeof(ipv6_addr_t)) != 0) &&
          (memcmp(&sock->remote.addr, &tmp.addr, sizeof(ipv6_addr_t)) != 0)))) {
         gnrc_pktbuf_release(pkt);
-        return -EPROTO;
+        *res = -EPROTO;
+        return NULL;
+    }
+    return pkt;
+}
+
+ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    assert((sock != NULL) && (data != NULL) && (max_len > 0));
+    if ((pkt = _recv(sock, timeout, remote, &res)) == NULL) {
+        return res;
+    }
+    if (pkt->size > max_len) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOBUFS;
     }
     memcpy(data, pkt->data, pkt->size);
+    res = (int)pkt->size;
     gnrc_pktbuf_release(pkt);
-    return (int)pkt->size;
+    return res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
 {
+    gnrc_pktsnip_t *pkt;
     int res;
-    gnrc_pktsnip_t *payload, *pkt;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_ip_ep_t *rem;
 
-    assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (*buf_ctx != NULL) {
+        /* the payload of a GNRC packet is always in its first snip, so the
+         * second call ends the iteration */
+        gnrc_pktbuf_release(*buf_ctx);
+        *buf_ctx = NULL;
+        *data = NULL;
+        return 0;
+    }
+    if ((pkt = _recv(sock, timeout, remote, &res)) == NULL) {
+        return res;
+    }
+    if (pkt->size == 0) {
+        /* a datagram without payload has no chunk, so 0 must not leave the
+         * packet to a second call */
+        gnrc_pktbuf_release(pkt);
+        *data = NULL;
+        return 0;
+    }
+    *data = pkt->data;
+    *buf_ctx = pkt;
+    return (ssize_t)pkt->size;
+}
+
+ssize_t sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                            size_t num, uint32_t timeout)
+{
+    size_t i;
+    int res = 0;
 
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        /* only wait for the first message */
+        gnrc_pktsnip_t *pkt = _recv(sock, (i == 0) ? timeout : 0,
+                                    msgs[i].remote, &res);
+
+        if (pkt == NULL) {
+            break;
+        }
+        if (pkt->size > msgs[i].len) {
+            gnrc_pktbuf_release(pkt);
+            res = -ENOBUFS;
+            break;
+        }
+        memcpy(msgs[i].data, pkt->data, pkt->size);
+        msgs[i].len = pkt->size;
+        gnrc_pktbuf_release(pkt);
+    }
+    return (i > 0) ? (ssize_t)i : res;
+}
+
+/**
+ * @brief   Checks a remote end point to send to
+ */
+static int _check_remote(const sock_udp_t *sock, const sock_udp_ep_t *remote)
+{
     if (remote != NULL) {
         if (remote->port == 0) {
             return -EINVAL;
@@ -241,43 +321,66 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     else if (sock->remote.family == AF_UNSPEC) {
         return -ENOTCONN;
     }
+    return 0;
+}
+
+/**
+ * @brief   Gets the local end point to send from, binds @p sock implicitly
+ *          if it is unbound
+ */
+static int _get_local(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                      sock_ip_ep_t *local, uint16_t *src_port)
+{
     /* cppcheck-suppress nullPointerRedundantCheck
      * (reason: compiler evaluates lazily so this isn't a redundundant check and
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(sock_ip_ep_t));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EINVAL;
         }
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-            /* prepend to current socks */
-            sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-            _udp_socks = sock;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(sock_ip_ep_t));
     }
+    return 0;
+}
+
+/**
+ * @brief   Sends a UDP message from a checked local to a checked remote end
+ *          point
+ */
+static ssize_t _send(sock_udp_t *sock, const sock_ip_ep_t *local_ep,
+                     uint16_t src_port, const void *data, size_t len,
+                     const sock_udp_ep_t *remote)
+{
+    int res;
+    gnrc_pktsnip_t *payload, *pkt;
+    uint16_t dst_port;
+    sock_ip_ep_t local;
+    const sock_ip_ep_t *rem;
+
+    memcpy(&local, local_ep, sizeof(local));
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
+        rem = (const sock_ip_ep_t *)&sock->remote;
         dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)remote;
+        rem = (const sock_ip_ep_t *)remote;
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
@@ -304,4 +407,130 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     return res;
 }
 
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    int res;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+
+    assert((sock != NULL) || (remote != NULL));
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+
+    if (((res = _check_remote(sock, remote)) < 0) ||
+        ((res = _get_local(sock, remote, &local, &src_port)) < 0)) {
+        return res;
+    }
+    res = _send(sock, &local, src_port, data, len, remote);
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    if ((res > 0) && (sock != NULL)) {
+        _async_cb(&sock->reg, SOCK_ASYNC_MSG_SENT);
+    }
+#endif
+    return res;
+}
+
+#ifdef MODULE_GNRC_IPV6_NETIF
+/**
+ * @brief   Selects the interface and the source address to send to @p remote
+ *          from, so the IPv6 thread doesn't look them up for every datagram
+ *          of a batch
+ *
+ * @p local stays unchanged if its address is already set, the destination
+ * is a multicast or the loopback address, or the interface depends on the
+ * next hop, which is only known to the IPv6 thread.
+ */
+static void _resolve_local(sock_ip_ep_t *local, const sock_ip_ep_t *remote)
+{
+    const ipv6_addr_t *dst = (const ipv6_addr_t *)&remote->addr.ipv6;
+    kernel_pid_t iface;
+    ipv6_addr_t *src;
+
+    if ((remote->family != AF_INET6) ||
+        ((local->family != AF_UNSPEC) && (local->family != AF_INET6)) ||
+        !ipv6_addr_is_unspecified((ipv6_addr_t *)&local->addr.ipv6) ||
+        ipv6_addr_is_multicast(dst) || ipv6_addr_is_loopback(dst)) {
+        return;
+    }
+    if (local->netif != SOCK_ADDR_ANY_NETIF) {
+        iface = (kernel_pid_t)local->netif;
+    }
+    else if (remote->netif != SOCK_ADDR_ANY_NETIF) {
+        iface = (kernel_pid_t)remote->netif;
+    }
+    /* an address of this node */
+    else if ((iface = gnrc_ipv6_netif_find_by_addr(&src, dst)) == KERNEL_PID_UNDEF) {
+        kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+
+        if (gnrc_netif_get(ifs) != 1) {
+            return;
+        }
+        iface = ifs[0];
+    }
+    if ((gnrc_ipv6_netif_get(iface) == NULL) ||
+        ((src = gnrc_ipv6_netif_find_best_src_addr(iface, dst, false)) == NULL)) {
+        return;
+    }
+    local->family = AF_INET6;
+    /* the interface is left unset: a netif header for every datagram costs
+     * more than the IPv6 thread looking it up again */
+    memcpy(&local->addr.ipv6, src, sizeof(ipv6_addr_t));
+}
+#endif
+
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                            size_t num)
+{
+    uint16_t src_port = 0;
+    sock_ip_ep_t bound, local;
+    size_t i;
+    int res = 0;
+
+    assert((sock != NULL) && ((num == 0) || (msgs != NULL)));
+    for (i = 0; i < num; i++) {
+        const sock_udp_msg_t *msg = &msgs[i];
+
+        assert((msg->len == 0) || (msg->data != NULL));
+        /* e.g. replies to several requests of one remote share it */
+        if ((i == 0) || (msg->remote != msgs[i - 1].remote)) {
+            if ((res = _check_remote(sock, msg->remote)) < 0) {
+                break;
+            }
+            if ((i == 0) &&
+                ((res = _get_local(sock, msg->remote, &bound, &src_port)) < 0)) {
+                break;
+            }
+            memcpy(&local, &bound, sizeof(local));
+#ifdef MODULE_GNRC_IPV6_NETIF
+            _resolve_local(&local, (msg->remote != NULL) ?
+                                   (const sock_ip_ep_t *)msg->remote :
+                                   (const sock_ip_ep_t *)&sock->remote);
+#endif
+        }
+        if ((res = _send(sock, &local, src_port, msg->data, msg->len,
+                         msg->remote)) < 0) {
+            break;
+        }
+    }
+#ifdef MODULE_GNRC_SOCK_ASYNC
+    if (i > 0) {
+        _async_cb(&sock->reg, SOCK_ASYNC_MSG_SENT);
+    }
+#endif
+    return (i > 0) ? (ssize_t)i : res;
+}
+
+#ifdef MODULE_GNRC_SOCK_ASYNC
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
+{
+    assert(sock != NULL);
+    /* the network stack may call the callback in between */
+    unsigned state = irq_disable();
+
+    sock->async_cb = cb;
+    sock->async_cb_arg = arg;
+    irq_restore(state);
+}
+#endif
+
 /** @} */
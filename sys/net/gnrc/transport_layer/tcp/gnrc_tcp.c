@@ -104,16 +104,17 @@ static void _setup_timeout(xtimer_t *timer, const uint32_t duration, const xtime
  * @param[in]     local_addr    Local address to bind on, if this is a passive connection.
  * @param[in]     local_port    Local port to bind on, if this is a passive connection.
  * @param[in]     passive       Flag to indicate if this is a active or passive open.
+ * @param[in]     nb            Flag to indicate if the open is non-blocking.
  *
  * @returns   Zero on success.
  *            -EISCONN if TCB is already connected.
- *            -ENOMEM if the receive buffer for the TCB could not be allocated.
  *            -EADDRINUSE if @p local_port is already in use.
  *            -ETIMEDOUT if the connection opening timed out.
  *            -ECONNREFUSED if the connection was resetted by the peer.
  */
 static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const uint8_t *target_addr, uint16_t target_port,
-                          const uint8_t *local_addr, uint16_t local_port, uint8_t passive)
+                          const uint8_t *local_addr, uint16_t local_port, uint8_t passive,
+                          uint8_t nb)
 {
     msg_t msg;
     xtimer_t connection_timeout;
@@ -129,11 +130,20 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const uint8_t *target_addr, uint1
         return -EISCONN;
     }
 
-    /* Mark TCB as waiting for incomming messages */
-    tcb->status |= STATUS_WAIT_FOR_MSG;
+    /* Non-blocking connections report their progress to the event callback */
+    if (nb) {
+        tcb->status |= STATUS_NON_BLOCKING;
+        tcb->events = 0;
+    }
+    else {
+        tcb->status &= ~STATUS_NON_BLOCKING;
 
-    /* 'Flush' mbox */
-    while (mbox_try_get(&(tcb->mbox), &msg) != 0) {
+        /* Mark TCB as waiting for incomming messages */
+        tcb->status |= STATUS_WAIT_FOR_MSG;
+
+        /* 'Flush' mbox */
+        while (mbox_try_get(&(tcb->mbox), &msg) != 0) {
+        }
     }
 
     /* Setup passive connection */
@@ -165,19 +175,24 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const uint8_t *target_addr, uint1
         tcb->peer_port = target_port;
 
         /* Setup connection timeout: Put timeout message in TCBs mbox on expiration */
-        _setup_timeout(&connection_timeout, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
-                       _cb_mbox_put_msg, &connection_timeout_arg);
+        if (!nb) {
+            _setup_timeout(&connection_timeout, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
+                           _cb_mbox_put_msg, &connection_timeout_arg);
+        }
     }
 
     /* Call FSM with event: CALL_OPEN */
     ret = _fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
-    if (ret == -ENOMEM) {
-        DEBUG("gnrc_tcp.c : gnrc_tcp_connect() : Out of receive buffers.\n");
-    }
-    else if(ret == -EADDRINUSE) {
+    if (ret == -EADDRINUSE) {
         DEBUG("gnrc_tcp.c : gnrc_tcp_connect() : local_port is already in use.\n");
     }
 
+    /* Non-blocking open: the connection timer in the FSM takes over */
+    if (nb) {
+        mutex_unlock(&(tcb->function_lock));
+        return ret;
+    }
+
     /* Wait until a connection was established or closed */
     while (ret >= 0 && tcb->state != FSM_STATE_CLOSED && tcb->state != FSM_STATE_ESTABLISHED &&
            tcb->state != FSM_STATE_CLOSE_WAIT) {
@@ -240,14 +255,22 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     tcb->rtt_var = RTO_UNINITIALIZED;
     tcb->srtt = RTO_UNINITIALIZED;
     tcb->rto = RTO_UNINITIALIZED;
+    tcb->opts = GNRC_TCP_DEFAULT_OPTS;
     mbox_init(&(tcb->mbox), tcb->mbox_raw, GNRC_TCP_TCB_MBOX_SIZE);
     mutex_init(&(tcb->fsm_lock));
     mutex_init(&(tcb->function_lock));
 }
 
-int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
-                         const uint8_t *target_addr, const uint16_t target_port,
-                         const uint16_t local_port)
+/**
+ * @brief Checks the arguments of an active open and opens the connection.
+ *
+ * @see gnrc_tcp_open_active()
+ *
+ * @param[in] nb   Flag to indicate if the open is non-blocking.
+ */
+static int _gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                                 const uint8_t *target_addr, const uint16_t target_port,
+                                 const uint16_t local_port, uint8_t nb)
 {
     assert(tcb != NULL);
     assert(target_addr != NULL);
@@ -267,11 +290,19 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
         return -EINVAL;
     }
     /* Proceed with connection opening */
-    return _gnrc_tcp_open(tcb, target_addr, target_port, NULL, local_port, 0);
+    return _gnrc_tcp_open(tcb, target_addr, target_port, NULL, local_port, 0, nb);
 }
 
-int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
-                          const uint8_t *local_addr, const uint16_t local_port)
+/**
+ * @brief Checks the arguments of a passive open and opens the connection.
+ *
+ * @see gnrc_tcp_open_passive()
+ *
+ * @param[in] nb   Flag to indicate if the open is non-blocking.
+ */
+static int _gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                                  const uint8_t *local_addr, const uint16_t local_port,
+                                  uint8_t nb)
 {
     assert(tcb != NULL);
     assert(local_port != PORT_UNSPEC);
@@ -291,7 +322,43 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
         }
     }
     /* Proceed with connection opening */
-    return _gnrc_tcp_open(tcb, NULL, 0, local_addr, local_port, 1);
+    return _gnrc_tcp_open(tcb, NULL, 0, local_addr, local_port, 1, nb);
+}
+
+int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                         const uint8_t *target_addr, const uint16_t target_port,
+                         const uint16_t local_port)
+{
+    return _gnrc_tcp_open_active(tcb, address_family, target_addr, target_port, local_port, 0);
+}
+
+int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                          const uint8_t *local_addr, const uint16_t local_port)
+{
+    return _gnrc_tcp_open_passive(tcb, address_family, local_addr, local_port, 0);
+}
+
+int gnrc_tcp_open_active_nb(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                            const uint8_t *target_addr, const uint16_t target_port,
+                            const uint16_t local_port)
+{
+    return _gnrc_tcp_open_active(tcb, address_family, target_addr, target_port, local_port, 1);
+}
+
+int gnrc_tcp_open_passive_nb(gnrc_tcp_tcb_t *tcb,  const uint8_t address_family,
+                             const uint8_t *local_addr, const uint16_t local_port)
+{
+    return _gnrc_tcp_open_passive(tcb, address_family, local_addr, local_port, 1);
+}
+
+void gnrc_tcp_set_event_cb(gnrc_tcp_tcb_t *tcb, gnrc_tcp_event_cb_t cb, void *arg)
+{
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->fsm_lock));
+    tcb->event_cb = cb;
+    tcb->event_arg = arg;
+    mutex_unlock(&(tcb->fsm_lock));
 }
 
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
@@ -336,8 +403,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was queued for transmission */
+    while (ret == 0) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -359,6 +426,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         /* Try to send data in case there nothing has been sent and we are not probing */
         if (ret == 0 && !probing_mode) {
             ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+
+            /* Queued data is retransmitted until it is acknowledged: return */
+            if (ret > 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -372,7 +444,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 ret = -ETIMEDOUT;
                 break;
 
@@ -488,8 +559,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                     break;
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
-                    DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                    _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                    DEBUG("gnrc_tcp.c : gnrc_tcp_recv() : USER_SPEC_TIMEOUT\n");
                     ret = -ETIMEDOUT;
                     break;
 
@@ -579,6 +649,64 @@ void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
     mutex_unlock(&(tcb->function_lock));
 }
 
+void gnrc_tcp_set_opts(gnrc_tcp_tcb_t *tcb, uint8_t opts)
+{
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->fsm_lock));
+    tcb->opts = opts;
+    mutex_unlock(&(tcb->fsm_lock));
+}
+
+ssize_t gnrc_tcp_send_nb(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret = 0;
+
+    /* Lock the TCB for this function call */
+    mutex_lock(&(tcb->function_lock));
+
+    /* Check if connection is in a valid state */
+    if (tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_CLOSE_WAIT) {
+        mutex_unlock(&(tcb->function_lock));
+        return (tcb->state == FSM_STATE_CLOSED) ? -ECONNRESET : -ENOTCONN;
+    }
+
+    /* Queue as much data as the windows permit, GNRC_TCP_EVENT_WRITABLE signals the rest */
+    ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+    if (ret == 0 && len > 0) {
+        ret = -EAGAIN;
+    }
+    mutex_unlock(&(tcb->function_lock));
+    return ret;
+}
+
+ssize_t gnrc_tcp_recv_nb(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len)
+{
+    ssize_t ret = gnrc_tcp_recv(tcb, data, max_len, 0);
+
+    /* The peer closed its side and all data was read */
+    if (ret == -EAGAIN && tcb->state == FSM_STATE_CLOSE_WAIT) {
+        ret = 0;
+    }
+    return ret;
+}
+
+void gnrc_tcp_close_nb(gnrc_tcp_tcb_t *tcb)
+{
+    assert(tcb != NULL);
+
+    /* Lock the TCB for this function call */
+    mutex_lock(&(tcb->function_lock));
+    if (tcb->state != FSM_STATE_CLOSED) {
+        /* Start connection teardown sequence, GNRC_TCP_EVENT_CLOSED signals its end */
+        _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    }
+    mutex_unlock(&(tcb->function_lock));
+}
+
 int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr)
 {
     uint16_t csum;
@@ -35,6 +35,35 @@
 
 static msg_t _eventloop_msg_queue[TCP_EVENTLOOP_MSG_QUEUE_SIZE];
 
+/**
+ * @brief Passes the pending events of a TCB to its event callback.
+ *
+ * @param[in,out] tcb   TCB whose events should be passed.
+ */
+static void _dispatch_events(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_event_cb_t cb;
+    void *arg;
+    uint8_t events;
+
+    /* Take events under lock. The callback may call the API on this TCB, which can cause
+     * further events (e.g. GNRC_TCP_EVENT_CLOSED on abort): pass them as well. */
+    while (1) {
+        mutex_lock(&(tcb->fsm_lock));
+        events = tcb->events;
+        cb = tcb->event_cb;
+        arg = tcb->event_arg;
+        tcb->events = 0;
+        mutex_unlock(&(tcb->fsm_lock));
+
+        if (events == 0 || cb == NULL) {
+            break;
+        }
+        DEBUG("gnrc_tcp_eventloop.c : _dispatch_events() : events 0x%02x\n", events);
+        cb(tcb, events, arg);
+    }
+}
+
 /**
  * @brief Send function, pass paket down the network stack.
  *
@@ -193,6 +222,7 @@ static int _receive(gnrc_pktsnip_t *pkt)
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
     if (tcb != NULL) {
         _fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+        _dispatch_events(tcb);
     }
     /* No fitting TCB has been found. Respond with reset */
     else {
@@ -254,6 +284,7 @@ void *_event_loop(__attribute__((unused)) void *arg)
                 DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_RETRANSMISSION\n");
                 _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_RETRANSMIT,
                      NULL, NULL, 0);
+                _dispatch_events((gnrc_tcp_tcb_t *)msg.content.ptr);
                 break;
 
             /* Timewait timer expired: Call FSM with timewait event */
@@ -261,6 +292,36 @@ void *_event_loop(__attribute__((unused)) void *arg)
                 DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_TIMEWAIT\n");
                 _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_TIMEWAIT,
                      NULL, NULL, 0);
+                _dispatch_events((gnrc_tcp_tcb_t *)msg.content.ptr);
+                break;
+
+            /* Connection timer of a non-blocking connection expired */
+            case MSG_TYPE_CONNECTION_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_CONNECTION_TIMEOUT\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_CONNECTION,
+                     NULL, NULL, 0);
+                _dispatch_events((gnrc_tcp_tcb_t *)msg.content.ptr);
+                break;
+
+            /* Zero window probe timer of a non-blocking connection expired */
+            case MSG_TYPE_PROBE_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_PROBE_TIMEOUT\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_SEND_PROBE,
+                     NULL, NULL, 0);
+                _dispatch_events((gnrc_tcp_tcb_t *)msg.content.ptr);
+                break;
+
+            /* Delayed ACK timer expired: Call FSM with delayed ACK event */
+            case MSG_TYPE_DELAYED_ACK:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_DELAYED_ACK\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_DELAYED_ACK,
+                     NULL, NULL, 0);
+                break;
+
+            /* Events occured outside of this thread */
+            case MSG_TYPE_EVENTS:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_EVENTS\n");
+                _dispatch_events((gnrc_tcp_tcb_t *)msg.content.ptr);
                 break;
 
             default:
@@ -80,10 +80,14 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->rtx_num > 0) {
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        while (tcb->rtx_num > 0) {
+            gnrc_pktbuf_release(tcb->rtx[tcb->rtx_head].pkt);
+            tcb->rtx[tcb->rtx_head].pkt = NULL;
+            tcb->rtx_head = (tcb->rtx_head + 1) % RTX_ENTRIES;
+            tcb->rtx_num -= 1;
+        }
     }
     return 0;
 }
@@ -104,6 +108,196 @@ static int _restart_timewait_timer(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Starts the connection timer of a non-blocking connection.
+ *
+ * @param[in,out] tcb       TCB holding the timer struct to set.
+ * @param[in]     timeout   Timeout in microseconds.
+ */
+static void _set_connection_timer(gnrc_tcp_tcb_t *tcb, uint32_t timeout)
+{
+    tcb->msg_conn.type = MSG_TYPE_CONNECTION_TIMEOUT;
+    tcb->msg_conn.content.ptr = (void *)tcb;
+    xtimer_set_msg(&tcb->tim_conn, timeout, &tcb->msg_conn, gnrc_tcp_pid);
+}
+
+/**
+ * @brief Starts the zero window probe timer of a non-blocking connection.
+ *
+ * @param[in,out] tcb       TCB holding the timer struct to set.
+ * @param[in]     timeout   Probe interval in microseconds, bounded to the
+ *                          GNRC_TCP_PROBE_*_BOUND values.
+ */
+static void _set_probe_timer(gnrc_tcp_tcb_t *tcb, uint32_t timeout)
+{
+    if (timeout < GNRC_TCP_PROBE_LOWER_BOUND) {
+        timeout = GNRC_TCP_PROBE_LOWER_BOUND;
+    }
+    else if (timeout > GNRC_TCP_PROBE_UPPER_BOUND) {
+        timeout = GNRC_TCP_PROBE_UPPER_BOUND;
+    }
+    tcb->probe_tout = timeout;
+    tcb->status |= STATUS_PROBING;
+    tcb->msg_tout.type = MSG_TYPE_PROBE_TIMEOUT;
+    tcb->msg_tout.content.ptr = (void *)tcb;
+    xtimer_set_msg(&tcb->tim_tout, timeout, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+/**
+ * @brief Records events for the event callback of a non-blocking connection.
+ *
+ * @param[in,out] tcb      TCB the events occured on.
+ * @param[in]     events   Events that occured.
+ */
+static inline void _add_events(gnrc_tcp_tcb_t *tcb, uint8_t events)
+{
+    if (tcb->status & STATUS_NON_BLOCKING) {
+        tcb->events |= events;
+    }
+}
+
+/**
+ * @brief Checks if a non-blocking connection can queue more data for transmission.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Non-zero if at least a full segment or, with nothing in flight, any data fits.
+ */
+static int _is_writable(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+    if (tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_CLOSE_WAIT) {
+        return 0;
+    }
+    if (tcb->rtx_num >= GNRC_TCP_RTX_QUEUE_SIZE || flight >= wnd) {
+        return 0;
+    }
+    return (flight == 0 || wnd - flight >= _pkt_get_smss(tcb));
+}
+
+/**
+ * @brief Checks if a non-blocking connection waits for its peer.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Non-zero if the connection is opened or closed, data is unacknowledged
+ *            or the send window is probed.
+ */
+static int _is_waiting(const gnrc_tcp_tcb_t *tcb)
+{
+    switch (tcb->state) {
+        case FSM_STATE_SYN_SENT:
+        case FSM_STATE_SYN_RCVD:
+        case FSM_STATE_FIN_WAIT_1:
+        case FSM_STATE_FIN_WAIT_2:
+        case FSM_STATE_CLOSING:
+        case FSM_STATE_LAST_ACK:
+            return 1;
+        default:
+            break;
+    }
+    return (tcb->rtx_num > 0 || (tcb->status & STATUS_PROBING));
+}
+
+/**
+ * @brief Holds back data with the Nagle algorithm.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     buf   Data to hold back.
+ * @param[in]     len   Number of bytes in @p buf.
+ *
+ * @returns   Number of bytes held back, less than @p len if a full segment is held back.
+ */
+static size_t _hold_pending(gnrc_tcp_tcb_t *tcb, const void *buf, size_t len)
+{
+    uint16_t smss = _pkt_get_smss(tcb);
+
+    /* Space for a full segment is allocated, the segment is sent once it is filled */
+    if (tcb->snd_pend == NULL) {
+        tcb->snd_pend = gnrc_pktbuf_add(NULL, NULL, smss, GNRC_NETTYPE_UNDEF);
+        if (tcb->snd_pend == NULL) {
+            DEBUG("gnrc_tcp_fsm.c : _hold_pending() : pktbuf is full\n");
+            return 0;
+        }
+        tcb->snd_pend_len = 0;
+    }
+    if (len > (size_t) (smss - tcb->snd_pend_len)) {
+        len = smss - tcb->snd_pend_len;
+    }
+    memcpy((uint8_t *) tcb->snd_pend->data + tcb->snd_pend_len, buf, len);
+    tcb->snd_pend_len += len;
+    return len;
+}
+
+/**
+ * @brief Releases data held back by the Nagle algorithm.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _release_pending(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->snd_pend != NULL) {
+        gnrc_pktbuf_release(tcb->snd_pend);
+        tcb->snd_pend = NULL;
+        tcb->snd_pend_len = 0;
+    }
+}
+
+/**
+ * @brief Sends data held back by the Nagle algorithm.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero if no data is held back anymore.
+ *            -EAGAIN if the data is still held back.
+ */
+static int _send_pending(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;
+    uint16_t seq_con = 0;
+
+    if (tcb->snd_pend == NULL) {
+        return 0;
+    }
+
+    /* Send once a full segment was collected or all sent data was acknowledged */
+    uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+    if (flight > 0 && tcb->snd_pend_len < _pkt_get_smss(tcb)) {
+        return -EAGAIN;
+    }
+    if (tcb->rtx_num >= GNRC_TCP_RTX_QUEUE_SIZE || flight + tcb->snd_pend_len > wnd) {
+        return -EAGAIN;
+    }
+    if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                   tcb->snd_pend->data, tcb->snd_pend_len) < 0) {
+        return -EAGAIN;
+    }
+    _pkt_setup_retransmit(tcb, out_pkt, false);
+    _pkt_send(tcb, out_pkt, seq_con, false);
+    _release_pending(tcb);
+    return 0;
+}
+
+/**
+ * @brief Checks if segments were received out of order.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Non-zero if a received segment follows a gap.
+ */
+static int _has_ooo_segments(const gnrc_tcp_tcb_t *tcb)
+{
+    for (unsigned i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; i++) {
+        if (tcb->rcv_queue[i].pkt != NULL && GRT_32_BIT(tcb->rcv_queue[i].seq, tcb->rcv_nxt)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /**
  * @brief Transition from current FSM state into another state.
  *
@@ -128,9 +322,26 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             LL_DELETE(_list_tcb_head, tcb);
             mutex_unlock(&_list_tcb_lock);
 
-            /* Free potencially allocated receive buffer */
-            _rcvbuf_release_buffer(tcb);
+            /* Release received segments and data held back for sending */
+            _rcvbuf_release(tcb);
+            _release_pending(tcb);
             tcb->status |= STATUS_NOTIFY_USER;
+
+            /* Stop delayed ACK timer */
+            xtimer_remove(&tcb->tim_ack);
+            tcb->status &= ~STATUS_ACK_PENDING;
+
+            /* Stop the timers of non-blocking connections */
+            if (tcb->status & STATUS_NON_BLOCKING) {
+                xtimer_remove(&tcb->tim_conn);
+                if (tcb->status & STATUS_PROBING) {
+                    xtimer_remove(&tcb->tim_tout);
+                }
+                if (tcb->state != FSM_STATE_CLOSED) {
+                    _add_events(tcb, GNRC_TCP_EVENT_CLOSED);
+                }
+            }
+            tcb->status &= ~(STATUS_WANT_WRITE | STATUS_PROBING);
             break;
 
         case FSM_STATE_LISTEN:
@@ -145,11 +356,6 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 #endif
             tcb->peer_port = PORT_UNSPEC;
 
-            /* Allocate receive buffer */
-            if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
-                return -ENOMEM;
-            }
-
             /* Add connection to active connections (if not already active) */
             mutex_lock(&_list_tcb_lock);
             LL_SEARCH(_list_tcb_head, iter, tcb, TCB_EQUAL);
@@ -160,11 +366,6 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
-            /* Allocate rceveive buffer */
-            if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
-                return -ENOMEM;
-            }
-
             /* Add connection to active connections (if not already active) */
             mutex_lock(&_list_tcb_lock);
             LL_SEARCH(_list_tcb_head, iter, tcb, TCB_EQUAL);
@@ -172,10 +373,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             if (iter == NULL) {
                 /* Check if port number was specified */
                 if (tcb->local_port != PORT_UNSPEC) {
-                    /* Check if given port number is use: return error and release buffer */
+                    /* Check if given port number is use: return error */
                     if (_is_local_port_in_use(tcb->local_port)) {
                         mutex_unlock(&_list_tcb_lock);
-                        _rcvbuf_release_buffer(tcb);
                         return -EADDRINUSE;
                     }
                 }
@@ -189,8 +389,22 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            /* Start in slow start with the initial congestion window */
+            tcb->cwnd = _pkt_get_initial_cwnd(tcb);
+            tcb->ssthresh = UINT16_MAX;
+            tcb->recover = tcb->snd_nxt;
+            tcb->dup_acks = 0;
+            tcb->status &= ~(STATUS_FAST_RECOVERY | STATUS_RTO_RECOVERY);
+            tcb->status |= STATUS_NOTIFY_USER;
+            _add_events(tcb, GNRC_TCP_EVENT_CONNECTED);
+            break;
+
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
+            if (tcb->state == FSM_STATE_SYN_RCVD) {
+                _add_events(tcb, GNRC_TCP_EVENT_CONNECTED);
+            }
+            _add_events(tcb, GNRC_TCP_EVENT_READABLE);
             break;
 
         case FSM_STATE_TIME_WAIT:
@@ -200,6 +414,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
         default:
             break;
     }
+    /* Any other state sends or awaits a FIN, which uses the timer struct */
+    if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_CLOSE_WAIT) {
+        tcb->status &= ~STATUS_PROBING;
+    }
     tcb->state = state;
     return 0;
 }
@@ -210,7 +428,6 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
- *            -ENOMEM if receive buffer could not be allocated.
  *            -EADDRINUSE if given local port number is already in use.
  */
 static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
@@ -218,14 +435,20 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     int ret = 0;
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_open()\n");
-    tcb->rcv_wnd = GNRC_TCP_DEFAULT_WINDOW;
+    /* Nothing was received yet: Open the window to the available memory */
+    tcb->rcv_user = tcb->rcv_nxt;
+    tcb->rcv_wnd = 0;
+    _rcvbuf_update_window(tcb);
+
+    /* Non-blocking connections are timed out by the connection timer */
+    if (tcb->status & STATUS_NON_BLOCKING) {
+        tcb->conn_last = xtimer_now_usec();
+        _set_connection_timer(tcb, GNRC_TCP_CONNECTION_TIMEOUT_DURATION);
+    }
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
-        if (_transition_to(tcb, FSM_STATE_LISTEN) == -ENOMEM) {
-            _transition_to(tcb, FSM_STATE_CLOSED);
-            return -ENOMEM;
-        }
+        _transition_to(tcb, FSM_STATE_LISTEN);
     }
     else {
         /* Active Open, set TCB values, send SYN, T: CLOSED -> SYN_SENT */
@@ -263,24 +486,66 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    uint16_t smss = _pkt_get_smss(tcb);
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
-        /* Calculate segment size */
-        payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+    /* Data held back by the Nagle algorithm precedes new data */
+    if (tcb->snd_pend != NULL) {
+        sent = _hold_pending(tcb, buf, len);
+        if (_send_pending(tcb) < 0) {
+            len = sent;
+        }
+    }
+
+    /* Usable window is bounded by the peers window and the congestion window */
+    uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+
+    /* Send segments as long as the window is open and the retransmit queue has space */
+    while (sent < len && tcb->rtx_num < GNRC_TCP_RTX_QUEUE_SIZE) {
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        if (flight >= wnd) {
+            break;
+        }
 
         /* Calculate payload size for this segment */
+        size_t payload = wnd - flight;
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+
+        /* Avoid small segments while data is in flight (see RFC 1122, 4.2.3.4) */
+        if (flight > 0 && payload < smss && payload < (len - sent)) {
+            break;
+        }
+
+        /* Nagle algorithm: hold back the remaining data while data is in flight, it is
+         * sent along with subsequent writes or once everything was acknowledged */
+        if ((tcb->opts & GNRC_TCP_OPT_NAGLE) && flight > 0 && payload < smss) {
+            sent += _hold_pending(tcb, (uint8_t *) buf + sent, len - sent);
+            break;
+        }
+
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *) buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
+        /* The retransmission timer took over the timer struct */
+        tcb->status &= ~STATUS_PROBING;
     }
-    return 0;
+
+    /* Non-blocking connections are notified once more data can be queued */
+    if ((tcb->status & STATUS_NON_BLOCKING) && sent < len) {
+        tcb->status |= STATUS_WANT_WRITE;
+        /* Nothing in flight triggers a window update: probe the window */
+        if (tcb->snd_wnd == 0 && tcb->rtx_num == 0 && !(tcb->status & STATUS_PROBING)) {
+            _set_probe_timer(tcb, (tcb->rto > 0) ? (uint32_t) tcb->rto : 0);
+        }
+    }
+    return sent;
 }
 
 /**
@@ -296,17 +561,19 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_recv()\n");
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    /* Read data into 'buf' up to 'len' bytes from the received segments */
+    size_t rcvd = _rcvbuf_read(tcb, buf, len);
+    if (rcvd == 0) {
         return 0;
     }
 
-    /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
-
-    /* If receive buffer can store more than GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-
+    /* If the window opened by at least one MSS or half its size: anounce it to the peer.
+     * Smaller updates are not sent to avoid the silly window syndrome (see RFC 1122). */
+    uint16_t old_wnd = tcb->rcv_wnd;
+    uint16_t min_update = (GNRC_TCP_MSS < GNRC_TCP_DEFAULT_WINDOW / 2) ?
+                          GNRC_TCP_MSS : GNRC_TCP_DEFAULT_WINDOW / 2;
+    _rcvbuf_update_window(tcb);
+    if (tcb->rcv_wnd - old_wnd >= min_update) {
         /* Send ACK to anounce window update */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
@@ -330,10 +597,18 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
     if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED ||
         tcb->state == FSM_STATE_CLOSE_WAIT) {
 
-        /* Send FIN packet */
+        /* Send FIN packet, it carries data held back by the Nagle algorithm */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+        if (tcb->snd_pend != NULL) {
+            _pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                       tcb->snd_pend->data, tcb->snd_pend_len);
+            _release_pending(tcb);
+        }
+        else {
+            _pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                       NULL, 0);
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
     }
@@ -386,7 +661,6 @@ static int _fsm_call_abort(gnrc_tcp_tcb_t *tcb)
  * @param[in]     in_pkt   Incomming packet.
  *
  * @returns   Zero on success.
- *            -ENOMEM if receive buffer could not be allocated.
  */
 static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
 {
@@ -484,6 +758,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->peer_port = src;
             tcb->irs = byteorder_ntohl(tcp_hdr->seq_num);
             tcb->rcv_nxt = tcb->irs + 1;
+            tcb->rcv_user = tcb->rcv_nxt;
+            _rcvbuf_update_window(tcb);
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
@@ -522,6 +798,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         /* 3) Check SYN: Set TCB values accordingly */
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
+            tcb->rcv_user = tcb->rcv_nxt;
             tcb->irs = seg_seq;
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
@@ -560,6 +837,9 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     else {
         seg_len = _pkt_get_seg_len(in_pkt);
         pay_len = _pkt_get_pay_len(in_pkt);
+        /* Open the window to memory that was released by other connections meanwhile */
+        _rcvbuf_update_window(tcb);
+
         /* 1) Verify sequence number ... */
         if (_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
@@ -573,10 +853,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (ctl & MSK_RST) {
             /* .. and state is SYN_RCVD and the connection is passive: SYN_RCVD -> LISTEN */
             if (tcb->state == FSM_STATE_SYN_RCVD && (tcb->status & STATUS_PASSIVE)) {
-                if (_transition_to(tcb, FSM_STATE_LISTEN) == -ENOMEM) {
-                    _transition_to(tcb, FSM_STATE_CLOSED);
-                    return -ENOMEM;
-                }
+                _transition_to(tcb, FSM_STATE_LISTEN);
             }
             else {
                 _transition_to(tcb, FSM_STATE_CLOSED);
@@ -612,10 +889,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
+                /* Apply SACK blocks of an acceptable segment */
+                if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    _option_parse_sack(tcb, tcp_hdr);
+                }
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
                     _pkt_acknowledge(tcb, seg_ack);
+
+                    /* Signal user, the window might allow to send more data */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: Signals a segment received out of order by the peer */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         !(ctl & (MSK_SYN | MSK_FIN))) {
+                    _pkt_acknowledge_dup(tcb);
+
+                    /* Signal user, fast recovery might allow to send more data */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -639,25 +931,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionaly if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -672,24 +964,30 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                /* Keep the segment until its data was read */
+                uint32_t added = _rcvbuf_add_segment(tcb, in_pkt, seg_seq, pay_len);
+                if (added > 0) {
+                    /* Shrink receive window, its right edge stays in place */
+                    tcb->rcv_wnd = (added < tcb->rcv_wnd) ? tcb->rcv_wnd - added : 0;
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
+                    _add_events(tcb, GNRC_TCP_EVENT_READABLE);
                 }
-                /* Send ACK, if FIN processing sends ACK already */
-                /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                /* Send ACK, if FIN processing sends ACK already. Out of order data causes a
+                 * duplicate ACK carrying SACK information. In order data is acknowledged
+                 * with every second segment, a single segment after a delay or with the next
+                 * data sent (see RFC 1122, 4.2.3.2). ACKs are not delayed while segments are
+                 * missing, the sender needs them to recover (see RFC 5681, 4.2). */
+                if ((ctl & MSK_FIN) == 0 && (tcb->opts & GNRC_TCP_OPT_DELAYED_ACK) &&
+                    added == pay_len && !(tcb->status & STATUS_ACK_PENDING) &&
+                    !_has_ooo_segments(tcb)) {
+                    tcb->status |= STATUS_ACK_PENDING;
+                    tcb->msg_ack.type = MSG_TYPE_DELAYED_ACK;
+                    tcb->msg_ack.content.ptr = (void *)tcb;
+                    xtimer_set_msg(&tcb->tim_ack, GNRC_TCP_DELAYED_ACK_TIMEOUT, &tcb->msg_ack,
+                                   gnrc_tcp_pid);
+                }
+                else if (!(ctl & MSK_FIN)) {
                     _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
                                NULL, 0);
                     _pkt_send(tcb, out_pkt, seq_con, false);
@@ -702,6 +1000,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
             }
+            /* Ignore FIN until all data before it was received, acknowledge received data */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                           NULL, 0);
+                _pkt_send(tcb, out_pkt, seq_con, false);
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
@@ -711,7 +1016,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -753,9 +1058,19 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_num > 0) {
+        gnrc_pktsnip_t *pkt = tcb->rtx[tcb->rtx_head].pkt;
+
+        /* Data in flight is not bound to a user call: Give up if the oldest segment
+         * was not acknowledged within the connection timeout */
+        if ((xtimer_now_usec() - tcb->rtx[tcb->rtx_head].send_time) >=
+            GNRC_TCP_CONNECTION_TIMEOUT_DURATION) {
+            DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Connection timed out\n");
+            _transition_to(tcb, FSM_STATE_CLOSED);
+            return 0;
+        }
+        _pkt_setup_retransmit(tcb, pkt, true);
+        _pkt_send(tcb, pkt, 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
@@ -773,6 +1088,22 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_connection()\n");
+    if (tcb->status & STATUS_NON_BLOCKING) {
+        if (tcb->state == FSM_STATE_CLOSED) {
+            return 0;
+        }
+        /* Abort only if the peer was silent for the whole duration while it was needed */
+        uint32_t idle = xtimer_now_usec() - tcb->conn_last;
+        if (idle < GNRC_TCP_CONNECTION_TIMEOUT_DURATION) {
+            _set_connection_timer(tcb, GNRC_TCP_CONNECTION_TIMEOUT_DURATION - idle);
+            return 0;
+        }
+        if (!_is_waiting(tcb)) {
+            tcb->conn_last = xtimer_now_usec();
+            _set_connection_timer(tcb, GNRC_TCP_CONNECTION_TIMEOUT_DURATION);
+            return 0;
+        }
+    }
     _transition_to(tcb, FSM_STATE_CLOSED);
     return 0;
 }
@@ -790,6 +1121,17 @@ static int _fsm_send_probe(gnrc_tcp_tcb_t *tcb)
     uint8_t probe_pay[] = {1};       /* Probe payload */
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_send_probe()\n");
+    if (tcb->status & STATUS_NON_BLOCKING) {
+        /* Stop probing once the window opened or data is in flight */
+        if (!(tcb->status & STATUS_PROBING)) {
+            return 0;
+        }
+        if (tcb->snd_wnd > 0 || tcb->rtx_num > 0) {
+            tcb->status &= ~STATUS_PROBING;
+            return 0;
+        }
+        _set_probe_timer(tcb, 2 * tcb->probe_tout);
+    }
     /* The probe sends a already acknowledged sequence no. with a garbage byte. */
     _pkt_build(tcb, &out_pkt, NULL, MSK_ACK, tcb->snd_una - 1, tcb->rcv_nxt, probe_pay,
                sizeof(probe_pay));
@@ -798,16 +1140,22 @@ static int _fsm_send_probe(gnrc_tcp_tcb_t *tcb)
 }
 
 /**
- * @brief FSM Handling Function for clearing the retransmit queue.
+ * @brief FSM handling function for sending a delayed ACK.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
  */
-static int _fsm_clear_retransmit(gnrc_tcp_tcb_t *tcb)
+static int _fsm_timeout_delayed_ack(gnrc_tcp_tcb_t *tcb)
 {
-    DEBUG("gnrc_tcp_fsm.c : _fsm_clear_retransmit()\n");
-    _clear_retransmit(tcb);
+    DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_delayed_ack()\n");
+    /* The ACK was not piggybacked on data in time: send it */
+    if (tcb->status & STATUS_ACK_PENDING) {
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+        _pkt_send(tcb, out_pkt, seq_con, false);
+    }
     return 0;
 }
 
@@ -821,7 +1169,6 @@ static int _fsm_clear_retransmit(gnrc_tcp_tcb_t *tcb)
  * @param[in]     len     Number of bytes to send or receive in @p buf.
  *
  * @returns   Zero on success.
- *           -ENOMEM if receive buffer could not be allocated.
  *           -EADDRINUSE if given local port number in @p tcb is already in use.
  *           -EOPNOTSUPP if event is not implemented.
  */
@@ -862,8 +1209,8 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip
         case FSM_EVENT_SEND_PROBE :
             ret = _fsm_send_probe(tcb);
             break;
-        case FSM_EVENT_CLEAR_RETRANSMIT :
-            ret = _fsm_clear_retransmit(tcb);
+        case FSM_EVENT_TIMEOUT_DELAYED_ACK :
+            ret = _fsm_timeout_delayed_ack(tcb);
             break;
     }
     return ret;
@@ -878,13 +1225,39 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
 
+    /* Acknowledgments may release data held back by the Nagle algorithm */
+    if (event == FSM_EVENT_RCVD_PKT && tcb->snd_pend != NULL &&
+        (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT)) {
+        _send_pending(tcb);
+    }
+
+    if ((tcb->status & STATUS_NON_BLOCKING) && event == FSM_EVENT_RCVD_PKT) {
+        /* Received packets keep a non-blocking connection alive */
+        tcb->conn_last = xtimer_now_usec();
+
+        /* Acknowledgments and window updates make room for queued data */
+        if ((tcb->status & STATUS_WANT_WRITE) && _is_writable(tcb)) {
+            tcb->status &= ~STATUS_WANT_WRITE;
+            _add_events(tcb, GNRC_TCP_EVENT_WRITABLE);
+        }
+    }
+
     /* Notify blocked thread if something interesting happend */
     if ((tcb->status & STATUS_NOTIFY_USER) && (tcb->status & STATUS_WAIT_FOR_MSG)) {
         msg_t msg;
         msg.type = MSG_TYPE_NOTIFY_USER;
         mbox_try_put(&(tcb->mbox), &msg);
     }
+    /* Events are passed to the event callback by the TCP thread: wake it up if needed */
+    uint8_t events = tcb->events;
+
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
+    if (events && thread_getpid() != gnrc_tcp_pid) {
+        msg_t msg;
+        msg.type = MSG_TYPE_EVENTS;
+        msg.content.ptr = (void *)tcb;
+        msg_try_send(&msg, gnrc_tcp_pid);
+    }
     return result;
 }
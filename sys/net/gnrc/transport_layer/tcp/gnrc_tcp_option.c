@@ -16,16 +16,86 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+#include "byteorder.h"
 #include "internal/common.h"
 #include "internal/option.h"
+#include "internal/pkt.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+/**
+ * @brief Maximum number of blocks in a SACK option, limited by the option field size.
+ */
+#define SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Collects the blocks of contiguous data received out of order.
+ *
+ * @param[in]  tcb     TCB holding the segments received out of order.
+ * @param[out] left    Left edges of the blocks.
+ * @param[out] right   Right edges of the blocks.
+ *
+ * @returns   Number of blocks.
+ */
+static unsigned _sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *left, uint32_t *right)
+{
+    unsigned num = 0;
+
+    for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+        const gnrc_tcp_rcv_seg_t *seg = &(tcb->rcv_queue[i]);
+
+        /* Only segments received out of order are reported */
+        if (seg->pkt == NULL || LEQ_32_BIT(seg->seq, tcb->rcv_nxt)) {
+            continue;
+        }
+        uint32_t l = seg->seq;
+        uint32_t r = seg->seq + seg->len;
+
+        /* Merge with blocks that overlap or adjoin this segment */
+        unsigned j = 0;
+        while (j < num) {
+            if (LEQ_32_BIT(l, right[j]) && LEQ_32_BIT(left[j], r)) {
+                l = LSS_32_BIT(left[j], l) ? left[j] : l;
+                r = LSS_32_BIT(r, right[j]) ? right[j] : r;
+                num -= 1;
+                left[j] = left[num];
+                right[j] = right[num];
+                continue;
+            }
+            ++j;
+        }
+        left[num] = l;
+        right[num] = r;
+        num += 1;
+    }
+
+    /* The block holding the most recently received segment comes first (see RFC 2018) */
+    for (unsigned j = 1; j < num; ++j) {
+        if (LEQ_32_BIT(left[j], tcb->ooo_last) && LSS_32_BIT(tcb->ooo_last, right[j])) {
+            uint32_t tmp = left[0];
+            left[0] = left[j];
+            left[j] = tmp;
+            tmp = right[0];
+            right[0] = right[j];
+            right[j] = tmp;
+            break;
+        }
+    }
+    return num;
+}
+
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
+    /* SACK is used only if both sides permit it on their SYN */
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~STATUS_SACK_PERMITTED;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         return 0;
     }
@@ -50,6 +120,27 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 opt_left -= 1;
                 continue;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK permitted length.\n");
+                    return -1;
+                }
+                if (ctl & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK permitted option found\n");
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (option->length < 2 || option->length > opt_left ||
+                    ((option->length - 2) % TCP_OPTION_LENGTH_SACK_BLOCK) != 0) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK option length.\n");
+                    return -1;
+                }
+                /* Blocks are applied by _option_parse_sack() once the segment is accepted */
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK option found\n");
+                break;
+
             case TCP_OPTION_KIND_MSS:
                 if (option->length != TCP_OPTION_LENGTH_MSS) {
                     DEBUG("gnrc_tcp_option.c : _option_parse() : invalid MSS Option length.\n");
@@ -69,3 +160,81 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     }
     return 0;
 }
+
+void _option_parse_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+{
+    if (!(tcb->status & STATUS_SACK_PERMITTED)) {
+        return;
+    }
+
+    /* Extract offset value. Return if no options are set */
+    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    if (offset <= TCP_HDR_OFFSET_MIN) {
+        return;
+    }
+
+    /* Get pointer to option field and field size */
+    uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
+    uint8_t opt_left = (offset - TCP_HDR_OFFSET_MIN) * 4;
+
+    /* The options were validated by _option_parse() */
+    while (opt_left > 0) {
+        tcp_hdr_opt_t *option = (tcp_hdr_opt_t *) opt_ptr;
+
+        if (option->kind == TCP_OPTION_KIND_EOL) {
+            return;
+        }
+        if (option->kind == TCP_OPTION_KIND_NOP) {
+            opt_ptr += 1;
+            opt_left -= 1;
+            continue;
+        }
+        if (opt_left < 2 || option->length < 2 || option->length > opt_left) {
+            return;
+        }
+        if (option->kind == TCP_OPTION_KIND_SACK) {
+            for (uint8_t i = 2; i < option->length; i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                network_uint32_t l;
+                network_uint32_t r;
+                memcpy(&l, opt_ptr + i, sizeof(l));
+                memcpy(&r, opt_ptr + i + sizeof(l), sizeof(r));
+                _pkt_sacked(tcb, byteorder_ntohl(l), byteorder_ntohl(r));
+            }
+        }
+        opt_ptr += option->length;
+        opt_left -= option->length;
+    }
+}
+
+uint8_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr)
+{
+    uint32_t left[GNRC_TCP_RCV_QUEUE_SIZE];
+    uint32_t right[GNRC_TCP_RCV_QUEUE_SIZE];
+
+    if (!(tcb->status & STATUS_SACK_PERMITTED)) {
+        return 0;
+    }
+    unsigned num = _sack_blocks(tcb, left, right);
+    if (num == 0) {
+        return 0;
+    }
+    num = (num < SACK_BLOCKS_MAX) ? num : SACK_BLOCKS_MAX;
+
+    /* Two NOPs align the blocks to four bytes */
+    uint8_t len = 2 + 2 + num * TCP_OPTION_LENGTH_SACK_BLOCK;
+    if (opt_ptr != NULL) {
+        opt_ptr[0] = TCP_OPTION_KIND_NOP;
+        opt_ptr[1] = TCP_OPTION_KIND_NOP;
+        opt_ptr[2] = TCP_OPTION_KIND_SACK;
+        opt_ptr[3] = len - 2;
+        opt_ptr += 4;
+        for (unsigned i = 0; i < num; ++i) {
+            network_uint32_t l = byteorder_htonl(left[i]);
+            network_uint32_t r = byteorder_htonl(right[i]);
+            memcpy(opt_ptr, &l, sizeof(l));
+            memcpy(opt_ptr + sizeof(l), &r, sizeof(r));
+            opt_ptr += TCP_OPTION_LENGTH_SACK_BLOCK;
+        }
+    }
+    return len;
+}
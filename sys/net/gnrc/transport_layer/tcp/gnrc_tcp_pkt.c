@@ -20,6 +20,7 @@
 #include <utlist.h>
 #include <errno.h>
 #include "byteorder.h"
+#include "net/af.h"
 #include "net/inet_csum.h"
 #include "net/gnrc/pktbuf.h"
 #include "internal/common.h"
@@ -30,6 +31,10 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_IPV6_PMTU
+#include "net/gnrc/ipv6/pmtu.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -46,6 +51,98 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the minimum of two unsigned numbers.
+ *
+ * @param[in] x   First comparrison value.
+ * @param[in] y   Second comparrison value.
+ *
+ * @returns   X if x is smaller than y, if not y is returned.
+ */
+static inline uint32_t _min(const uint32_t x, const uint32_t y)
+{
+  return (x < y) ? x : y;
+}
+
+/**
+ * @brief Calculates the RTO from the current round trip time estimation (see RFC 6298).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without any measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Starts the retransmission timer for the oldest segment in the retransmission queue.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _start_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundry checks on current RTO before usage */
+    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_tout.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+/**
+ * @brief Resends segments of the retransmission queue that are considered lost.
+ *
+ * @note After a retransmission timeout, all segments sent before it are considered lost:
+ *       Receivers discarding out of order segments have dropped all segments following a
+ *       lost one. During fast recovery, only segments below selectively acknowledged ones
+ *       are considered lost, or the oldest one if the peer does not support SACK.
+ *       Segments are resent once per recovery, as far as the congestion window permits.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     ack   Current acknowledgment number.
+ */
+static void _resend_lost(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
+{
+    uint32_t limit = tcb->recover;
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        limit = tcb->rtx[tcb->rtx_head].seq + 1;
+        for (unsigned i = 0; i < tcb->rtx_num; ++i) {
+            gnrc_tcp_rtx_t *rtx = &tcb->rtx[(tcb->rtx_head + i) % RTX_ENTRIES];
+            if (rtx->sacked) {
+                limit = rtx->seq;
+            }
+        }
+    }
+    for (unsigned i = 0; i < tcb->rtx_num; ++i) {
+        gnrc_tcp_rtx_t *rtx = &tcb->rtx[(tcb->rtx_head + i) % RTX_ENTRIES];
+
+        /* Stop at segments not considered lost or exceeding the congestion window */
+        if (!LSS_32_BIT(rtx->seq, limit) || (rtx->seq + rtx->seq_con - ack) > tcb->cwnd) {
+            break;
+        }
+        if (LEQ_32_BIT(tcb->high_rxt, rtx->seq) && !rtx->sacked) {
+            DEBUG("gnrc_tcp_pkt.c : _resend_lost() : seq_num=%"PRIu32"\n", rtx->seq);
+            tcb->high_rxt = rtx->seq + rtx->seq_con;
+            rtx->retransmitted = 1;
+            gnrc_pktbuf_hold(rtx->pkt, 1);
+            gnrc_netapi_send(gnrc_tcp_pid, rtx->pkt);
+        }
+    }
+}
+
 int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
 {
     tcp_hdr_t tcp_hdr_out;
@@ -144,9 +241,17 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    /* Add MSS option if SYN is sent, SACK permitted option unless the peer did not send it */
+    bool sack_perm = (ctl & MSK_SYN) &&
+                     (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED));
+    uint8_t sack_len = 0;
     if (ctl & MSK_SYN) {
-        offset += 1;
+        offset += (sack_perm) ? 2 : 1;
+    }
+    /* Add SACK option if data was received out of order */
+    else if (ctl & MSK_ACK) {
+        sack_len = _option_build_sack(tcb, NULL);
+        offset += sack_len / sizeof(network_uint32_t);
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
@@ -172,8 +277,17 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             if (ctl & MSK_SYN) {
                 network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(_option_build_sack_perm());
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
+            }
+            if (sack_len > 0) {
+                _option_build_sack(tcb, opt_ptr);
+                opt_ptr += sack_len;
             }
-            /* Increase opt_ptr and decrease opt_ptr, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -217,16 +331,20 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
     }
     else {
         tcb->retries += 1;
     }
 
+    /* Any segment acknowledges the received data: a delayed ACK is not needed anymore */
+    if (tcb->status & STATUS_ACK_PENDING) {
+        tcb->status &= ~STATUS_ACK_PENDING;
+        xtimer_remove(&tcb->tim_ack);
+    }
+
     /* Pass packet down the network stack */
     gnrc_netapi_send(gnrc_tcp_pid, out_pkt);
     return 0;
@@ -296,9 +414,35 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+uint16_t _pkt_get_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    uint16_t smss = (tcb->mss < GNRC_TCP_MSS) ? tcb->mss : GNRC_TCP_MSS;
+
+#ifdef MODULE_GNRC_IPV6_PMTU
+    /* Respect a known path MTU towards the peer */
+    if (tcb->address_family == AF_INET6) {
+        uint16_t pmtu = gnrc_ipv6_pmtu_get((ipv6_addr_t *) tcb->peer_addr);
+        if (pmtu > 0) {
+            uint16_t pmss = pmtu - sizeof(ipv6_hdr_t) - sizeof(tcp_hdr_t);
+            smss = (smss < pmss) ? smss : pmss;
+        }
+    }
+#endif
+    return smss;
+}
+
+uint32_t _pkt_get_initial_cwnd(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _pkt_get_smss(tcb);
+
+    /* Initial window: min(4 * SMSS, max(2 * SMSS, 4380 bytes)) (see RFC 3390) */
+    return _min(4 * smss, _max(2 * smss, 4380));
+}
+
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
 {
     gnrc_pktsnip_t *snp = NULL;
+    gnrc_tcp_rtx_t *rtx = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
 
@@ -308,12 +452,6 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
     ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
@@ -324,21 +462,59 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+        /* Check if retransmit queue is full, the last entry is left to a FIN */
+        if (tcb->rtx_num >= ((ctl & MSK_FIN) ? RTX_ENTRIES : GNRC_TCP_RTX_QUEUE_SIZE)) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
+            return -ENOMEM;
         }
-        else {
-            tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* Append pkt to the queue and increase users: every send attempt consumes a user */
+        rtx = &tcb->rtx[(tcb->rtx_head + tcb->rtx_num) % RTX_ENTRIES];
+        rtx->pkt = pkt;
+        rtx->seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+        rtx->seq_con = _pkt_get_seg_len(pkt);
+        rtx->send_time = xtimer_now_usec();
+        rtx->retransmitted = 0;
+        rtx->sacked = 0;
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* The timer is running already if older segments are waiting for acknowledgment */
+        if (tcb->rtx_num++ > 0) {
+            return 0;
+        }
+        if (tcb->rto == RTO_UNINITIALIZED) {
+            _calc_rto(tcb);
         }
     }
     else {
+        /* Only the oldest segment is retransmitted on timeouts */
+        rtx = &tcb->rtx[tcb->rtx_head];
+        if (tcb->rtx_num == 0 || rtx->pkt != pkt) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt is not the oldest segment\n");
+            return -EINVAL;
+        }
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* A timeout signals congestion: fall back to slow start (see RFC 5681). The
+         * threshold is kept if this segment timed out before. */
+        uint32_t smss = _pkt_get_smss(tcb);
+        if (!rtx->retransmitted) {
+            tcb->ssthresh = _max((tcb->snd_nxt - tcb->snd_una) / 2, 2 * smss);
+        }
+        tcb->cwnd = smss;
+        tcb->recover = tcb->snd_nxt;
+        tcb->high_rxt = rtx->seq + rtx->seq_con;
+        tcb->dup_acks = 0;
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        tcb->status |= STATUS_RTO_RECOVERY;
+        rtx->retransmitted = 1;
+
+        /* The peer might have discarded selectively acknowledged data (see RFC 2018) */
+        for (unsigned i = 0; i < tcb->rtx_num; ++i) {
+            tcb->rtx[(tcb->rtx_head + i) % RTX_ENTRIES].sacked = 0;
+        }
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -349,68 +525,163 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
     }
-
-    /* Perform boundry checks on current RTO before usage */
-    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_tout.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+    _start_retransmit_timer(tcb);
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint32_t acked = 0;
+    uint32_t send_time = 0;
+    bool sample = true;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_num == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all segments that were acknowledged completely */
+    while (tcb->rtx_num > 0) {
+        gnrc_tcp_rtx_t *rtx = &tcb->rtx[tcb->rtx_head];
+
+        if (LSS_32_BIT(ack, rtx->seq + rtx->seq_con)) {
+            break;
+        }
+        /* Use time only if no acknowledged segment was retransmitted (Karns Alogrithm) */
+        if (rtx->retransmitted) {
+            sample = false;
+        }
+        send_time = rtx->send_time;
+        acked += rtx->seq_con;
+        gnrc_pktbuf_release(rtx->pkt);
+        rtx->pkt = NULL;
+        tcb->rtx_head = (tcb->rtx_head + 1) % RTX_ENTRIES;
+        tcb->rtx_num -= 1;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    xtimer_remove(&(tcb->tim_tout));
+    tcb->retries = 0;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+    /* Measure round trip time of the most recently sent segment that was acknowledged */
+    int32_t rtt = xtimer_now_usec() - send_time;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Use time only if ther was no timer overflow */
+    if (sample && rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / GNRC_TCP_RTO_B_DIV) * (GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += abs(tcb->srtt - rtt) / GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / GNRC_TCP_RTO_A_DIV) * (GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / GNRC_TCP_RTO_A_DIV;
+        }
+        _calc_rto(tcb);
+    }
 
-        /* Measure round trip time */
-        int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
+    /* Adjust congestion window. It is set up after the handshake, so a SYN does not count */
+    if (tcb->cwnd > 0) {
+        uint32_t smss = _pkt_get_smss(tcb);
+        tcb->dup_acks = 0;
 
-        /* Use time only if ther was no timer overflow and no retransmission (Karns Alogrithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / GNRC_TCP_RTO_B_DIV) * (GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += abs(tcb->srtt - rtt) / GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / GNRC_TCP_RTO_A_DIV) * (GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / GNRC_TCP_RTO_A_DIV;
-            }
+        /* Partial ACK during fast recovery: deflate window by the amount of new data
+         * acknowledged, the next lost segment is resent below (see RFC 6582) */
+        if ((tcb->status & STATUS_FAST_RECOVERY) && LSS_32_BIT(ack, tcb->recover)) {
+            tcb->cwnd = ((tcb->cwnd > acked) ? (tcb->cwnd - acked) : 0) + smss;
+        }
+        /* Full ACK: leave fast recovery with the reduced window */
+        else if (tcb->status & STATUS_FAST_RECOVERY) {
+            tcb->cwnd = _min(tcb->ssthresh, _max(tcb->snd_nxt - ack, smss) + smss);
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+            DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : Leave fast recovery\n");
         }
+        /* Grow congestion window: slow start or congestion avoidance (see RFC 5681).
+         * Slow start counts the bytes acknowledged, up to two segments per ACK, so a
+         * peer that delays its ACKs doesn't halve the growth. After a timeout, one
+         * segment per ACK is counted until slow start ends (see RFC 3465). */
+        else if (tcb->cwnd < tcb->ssthresh) {
+            tcb->cwnd += _min(acked, (tcb->status & STATUS_RTO_RECOVERY) ? smss : 2 * smss);
+        }
+        else {
+            tcb->status &= ~STATUS_RTO_RECOVERY;
+            tcb->cwnd += _max((smss * smss) / tcb->cwnd, 1);
+        }
+        tcb->cwnd = _min(tcb->cwnd, UINT16_MAX);
+    }
+
+    /* Restart timer for the oldest outstanding segment */
+    if (tcb->rtx_num > 0) {
+        if (LSS_32_BIT(ack, tcb->recover)) {
+            _resend_lost(tcb, ack);
+        }
+        _start_retransmit_timer(tcb);
     }
     return 0;
 }
 
+void _pkt_acknowledge_dup(gnrc_tcp_tcb_t *tcb)
+{
+    /* Only duplicates of ACKs for outstanding data after the handshake count */
+    if (tcb->rtx_num == 0 || tcb->cwnd == 0) {
+        return;
+    }
+    uint32_t smss = _pkt_get_smss(tcb);
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks += 1;
+    }
+
+    /* Selectively acknowledged segments count as well, as duplicate ACKs might be lost */
+    uint32_t dups = tcb->dup_acks;
+    uint32_t sacked = 0;
+    for (unsigned i = 0; i < tcb->rtx_num; ++i) {
+        sacked += tcb->rtx[(tcb->rtx_head + i) % RTX_ENTRIES].sacked;
+    }
+    dups = _max(dups, sacked);
+
+    /* Every further duplicate ACK signals a segment that left the network */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        tcb->cwnd = _min(tcb->cwnd + smss, UINT16_MAX);
+        _resend_lost(tcb, tcb->snd_una);
+    }
+    /* Fast retransmit, unless the window was reduced for this data already (see RFC 6582).
+     * With less segments outstanding than needed for enough duplicate ACKs, the threshold
+     * is lowered (Early Retransmit, see RFC 5827). */
+    else if (tcb->rtx_num > 1 &&
+             dups >= _min(GNRC_TCP_DUP_ACK_THRESHOLD, tcb->rtx_num - 1) &&
+             LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge_dup() : Enter fast recovery\n");
+        tcb->ssthresh = _max((tcb->snd_nxt - tcb->snd_una) / 2, 2 * smss);
+        tcb->cwnd = tcb->ssthresh + dups * smss;
+        tcb->recover = tcb->snd_nxt;
+        tcb->high_rxt = tcb->snd_una;
+        tcb->status |= STATUS_FAST_RECOVERY;
+        _resend_lost(tcb, tcb->snd_una);
+    }
+}
+
+void _pkt_sacked(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    /* Only blocks within the data in flight are meaningful */
+    if (!(LEQ_32_BIT(tcb->snd_una, left) && LSS_32_BIT(left, right) &&
+          LEQ_32_BIT(right, tcb->snd_nxt))) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_sacked() : SACK block out of range\n");
+        return;
+    }
+    for (unsigned i = 0; i < tcb->rtx_num; ++i) {
+        gnrc_tcp_rtx_t *rtx = &tcb->rtx[(tcb->rtx_head + i) % RTX_ENTRIES];
+
+        if (LEQ_32_BIT(left, rtx->seq) && LEQ_32_BIT(rtx->seq + rtx->seq_con, right)) {
+            rtx->sacked = 1;
+        }
+    }
+}
+
 uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr,
                         const gnrc_pktsnip_t *payload)
 {
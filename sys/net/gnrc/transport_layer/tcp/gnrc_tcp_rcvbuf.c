@@ -15,87 +15,258 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
-#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include <utlist.h>
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "internal/common.h"
 #include "internal/rcvbuf.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
 /**
- * @brief Internal struct holding receive buffers.
+ * @brief Lock for the receive budget.
  */
-rcvbuf_t _static_buf;
+static mutex_t _lock;
 
 /**
- * @brief Initializes all receive buffers.
+ * @brief Number of payload bytes held by the received segments of all connections.
  */
+static uint32_t _held;
+
 void _rcvbuf_init(void)
 {
     DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_init() : entry\n");
-    mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
-    }
+    mutex_init(&_lock);
+    _held = 0;
 }
 
 /**
- * @brief Allocate receive buffer.
+ * @brief Takes bytes from the receive budget.
  *
- * @returns   Not NULL if a receive buffer was allocated.
- *            NULL if allocation failed.
+ * @param[in] len   Number of bytes to take.
+ *
+ * @returns   True if the bytes were taken.
+ *            False if the budget is exhausted.
  */
-static void* _rcvbuf_alloc(void)
+static bool _budget_take(const uint32_t len)
 {
-    void *result = NULL;
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_alloc() : Entry\n");
-    mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
-        }
+    bool res = false;
+
+    mutex_lock(&_lock);
+    if (_held + len <= GNRC_TCP_RCV_BUDGET) {
+        _held += len;
+        res = true;
     }
-    mutex_unlock(&(_static_buf.lock));
-    return result;
+    mutex_unlock(&_lock);
+    return res;
+}
+
+/**
+ * @brief Returns bytes to the receive budget.
+ *
+ * @param[in] len   Number of bytes to return.
+ */
+static void _budget_give(const uint32_t len)
+{
+    mutex_lock(&_lock);
+    _held -= len;
+    mutex_unlock(&_lock);
+}
+
+/**
+ * @brief Releases a segment in the receive queue.
+ *
+ * @param[in,out] entry   Entry holding the segment.
+ */
+static void _release_entry(gnrc_tcp_rcv_seg_t *entry)
+{
+    _budget_give(entry->len);
+    gnrc_pktbuf_release(entry->pkt);
+    entry->pkt = NULL;
 }
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Copies the payload of a segment.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @param[in]  pkt   Segment holding the payload.
+ * @param[in]  off   Number of payload bytes to skip.
+ * @param[out] buf   Buffer to copy the payload into.
+ * @param[in]  len   Maximum number of bytes to copy.
+ *
+ * @returns   Number of bytes copied.
  */
-static void _rcvbuf_free(void * const buf)
+static size_t _copy_payload(gnrc_pktsnip_t *pkt, uint32_t off, uint8_t *buf, const size_t len)
 {
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_free() : Entry\n");
-    mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
+    gnrc_pktsnip_t *snp = NULL;
+    size_t copied = 0;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_UNDEF);
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF && copied < len) {
+        if (off >= snp->size) {
+            off -= snp->size;
         }
+        else {
+            size_t num = snp->size - off;
+            num = (num < len - copied) ? num : len - copied;
+            memcpy(buf + copied, (uint8_t *) snp->data + off, num);
+            copied += num;
+            off = 0;
+        }
+        snp = snp->next;
     }
-    mutex_unlock(&(_static_buf.lock));
+    return copied;
 }
 
-int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
+uint32_t _rcvbuf_add_segment(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const uint32_t seq,
+                             const uint32_t len)
 {
-    if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
-        if (tcb->rcv_buf_raw == NULL) {
-            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate rcv_buf_raw\n");
-            return -ENOMEM;
+    gnrc_tcp_rcv_seg_t *entry = NULL;
+    bool in_order = LEQ_32_BIT(seq, tcb->rcv_nxt);
+
+    /* Segment holds no new data */
+    if (LEQ_32_BIT(seq + len, tcb->rcv_nxt)) {
+        return 0;
+    }
+    for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+        gnrc_tcp_rcv_seg_t *cur = &(tcb->rcv_queue[i]);
+
+        if (cur->pkt == NULL) {
+            entry = (entry == NULL) ? cur : entry;
         }
-        else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+        /* Segment received out of order is kept already */
+        else if (cur->seq == seq && cur->len >= len) {
+            tcb->ooo_last = seq;
+            return 0;
+        }
+    }
+    if (!_budget_take(len)) {
+        DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add_segment() : Receive budget is exhausted\n");
+        return 0;
+    }
+
+    /* Data continuing the received data is kept in favor of the segment received out of
+     * order that is the farthest ahead */
+    if (entry == NULL && in_order) {
+        for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+            gnrc_tcp_rcv_seg_t *cur = &(tcb->rcv_queue[i]);
+
+            if (LSS_32_BIT(tcb->rcv_nxt, cur->seq) &&
+                (entry == NULL || LSS_32_BIT(entry->seq, cur->seq))) {
+                entry = cur;
+            }
+        }
+        if (entry != NULL) {
+            _release_entry(entry);
         }
     }
-    return 0;
+    if (entry == NULL) {
+        DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add_segment() : Receive queue is full\n");
+        _budget_give(len);
+        return 0;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+    entry->pkt = pkt;
+    entry->seq = seq;
+    entry->len = len;
+    if (!in_order) {
+        DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add_segment() : Keep seq_num=%"PRIu32"\n", seq);
+        tcb->ooo_last = seq;
+        return 0;
+    }
+
+    /* Advance over the new data and the segments received out of order it continues */
+    uint32_t old_nxt = tcb->rcv_nxt;
+    size_t i = 0;
+    tcb->rcv_nxt = seq + len;
+    while (i < GNRC_TCP_RCV_QUEUE_SIZE) {
+        gnrc_tcp_rcv_seg_t *cur = &(tcb->rcv_queue[i]);
+
+        if (cur->pkt != NULL && LEQ_32_BIT(cur->seq, tcb->rcv_nxt) &&
+            LSS_32_BIT(tcb->rcv_nxt, cur->seq + cur->len)) {
+            tcb->rcv_nxt = cur->seq + cur->len;
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+    return tcb->rcv_nxt - old_nxt;
+}
+
+size_t _rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    size_t rcvd = 0;
+
+    while (rcvd < len && LSS_32_BIT(tcb->rcv_user, tcb->rcv_nxt)) {
+        gnrc_tcp_rcv_seg_t *entry = NULL;
+
+        for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+            gnrc_tcp_rcv_seg_t *cur = &(tcb->rcv_queue[i]);
+
+            if (cur->pkt != NULL && LEQ_32_BIT(cur->seq, tcb->rcv_user) &&
+                LSS_32_BIT(tcb->rcv_user, cur->seq + cur->len)) {
+                entry = cur;
+                break;
+            }
+        }
+        /* Only a FIN follows */
+        if (entry == NULL) {
+            break;
+        }
+        size_t num = entry->seq + entry->len - tcb->rcv_user;
+        num = (num < len - rcvd) ? num : len - rcvd;
+        num = _copy_payload(entry->pkt, tcb->rcv_user - entry->seq, (uint8_t *) buf + rcvd, num);
+        if (num == 0) {
+            break;
+        }
+        rcvd += num;
+        tcb->rcv_user += num;
+    }
+
+    /* Release segments that were read completely */
+    for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+        gnrc_tcp_rcv_seg_t *cur = &(tcb->rcv_queue[i]);
+
+        if (cur->pkt != NULL && LEQ_32_BIT(cur->seq + cur->len, tcb->rcv_user)) {
+            _release_entry(cur);
+        }
+    }
+    return rcvd;
+}
+
+void _rcvbuf_update_window(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t unread = tcb->rcv_nxt - tcb->rcv_user;
+    uint32_t wnd = (unread < GNRC_TCP_DEFAULT_WINDOW) ? GNRC_TCP_DEFAULT_WINDOW - unread : 0;
+    size_t used = 0;
+
+    /* Further data can't be kept while all entries hold data */
+    for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+        used += (tcb->rcv_queue[i].pkt != NULL);
+    }
+    if (used == GNRC_TCP_RCV_QUEUE_SIZE) {
+        wnd = 0;
+    }
+
+    mutex_lock(&_lock);
+    uint32_t avail = (_held < GNRC_TCP_RCV_BUDGET) ? GNRC_TCP_RCV_BUDGET - _held : 0;
+    mutex_unlock(&_lock);
+    wnd = (wnd < avail) ? wnd : avail;
+    wnd = (wnd < UINT16_MAX) ? wnd : UINT16_MAX;
+
+    /* Never move the right edge of an advertised window to the left (see RFC 793) */
+    if (wnd > tcb->rcv_wnd) {
+        tcb->rcv_wnd = wnd;
+    }
 }
 
-void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+void _rcvbuf_release(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
-        tcb->rcv_buf_raw = NULL;
+    for (size_t i = 0; i < GNRC_TCP_RCV_QUEUE_SIZE; ++i) {
+        if (tcb->rcv_queue[i].pkt != NULL) {
+            _release_entry(&(tcb->rcv_queue[i]));
+        }
     }
 }
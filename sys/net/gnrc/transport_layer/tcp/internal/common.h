@@ -49,13 +49,25 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_WAIT_FOR_MSG   (1 << 3)
+#define STATUS_SACK_PERMITTED (1 << 4)
+#define STATUS_FAST_RECOVERY  (1 << 5)
+#define STATUS_NON_BLOCKING   (1 << 6)
+#define STATUS_WANT_WRITE     (1 << 7)
+#define STATUS_PROBING        (1 << 8)
+#define STATUS_ACK_PENDING    (1 << 9)
+#define STATUS_RTO_RECOVERY   (1 << 10)
 /** @} */
 
+/**
+ * @brief Number of entries in the retransmission queue, including the one reserved for a FIN.
+ */
+#define RTX_ENTRIES (GNRC_TCP_RTX_QUEUE_SIZE + 1U)
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
  */
-#define TCP_EVENTLOOP_MSG_QUEUE_SIZE (8U)
+#define TCP_EVENTLOOP_MSG_QUEUE_SIZE (16U)
 #define TCP_EVENTLOOP_PRIO           (THREAD_PRIORITY_MAIN - 2U)
 #define TCP_EVENTLOOP_STACK_SIZE     (THREAD_STACKSIZE_DEFAULT)
 /** @} */
@@ -89,6 +101,8 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104)
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105)
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106)
+#define MSG_TYPE_EVENTS             (GNRC_NETAPI_MSG_TYPE_ACK + 107)
+#define MSG_TYPE_DELAYED_ACK        (GNRC_NETAPI_MSG_TYPE_ACK + 108)
 /** @} */
 
 /**
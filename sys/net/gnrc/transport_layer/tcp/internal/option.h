@@ -44,6 +44,27 @@ inline static uint32_t _option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK permitted option, padded with two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+inline static uint32_t _option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) | ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Builds the SACK option reporting segments received out of order.
+ *
+ * @param[in]  tcb       TCB holding the segments received out of order.
+ * @param[out] opt_ptr   Option field to write the option to. NULL to get its size only.
+ *
+ * @returns   Size of the option in bytes, including padding. Zero if there is nothing to report.
+ */
+uint8_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr);
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -69,6 +90,18 @@ inline static uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
  */
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Marks the segments in the retransmission queue that the SACK option of a
+ *        given TCP header covers.
+ *
+ * @pre The segment carrying @p hdr was accepted and its options were parsed
+ *      by _option_parse().
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     hdr   TCP header to be parsed.
+ */
+void _option_parse_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -107,21 +107,46 @@ uint32_t _pkt_get_seg_len(gnrc_pktsnip_t *pkt);
  */
 uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief Calculates the maximum segment size to send to the peer.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The sender maximum segment size in bytes.
+ */
+uint16_t _pkt_get_smss(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Calculates the initial congestion window of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The initial congestion window in bytes.
+ */
+uint32_t _pkt_get_initial_cwnd(const gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * @note On retransmissions, @p pkt must be the oldest segment in the retransmission
+ *       queue. The retransmission timer is backed off and the congestion window is
+ *       reduced accordingly.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or @p retransmit is set and @p pkt is not the
+ *            oldest segment in the retransmission queue.
  */
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * @note Updates the round trip time estimation and the congestion window.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -131,6 +156,27 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Handles a duplicate acknowledgment.
+ *
+ * @note After @ref GNRC_TCP_DUP_ACK_THRESHOLD duplicate acknowledgments, the oldest segment
+ *       is retransmitted and fast recovery is entered (see RFC 5681 and RFC 6582).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _pkt_acknowledge_dup(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Marks segments in the retransmission queue as selectively acknowledged.
+ *
+ * Blocks outside of [snd_una, snd_nxt] are ignored.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    First sequence number of the acknowledged block.
+ * @param[in]     right   Sequence number following the acknowledged block.
+ */
+void _pkt_sacked(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -14,7 +14,7 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for queuing received data and calculating the receive window.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -22,8 +22,8 @@
 #ifndef RCVBUF_H
 #define RCVBUF_H
 
+#include <stddef.h>
 #include <stdint.h>
-#include "mutex.h"
 #include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -32,42 +32,56 @@ extern "C" {
 #endif
 
 /**
- * @brief Receive buffer entry.
+ * @brief   Initializes the receive budget shared by all connections.
  */
-typedef struct rcvbuf_entry {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} rcvbuf_entry_t;
+void _rcvbuf_init(void);
 
 /**
- * @brief   Stuct holding receive buffers.
+ * @brief Adds a received segment to the receive queue.
+ *
+ * The segment is held in the packet buffer until its payload was read. Payload that
+ * continues the received data advances rcv_nxt over it and over segments that were received
+ * out of order before and are continued by it now. Segments received out of order are kept
+ * as long as the receive queue has room for them.
+ *
+ * @param[in,out] tcb   TCB holding the receive queue.
+ * @param[in]     pkt   Received segment.
+ * @param[in]     seq   Sequence number of the received segment.
+ * @param[in]     len   Payload length of the received segment.
+ *
+ * @returns   Number of bytes rcv_nxt was advanced by.
  */
-typedef struct rcvbuf {
-    mutex_t lock;                                 /**< Lock for allocation synchronization */
-    rcvbuf_entry_t entries[GNRC_TCP_RCV_BUFFERS]; /**< Maintained receive buffers */
-} rcvbuf_t;
+uint32_t _rcvbuf_add_segment(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const uint32_t seq,
+                             const uint32_t len);
 
 /**
- * @brief   Initializes global receive buffer.
+ * @brief Reads received data and releases the segments that were read completely.
+ *
+ * @param[in,out] tcb   TCB holding the receive queue.
+ * @param[out]    buf   Buffer to store the data into.
+ * @param[in]     len   Size of @p buf.
+ *
+ * @returns   Number of bytes read.
  */
-void _rcvbuf_init(void);
+size_t _rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
 
 /**
- * @brief Allocate receive buffer and assign it to TCB.
+ * @brief Opens the receive window to the memory that is available to the connection.
  *
- * @param[in,out] tcb   TCB that aquires receive buffer.
+ * The window is limited by @ref GNRC_TCP_DEFAULT_WINDOW minus the data that was not read
+ * yet and by the part of @ref GNRC_TCP_RCV_BUDGET no connection holds. A window that was
+ * advertised before is never shrunk.
  *
- * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ * @param[in,out] tcb   TCB whose receive window is updated.
  */
-int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
+void _rcvbuf_update_window(gnrc_tcp_tcb_t *tcb);
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Releases all received segments.
  *
- * @param[in,out] tcb   TCB holding the receive buffer that should be released.
+ * @param[in,out] tcb   TCB holding the segments.
  */
-void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
+void _rcvbuf_release(gnrc_tcp_tcb_t *tcb);
 
 #ifdef __cplusplus
 }
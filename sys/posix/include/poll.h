@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  posix_poll
+ * @{
+ *
+ * @file
+ * @brief   POSIX compatible poll.h definitions
+ * @see     <a href="http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/poll.h.html">
+ *              The Open Group Base Specifications Issue 7, <poll.h>
+ *          </a>
+ */
+
+/* If building on native we need to use the system libraries instead */
+#ifdef CPU_NATIVE
+#pragma GCC system_header
+/* without the GCC pragma above #include_next will trigger a pedantic error */
+#include_next <poll.h>
+#else
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Event flags for struct pollfd
+ * @{
+ */
+#define POLLIN      (0x0001)    /**< data other than high-priority data may be
+                                 *   read without blocking */
+#define POLLPRI     (0x0002)    /**< high-priority data may be read without
+                                 *   blocking */
+#define POLLOUT     (0x0004)    /**< normal data may be written without
+                                 *   blocking */
+#define POLLERR     (0x0008)    /**< an error has occurred (revents only) */
+#define POLLHUP     (0x0010)    /**< device has been disconnected
+                                 *   (revents only) */
+#define POLLNVAL    (0x0020)    /**< invalid fd member (revents only) */
+#define POLLRDNORM  (0x0040)    /**< normal data may be read without blocking */
+#define POLLRDBAND  (0x0080)    /**< priority data may be read without
+                                 *   blocking */
+#define POLLWRNORM  (POLLOUT)   /**< equivalent to POLLOUT */
+#define POLLWRBAND  (0x0100)    /**< priority data may be written */
+/** @} */
+
+/**
+ * @brief   Type for the number of file descriptors in poll()
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   A file descriptor to poll
+ */
+struct pollfd {
+    int fd;         /**< file descriptor; ignored if negative */
+    short events;   /**< requested events */
+    short revents;  /**< returned events */
+};
+
+/**
+ * @brief   Waits for events on a set of file descriptors
+ *
+ * @see <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html">
+ *          The Open Group Base Specification Issue 7, poll
+ *      </a>
+ *
+ * @note    Stream (TCP) sockets provide no readiness and are returned with
+ *          `POLLERR`, see @ref posix_poll.
+ *
+ * @param[in,out] fds       File descriptors to wait for.
+ * @param[in] nfds          Number of entries in @p fds.
+ * @param[in] timeout       Timeout in milliseconds. 0 returns immediately,
+ *                          -1 waits indefinitely.
+ *
+ * @return  Number of entries in @p fds with a non-zero `revents` member.
+ * @return  0 on timeout.
+ * @return  -1 on error, errno is set accordingly.
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+
+#endif /* CPU_NATIVE */
+
+/** @} */
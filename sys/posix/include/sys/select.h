@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  posix_poll
+ * @{
+ *
+ * @file
+ * @brief   POSIX compatible sys/select.h definitions
+ * @see     <a href="http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/sys_select.h.html">
+ *              The Open Group Base Specifications Issue 7, <sys/select.h>
+ *          </a>
+ */
+
+/* If building on native we need to use the system libraries instead */
+#ifdef CPU_NATIVE
+#pragma GCC system_header
+/* without the GCC pragma above #include_next will trigger a pedantic error */
+#include_next <sys/select.h>
+#else
+#ifndef SYS_SELECT_H
+#define SYS_SELECT_H
+
+#include <string.h>
+#include <sys/time.h>   /* for struct timeval */
+#include <sys/types.h>  /* newlib may already define fd_set */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* newlib defines fd_set and its macros in sys/types.h */
+#ifndef _SYS_TYPES_FD_SET
+#ifndef FD_SETSIZE
+/**
+ * @brief   Maximum number of file descriptors in an fd_set
+ */
+#define FD_SETSIZE      (32)
+#endif
+
+/**
+ * @brief   Set of file descriptors
+ */
+typedef struct {
+    unsigned char fds[(FD_SETSIZE + 7) / 8];    /**< bit per file descriptor */
+} fd_set;
+
+/**
+ * @name    Operations on fd_set
+ * @{
+ */
+#define FD_SET(fd, set)     ((set)->fds[(fd) / 8] |= (1U << ((fd) % 8)))
+#define FD_CLR(fd, set)     ((set)->fds[(fd) / 8] &= ~(1U << ((fd) % 8)))
+#define FD_ISSET(fd, set)   (((set)->fds[(fd) / 8] & (1U << ((fd) % 8))) != 0)
+#define FD_ZERO(set)        memset((set), 0, sizeof(fd_set))
+/** @} */
+#endif /* _SYS_TYPES_FD_SET */
+
+/**
+ * @brief   Waits until one of a set of file descriptors is ready
+ *
+ * @see <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/select.html">
+ *          The Open Group Base Specification Issue 7, select
+ *      </a>
+ *
+ * @note    Stream (TCP) sockets provide no readiness and are returned as
+ *          ready for reading and writing, see @ref posix_poll.
+ *
+ * @param[in] nfds              Highest file descriptor in any set plus 1.
+ * @param[in,out] readfds       File descriptors to check for reading. May be
+ *                              NULL.
+ * @param[in,out] writefds      File descriptors to check for writing. May be
+ *                              NULL.
+ * @param[in,out] errorfds      File descriptors to check for errors. May be
+ *                              NULL.
+ * @param[in] timeout           Maximum time to wait. NULL to wait
+ *                              indefinitely.
+ *
+ * @return  Total number of bits set in the sets.
+ * @return  0 on timeout.
+ * @return  -1 on error, errno is set accordingly.
+ */
+int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
+           struct timeval *timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_SELECT_H */
+
+#endif /* CPU_NATIVE */
+
+/** @} */
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/select.h>
+
+#include "thread_flags.h"
+#include "timex.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   Timeout to wait indefinitely
+ */
+#define WAIT_FOREVER        (UINT64_MAX)
+
+/**
+ * @brief   Longest timeout set at once, xtimer_set_timeout_flag() takes 32 bit
+ */
+#define WAIT_MAX_US         (UINT32_MAX / 2)
+
+/**
+ * @brief   Error and hangup are reported without being requested
+ */
+#define POLL_ALWAYS         (POLLERR | POLLHUP)
+
+typedef struct {
+    struct pollfd *fds;
+    nfds_t nfds;
+} _poll_t;
+
+typedef struct {
+    int nfds;
+    fd_set *sets[3];        /**< readfds, writefds, errorfds of the caller */
+    fd_set in[3];           /**< requested file descriptors */
+} _select_t;
+
+/* events checked and reported per set of select() */
+static const short _select_req[] = { POLLIN, POLLOUT, POLLPRI };
+static const short _select_res[] = { POLLIN | POLLHUP | POLLERR,
+                                     POLLOUT | POLLERR, POLLPRI };
+
+/* calls check until it reports ready file descriptors, an error, or timeout
+ * (in microseconds) passed */
+static int _wait(int (*check)(void *), void *arg, uint64_t timeout)
+{
+    xtimer_t timer = { .target = 0, .long_target = 0 };
+    uint64_t start = xtimer_now_usec64();
+    int res;
+
+    thread_flags_clear(VFS_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    /* drivers notify from now on, so no change after a check is missed */
+    vfs_poll_wait_start();
+    while (((res = check(arg)) == 0) && (timeout != 0)) {
+        if (timeout != WAIT_FOREVER) {
+            uint64_t passed = xtimer_now_usec64() - start;
+
+            if (passed >= timeout) {
+                break;
+            }
+            xtimer_set_timeout_flag(&timer,
+                                    ((timeout - passed) > WAIT_MAX_US) ?
+                                    WAIT_MAX_US : (uint32_t)(timeout - passed));
+        }
+        thread_flags_wait_any(VFS_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+        xtimer_remove(&timer);
+    }
+    vfs_poll_wait_stop();
+    thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    return res;
+}
+
+static int _poll_check(void *arg)
+{
+    struct pollfd *fds = ((_poll_t *)arg)->fds;
+    int num = 0;
+
+    for (nfds_t i = 0; i < ((_poll_t *)arg)->nfds; i++) {
+        int res;
+
+        if (fds[i].fd < 0) {
+            fds[i].revents = 0;
+            continue;
+        }
+        res = vfs_poll(fds[i].fd, fds[i].events | POLL_ALWAYS);
+        if (res == -EBADF) {
+            fds[i].revents = POLLNVAL;
+        }
+        else if (res < 0) {
+            DEBUG("poll: error %d on fd %d\n", res, fds[i].fd);
+            fds[i].revents = POLLERR;
+        }
+        else {
+            fds[i].revents = res & (fds[i].events | POLL_ALWAYS);
+        }
+        if (fds[i].revents != 0) {
+            num++;
+        }
+    }
+    return num;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    _poll_t p = { .fds = fds, .nfds = nfds };
+
+    if ((nfds > 0) && (fds == NULL)) {
+        errno = EFAULT;
+        return -1;
+    }
+    return _wait(_poll_check, &p, (timeout < 0) ? WAIT_FOREVER :
+                 ((uint64_t)timeout * US_PER_MS));
+}
+
+static int _select_check(void *arg)
+{
+    _select_t *s = arg;
+    int num = 0;
+
+    for (unsigned i = 0; i < 3; i++) {
+        if (s->sets[i] != NULL) {
+            FD_ZERO(s->sets[i]);
+        }
+    }
+    for (int fd = 0; fd < s->nfds; fd++) {
+        short events = 0;
+        int res;
+
+        for (unsigned i = 0; i < 3; i++) {
+            if ((s->sets[i] != NULL) && FD_ISSET(fd, &s->in[i])) {
+                events |= _select_req[i];
+            }
+        }
+        if (events == 0) {
+            continue;
+        }
+        if ((res = vfs_poll(fd, events | POLL_ALWAYS)) == -EBADF) {
+            return res;
+        }
+        else if (res < 0) {
+            DEBUG("select: error %d on fd %d\n", res, fd);
+            res = POLLERR;
+        }
+        for (unsigned i = 0; i < 3; i++) {
+            if ((events & _select_req[i]) && (res & _select_res[i])) {
+                FD_SET(fd, s->sets[i]);
+                num++;
+            }
+        }
+    }
+    return num;
+}
+
+int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
+           struct timeval *timeout)
+{
+    _select_t s = { .nfds = nfds, .sets = { readfds, writefds, errorfds } };
+    uint64_t t = WAIT_FOREVER;
+    int res;
+
+    if ((nfds < 0) || (nfds > FD_SETSIZE)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (timeout != NULL) {
+        if ((timeout->tv_sec < 0) || (timeout->tv_usec < 0) ||
+            (timeout->tv_usec >= (long)US_PER_SEC)) {
+            errno = EINVAL;
+            return -1;
+        }
+        t = ((uint64_t)timeout->tv_sec * US_PER_SEC) + timeout->tv_usec;
+    }
+    for (unsigned i = 0; i < 3; i++) {
+        if (s.sets[i] != NULL) {
+            s.in[i] = *s.sets[i];
+        }
+    }
+    if ((res = _wait(_select_check, &s, t)) < 0) {
+        /* the sets are left unmodified on error */
+        for (unsigned i = 0; i < 3; i++) {
+            if (s.sets[i] != NULL) {
+                *s.sets[i] = s.in[i];
+            }
+        }
+        errno = -res;
+        return -1;
+    }
+    return res;
+}
+
+/** @} */
@@ -19,10 +19,12 @@
 #include <assert.h>
 #include <arpa/inet.h>
 #include <errno.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <string.h>
 
 #include "bitfield.h"
+#include "irq.h"
 #include "mutex.h"
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
@@ -35,6 +37,9 @@
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
 #include "net/sock/tcp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
@@ -74,6 +79,9 @@ typedef struct {
     uint32_t recv_timeout;
 #endif
     socket_sock_t *sock;
+#ifdef MODULE_SOCK_ASYNC
+    unsigned rcv_avail;         /* messages received but not read yet */
+#endif
 #ifdef MODULE_SOCK_TCP
     sock_tcp_t *queue_array;
     unsigned queue_array_len;
@@ -99,6 +107,8 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
 static ssize_t socket_sendto(socket_t *s, const void *buffer, size_t length,
                              int flags, const struct sockaddr *address,
                              socklen_t address_len);
+static int _bind_connect(socket_t *s, const struct sockaddr *address,
+                         socklen_t address_len);
 
 static socket_t *_get_free_socket(void)
 {
@@ -316,6 +326,35 @@ static inline ssize_t socket_write(vfs_file_t *filp, const void *buf, size_t n)
     return socket_sendto(filp->private_data.ptr, buf, n, 0, NULL, 0);
 }
 
+static int socket_poll(vfs_file_t *filp, int events)
+{
+    socket_t *s = filp->private_data.ptr;
+
+    (void)events;
+    switch (s->type) {
+#ifdef MODULE_SOCK_ASYNC
+#ifdef MODULE_SOCK_IP
+        case SOCK_RAW:
+#endif
+#ifdef MODULE_SOCK_UDP
+        case SOCK_DGRAM:
+#endif
+            /* bind implicitly, so datagrams to the bound address are
+             * received while waiting */
+            if ((s->sock == NULL) && s->bound &&
+                (_bind_connect(s, NULL, 0) < 0)) {
+                return -errno;
+            }
+            /* datagrams are sent without blocking */
+            return ((s->sock != NULL) && (s->rcv_avail > 0)) ?
+                   (POLLIN | POLLRDNORM | POLLOUT) : POLLOUT;
+#endif
+        default:
+            /* no readiness notifications from the sock */
+            return -EOPNOTSUPP;
+    }
+}
+
 static const vfs_file_ops_t socket_ops = {
     .close = socket_close,
     .fcntl = NULL,          /* TODO: provide when needed */
@@ -323,8 +362,52 @@ static const vfs_file_ops_t socket_ops = {
     .lseek = socket_lseek,
     .read = socket_read,
     .write = socket_write,
+    .poll = socket_poll,
 };
 
+#ifdef MODULE_SOCK_ASYNC
+static void _recv_event(socket_t *s, sock_async_flags_t flags)
+{
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        unsigned state = irq_disable();
+
+        s->rcv_avail++;
+        irq_restore(state);
+        vfs_poll_notify();
+    }
+}
+
+static void _read_event(socket_t *s, int res)
+{
+    /* every result but these took a received message from the sock */
+    if ((res != -EAGAIN) && (res != -ETIMEDOUT) && (res != -EINTR) &&
+        (res != -EADDRNOTAVAIL) && (res != -EINVAL)) {
+        unsigned state = irq_disable();
+
+        if (s->rcv_avail > 0) {
+            s->rcv_avail--;
+        }
+        irq_restore(state);
+    }
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _recv_event(arg, flags);
+}
+#endif
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _recv_event(arg, flags);
+}
+#endif
+#endif /* MODULE_SOCK_ASYNC */
+
 int socket(int domain, int type, int protocol)
 {
     int res = 0;
@@ -560,6 +643,12 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
             /* TODO apply flags if possible */
             res = sock_ip_create(&sock->raw, (sock_ip_ep_t *)local,
                                  (sock_ip_ep_t *)remote, s->protocol, 0);
+#ifdef MODULE_SOCK_ASYNC
+            if (res == 0) {
+                s->rcv_avail = 0;
+                sock_ip_set_cb(&sock->raw, _ip_cb, s);
+            }
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
@@ -574,6 +663,12 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
         case SOCK_DGRAM:
             /* TODO apply flags if possible */
             res = sock_udp_create(&sock->udp, local, remote, 0);
+#ifdef MODULE_SOCK_ASYNC
+            if (res == 0) {
+                s->rcv_avail = 0;
+                sock_udp_set_cb(&sock->udp, _udp_cb, s);
+            }
+#endif
             break;
 #endif
         default:
@@ -842,6 +937,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_RAW:
             res = sock_ip_recv(&s->sock->raw, buffer, length, recv_timeout,
                                (sock_ip_ep_t *)&ep);
+#ifdef MODULE_SOCK_ASYNC
+            _read_event(s, res);
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
@@ -854,6 +952,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_DGRAM:
             res = sock_udp_recv(&s->sock->udp, buffer, length, recv_timeout,
                                 &ep);
+#ifdef MODULE_SOCK_ASYNC
+            _read_event(s, res);
+#endif
             break;
 #endif
         default:
@@ -34,7 +34,7 @@ void _del_cb(void *ptr)
 {
     gnrc_sixlowpan_ctx_t *ctx = ptr;
     uint8_t cid = ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK;
-    ctx->prefix_len = 0;
+    gnrc_sixlowpan_ctx_remove(cid);
     gnrc_sixlowpan_nd_router_abr_rem_ctx(abr, cid);
     del_timer[cid].callback = NULL;
 }
@@ -134,8 +134,8 @@ int _gnrc_6ctx_del(char *cmd_str, char *ctx_str)
     else if (del_timer[cid].callback == NULL) {
         ctx = gnrc_sixlowpan_ctx_lookup_id(cid);
         if (ctx != NULL) {
-            ctx->flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
-            ctx->ltime = 0;
+            /* keep context for decompression only */
+            gnrc_sixlowpan_ctx_update(cid, &ctx->prefix, ctx->prefix_len, 0, false);
             del_timer[cid].callback = _del_cb;
             del_timer[cid].arg = ctx;
             xtimer_set(&del_timer[cid], GNRC_SIXLOWPAN_ND_RTR_MIN_CTX_DELAY * US_PER_SEC);
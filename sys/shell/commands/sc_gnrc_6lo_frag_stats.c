@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/sixlowpan/frag.h"
+
+int _gnrc_6lo_frag_stats(int argc, char **argv)
+{
+    gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+
+    (void)argc;
+    (void)argv;
+    printf("rbuf full: %" PRIu32 "\n", stats->rbuf_full);
+    printf("expired: %" PRIu32 "\n", stats->expired);
+    printf("discarded: %" PRIu32 "\n", stats->discarded);
+    printf("datagrams: %" PRIu32 "\n", stats->datagrams);
+    printf("forwarded: %" PRIu32 "\n", stats->forwarded);
+    printf("sfr retries: %" PRIu32 "\n", stats->sfr_retries);
+    printf("sfr aborted: %" PRIu32 "\n", stats->sfr_aborted);
+    printf("fragments sent: %" PRIu32 "\n", stats->frags_sent);
+    printf("fragment retries: %" PRIu32 "\n", stats->frag_retries);
+    printf("pacing delay: %" PRIu32 " us\n", stats->pacing_delay);
+    return 0;
+}
+
+/** @} */
@@ -23,6 +23,9 @@
 #include "net/gnrc/rpl/dodag.h"
 #include "utlist.h"
 #include "trickle.h"
+#ifdef MODULE_NETSTATS_NEIGHBOR
+#include "net/netstats/neighbor.h"
+#endif
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -286,6 +289,24 @@ int _gnrc_rpl_dodag_show(void)
                (int) cleanup, (1 << dodag->dio_min), dodag->dio_interval_doubl, dodag->trickle.k,
                dodag->trickle.c, (uint32_t) (tc & 0xFFFFFFFF));
 
+#ifdef MODULE_GNRC_RPL_ADAPTIVE_REDUN
+        printf("\tneighbors: %u\n", gnrc_rpl_density_get(dodag));
+#endif
+
+        printf("\tDIO [TX: %" PRIu32 " | RX: %" PRIu32 " | suppressed: %" PRIu32
+               "] DIS [TX: %" PRIu32 " | RX: %" PRIu32 "]\n",
+               dodag->stats.dio_sent, dodag->stats.dio_received,
+               dodag->stats.dio_suppressed, dodag->stats.dis_sent,
+               dodag->stats.dis_received);
+        printf("\tDAO [TX: %" PRIu32 " | RX: %" PRIu32 " | merged: %" PRIu32
+               " | suppressed: %" PRIu32 "] DAO-ACK [TX: %" PRIu32 " | RX: %"
+               PRIu32 "]\n",
+               dodag->stats.dao_sent, dodag->stats.dao_received,
+               dodag->stats.dao_merged, dodag->stats.dao_suppressed,
+               dodag->stats.dao_ack_sent, dodag->stats.dao_ack_received);
+        printf("\tparent switches: %" PRIu32 " | rank changes: %" PRIu32 "\n",
+               dodag->stats.parent_switches, dodag->stats.rank_changes);
+
 #ifdef MODULE_GNRC_RPL_P2P
         if (dodag->instance->mop == GNRC_RPL_P2P_MOP) {
             gnrc_rpl_p2p_ext_t *p2p_ext = gnrc_rpl_p2p_ext_get(dodag);
@@ -298,9 +319,21 @@ int _gnrc_rpl_dodag_show(void)
 
         gnrc_rpl_parent_t *parent;
         LL_FOREACH(gnrc_rpl_instances[i].dodag.parents, parent) {
+#ifdef MODULE_NETSTATS_NEIGHBOR
+            unsigned etx = netstats_nb_etx(gnrc_rpl_instances[i].dodag.iface,
+                                           (eui64_t *)&parent->addr.u64[1]);
+
+            printf("\t\tparent [addr: %s | rank: %d | lifetime: %" PRIu32 "s"
+                   " | etx: %u.%02u]\n",
+                    ipv6_addr_to_str(addr_str, &parent->addr, sizeof(addr_str)),
+                    parent->rank, parent->lifetime,
+                    etx / NETSTATS_NB_ETX_DIVISOR,
+                    ((etx % NETSTATS_NB_ETX_DIVISOR) * 100) / NETSTATS_NB_ETX_DIVISOR);
+#else
             printf("\t\tparent [addr: %s | rank: %d | lifetime: %" PRIu32 "s]\n",
                     ipv6_addr_to_str(addr_str, &parent->addr, sizeof(addr_str)),
                     parent->rank, parent->lifetime);
+#endif
         }
     }
     return 0;
@@ -552,7 +552,8 @@ static void _netif_list(kernel_pid_t dev)
 
 static int _netif_set_u16(kernel_pid_t dev, netopt_t opt, char *u16_str)
 {
-    unsigned int res;
+    unsigned long res;
+    uint16_t val;
     bool hex = false;
 
     if (_is_number(u16_str)) {
@@ -578,7 +579,8 @@ static int _netif_set_u16(kernel_pid_t dev, netopt_t opt, char *u16_str)
         return 1;
     }
 
-    if (gnrc_netapi_set(dev, opt, 0, (uint16_t *)&res, sizeof(uint16_t)) < 0) {
+    val = (uint16_t)res;
+    if (gnrc_netapi_set(dev, opt, 0, &val, sizeof(val)) < 0) {
         printf("error: unable to set ");
         _print_netopt(opt);
         puts("");
@@ -590,10 +592,10 @@ static int _netif_set_u16(kernel_pid_t dev, netopt_t opt, char *u16_str)
     printf(" on interface %" PRIkernel_pid " to ", dev);
 
     if (hex) {
-        printf("0x%04x\n", res);
+        printf("0x%04x\n", (unsigned)val);
     }
     else {
-        printf("%u\n", res);
+        printf("%u\n", (unsigned)val);
     }
 
     return 0;
@@ -30,6 +30,7 @@
 #include <unistd.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #endif
 #include "uart_stdio.h"
 
@@ -55,6 +56,7 @@ isrpipe_t uart_stdio_isrpipe = ISRPIPE_INIT(_rx_buf_mem);
 #if MODULE_VFS
 static ssize_t uart_stdio_vfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
 static ssize_t uart_stdio_vfs_write(vfs_file_t *filp, const void *src, size_t nbytes);
+static int uart_stdio_vfs_poll(vfs_file_t *filp, int events);
 
 /**
  * @brief VFS file operation table for stdin/stdout/stderr
@@ -62,6 +64,7 @@ static ssize_t uart_stdio_vfs_write(vfs_file_t *filp, const void *src, size_t nb
 static vfs_file_ops_t uart_stdio_vfs_ops = {
     .read = uart_stdio_vfs_read,
     .write = uart_stdio_vfs_write,
+    .poll = uart_stdio_vfs_poll,
 };
 
 static ssize_t uart_stdio_vfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
@@ -81,14 +84,42 @@ static ssize_t uart_stdio_vfs_write(vfs_file_t *filp, const void *src, size_t nb
     }
     return uart_stdio_write(src, nbytes);
 }
+
+static int uart_stdio_vfs_poll(vfs_file_t *filp, int events)
+{
+    int fd = filp->private_data.value;
+    (void)events;
+    if (fd != STDIN_FILENO) {
+        /* writes block only until the UART sent the data */
+        return POLLOUT;
+    }
+    return (tsrb_avail(&uart_stdio_isrpipe.tsrb) > 0) ? (POLLIN | POLLRDNORM) : 0;
+}
+#endif
+
+void uart_stdio_rx_cb(void *arg, uint8_t data)
+{
+#if MODULE_VFS
+    isrpipe_t *isrpipe = arg;
+    int was_empty = tsrb_empty(&isrpipe->tsrb);
+
+    isrpipe_write_one(isrpipe, (char)data);
+    /* stdin became readable for poll(): a waiter found it empty before, so
+     * only this transition needs to wake it up */
+    if (was_empty) {
+        vfs_poll_notify();
+    }
+#else
+    isrpipe_write_one(arg, (char)data);
 #endif
+}
 
 void uart_stdio_init(void)
 {
 #ifndef USE_ETHOS_FOR_STDIO
-    uart_init(UART_STDIO_DEV, UART_STDIO_BAUDRATE, (uart_rx_cb_t) isrpipe_write_one, &uart_stdio_isrpipe);
+    uart_init(UART_STDIO_DEV, UART_STDIO_BAUDRATE, uart_stdio_rx_cb, &uart_stdio_isrpipe);
 #else
-    uart_init(ETHOS_UART, ETHOS_BAUDRATE, (uart_rx_cb_t) isrpipe_write_one, &uart_stdio_isrpipe);
+    uart_init(ETHOS_UART, ETHOS_BAUDRATE, uart_stdio_rx_cb, &uart_stdio_isrpipe);
 #endif
 #if MODULE_VFS
     int fd;
@@ -21,12 +21,18 @@
 #include <sys/stat.h> /* for struct stat */
 #include <sys/statvfs.h> /* for struct statvfs */
 #include <fcntl.h> /* for O_ACCMODE, ..., fcntl */
+#include <poll.h> /* for POLLIN, POLLOUT */
 
 #include "vfs.h"
 #include "mutex.h"
 #include "thread.h"
 #include "kernel_types.h"
 #include "clist.h"
+#ifdef MODULE_CORE_THREAD_FLAGS
+#include "bitfield.h"
+#include "irq.h"
+#include "thread_flags.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -49,6 +55,20 @@
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+#ifdef MODULE_CORE_THREAD_FLAGS
+/**
+ * @internal
+ * @brief Threads waiting in vfs_poll_wait_start(), indexed by PID
+ */
+BITFIELD(_poll_waiters, MAXTHREADS);
+
+/**
+ * @internal
+ * @brief Number of threads waiting in vfs_poll_wait_start()
+ */
+static volatile unsigned _poll_waiting;
+#endif
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -332,6 +352,54 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
     return filp->f_op->write(filp, src, count);
 }
 
+int vfs_poll(int fd, int events)
+{
+    DEBUG_NOT_STDOUT(fd, "vfs_poll: %d, 0x%x\n", fd, events);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->poll == NULL) {
+        /* like regular files, files that can't tell never block */
+        return events & (POLLIN | POLLRDNORM | POLLOUT | POLLWRNORM);
+    }
+    return filp->f_op->poll(filp, events);
+}
+
+#ifdef MODULE_CORE_THREAD_FLAGS
+void vfs_poll_wait_start(void)
+{
+    unsigned state = irq_disable();
+    bf_set(_poll_waiters, thread_getpid() - KERNEL_PID_FIRST);
+    _poll_waiting++;
+    irq_restore(state);
+}
+
+void vfs_poll_wait_stop(void)
+{
+    unsigned state = irq_disable();
+    bf_unset(_poll_waiters, thread_getpid() - KERNEL_PID_FIRST);
+    _poll_waiting--;
+    irq_restore(state);
+}
+
+void vfs_poll_notify(void)
+{
+    if (_poll_waiting == 0) {
+        return;
+    }
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = (thread_t *)thread_get(pid);
+
+        if ((thread != NULL) &&
+            bf_isset(_poll_waiters, pid - KERNEL_PID_FIRST)) {
+            thread_flags_set(thread, VFS_POLL_THREAD_FLAG);
+        }
+    }
+}
+#endif
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
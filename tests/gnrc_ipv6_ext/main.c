@@ -233,6 +233,102 @@ static void _send_packet_parsed(void)
     assert(pkt->users == 0);
 }
 
+static void _send_packet_parsed_two_ext(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+
+    gnrc_netif_get(ifs);
+
+    gnrc_netif_hdr_t netif_hdr;
+
+    gnrc_netif_hdr_init(&netif_hdr, 8, 8);
+
+    netif_hdr.if_pid = ifs[0];
+
+    uint8_t ipv6_data[] = {
+        /* IPv6 Header */
+        0x60, 0x00, 0x00, 0x00, /* version, traffic class, flow label */
+        0x00, 0x1a,             /* payload length: 26 */
+        0x00,                   /* next header: Hop-by-Hop Option */
+        0x10,                   /* hop limit: 16 */
+        /* source address: fd01::1 */
+        0xfd, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01,
+        /* destination address: fd01::2 */
+        0xfd, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x02,
+    };
+
+    uint8_t hop_by_hop_options_data[] = {
+        /* Hop-by-Hop Options Header */
+        0x3c,       /* next header: IPv6-Opts */
+        0x00,       /* hdr ext len: 0 * 8 + 8 = 8 */
+        0x01,       /* option type: PadN */
+        0x04,       /* opt data len: 4 */
+        0x00, 0x00, 0x00, 0x00,
+    };
+
+    uint8_t dst_options_data[] = {
+        /* Destination Options Header */
+        0x11,       /* next header: UDP */
+        0x00,       /* hdr ext len: 0 * 8 + 8 = 8 */
+        0x01,       /* option type: PadN */
+        0x04,       /* opt data len: 4 */
+        0x00, 0x00, 0x00, 0x00,
+    };
+
+    uint8_t udp_data[] = {
+        /* UDP (ignored) */
+        0x1f, 0x90, /* source port: 8080 */
+        0x1f, 0x90, /* destination port: 8080 */
+        0x00, 0x0a, /* length: 10 */
+        0xff, 0xff, /* checksum */
+    };
+
+    uint8_t udp_payload[] = {
+        0x00, 0x00,
+    };
+
+    gnrc_pktsnip_t *netif =
+        gnrc_pktbuf_add(NULL,
+                        &netif_hdr,
+                        sizeof(netif_hdr),
+                        GNRC_NETTYPE_NETIF);
+    gnrc_pktsnip_t *ipv6 =
+        gnrc_pktbuf_add(netif,
+                        &ipv6_data,
+                        sizeof(ipv6_data),
+                        GNRC_NETTYPE_IPV6);
+    gnrc_pktsnip_t *hop_by_hop_options =
+        gnrc_pktbuf_add(ipv6,
+                        &hop_by_hop_options_data,
+                        sizeof(hop_by_hop_options_data),
+                        GNRC_NETTYPE_IPV6_EXT);
+    gnrc_pktsnip_t *dst_options =
+        gnrc_pktbuf_add(hop_by_hop_options,
+                        &dst_options_data,
+                        sizeof(dst_options_data),
+                        GNRC_NETTYPE_IPV6_EXT);
+    gnrc_pktsnip_t *udp =
+        gnrc_pktbuf_add(dst_options,
+                        udp_data,
+                        sizeof(udp_data),
+                        GNRC_NETTYPE_UDP);
+    gnrc_pktsnip_t *pkt =
+        gnrc_pktbuf_add(udp,
+                        &udp_payload,
+                        sizeof(udp_payload),
+                        GNRC_NETTYPE_UNDEF);
+
+    gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+
+    printf("pkt->users: %d\n", pkt->users);
+    assert(pkt->users == 0);
+}
 
 int main(void)
 {
@@ -241,6 +337,7 @@ int main(void)
     _init_interface();
     _send_packet_raw();
     _send_packet_parsed();
+    _send_packet_parsed_two_ext();
 
     /* should be never reached */
     return 0;
@@ -22,6 +22,7 @@ def testfunc(child):
     if index == 1:
         # debug is disabled
         child.expect_exact("pkt->users: 0")
+        child.expect_exact("pkt->users: 0")
         return
 
     child.expect_exact("ipv6: handle extension header (nh = 0)")
@@ -38,6 +39,10 @@ def testfunc(child):
     child.expect_exact("ipv6: handle extension header (nh = 0)")
     child.expect_exact("ipv6: forward nh = 17 to other threads")
     child.expect_exact("pkt->users: 0")
+    child.expect_exact("ipv6: Received (src = fd01::1, dst = fd01::2, next header = 0, length = 26)")
+    child.expect_exact("ipv6: handle extension header (nh = 0)")
+    child.expect_exact("ipv6: forward nh = 17 to other threads")
+    child.expect_exact("pkt->users: 0")
 
 if __name__ == "__main__":
     sys.exit(testrunner.run(testfunc))
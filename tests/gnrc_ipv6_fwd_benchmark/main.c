@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the IPv6 forwarding path of GNRC
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "shell.h"
+#include "xtimer.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/ipv6/netif.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BENCH_DEFAULT_SEC   (10U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static void _init_interfaces(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+    size_t numof = gnrc_netif_get(ifs);
+    ipv6_addr_t addr = IPV6_ADDR_UNSPECIFIED;
+
+    if (numof < 2) {
+        puts("error: benchmark needs two interfaces (start with tap0 tap1)");
+        return;
+    }
+    for (unsigned i = 0; i < 2; i++) {
+        /* fd0<i + 1>::1/64 */
+        addr.u8[0] = 0xfd;
+        addr.u8[1] = i + 1;
+        addr.u8[15] = 0x01;
+        gnrc_ipv6_netif_add_addr(ifs[i], &addr, 64,
+                                 GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST);
+        printf("interface %" PRIkernel_pid ": fd0%u::1/64\n", ifs[i], i + 1);
+    }
+}
+
+static uint32_t _rx_count(kernel_pid_t iface)
+{
+    return gnrc_ipv6_netif_get_stats(iface)->rx_count;
+}
+
+static uint32_t _tx_count(kernel_pid_t iface)
+{
+    return gnrc_ipv6_netif_get_stats(iface)->tx_unicast_count;
+}
+
+static int _fwd_bench(int argc, char **argv)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+    uint32_t rx[2], tx[2], start, duration;
+    unsigned sec = BENCH_DEFAULT_SEC;
+
+    if (gnrc_netif_get(ifs) < 2) {
+        puts("error: benchmark needs two interfaces");
+        return 1;
+    }
+    if (argc > 1) {
+        sec = atoi(argv[1]);
+    }
+    for (unsigned i = 0; i < 2; i++) {
+        rx[i] = _rx_count(ifs[i]);
+        tx[i] = _tx_count(ifs[i]);
+    }
+    start = xtimer_now_usec();
+    xtimer_sleep(sec);
+    duration = xtimer_now_usec() - start;
+    for (unsigned i = 0; i < 2; i++) {
+        rx[i] = _rx_count(ifs[i]) - rx[i];
+        tx[i] = _tx_count(ifs[i]) - tx[i];
+        printf("if %" PRIkernel_pid ": rx %" PRIu32 " packets, tx %" PRIu32
+               " packets\n", ifs[i], rx[i], tx[i]);
+    }
+    printf("forwarded %" PRIu32 " packets in %" PRIu32 " us (%" PRIu32
+           " packets/s)\n", tx[0] + tx[1], duration,
+           (uint32_t)(((uint64_t)(tx[0] + tx[1]) * US_PER_SEC) / duration));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "fwd_bench", "measure forwarding rate for [seconds]", _fwd_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC IPv6 forwarding benchmark");
+    _init_interfaces();
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
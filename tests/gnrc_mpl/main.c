@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Multi-node test for MPL dissemination
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "byteorder.h"
+#include "msg.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/mpl.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/udp.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define RCV_QUEUE_SIZE      (8)
+#define TEST_PORT           (61616U)
+#define TEST_MSG_IDS        (256U)
+#define TEST_DEFAULT_GAP    (100U)  /* ms */
+
+/* realm-local test group ff03::1:1 */
+static const ipv6_addr_t _group = {{ 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01 }};
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static msg_t _rcv_msg_queue[RCV_QUEUE_SIZE];
+static char _rcv_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netreg_entry_t _rcv_reg;
+static BITFIELD(_seen, TEST_MSG_IDS);
+static uint32_t _delivered, _delivered_dup;
+
+static void _init_interfaces(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+    size_t numof = gnrc_netif_get(ifs);
+
+    for (size_t i = 0; i < numof; i++) {
+        gnrc_ipv6_netif_t *netif = gnrc_ipv6_netif_get(ifs[i]);
+        ipv6_addr_t addr = IPV6_ADDR_UNSPECIFIED;
+
+        if (netif == NULL) {
+            continue;
+        }
+        /* MPL seed IDs must not be link-local: derive fd00::<IID> from the
+         * link-local address */
+        for (unsigned j = 0; j < GNRC_IPV6_NETIF_ADDR_NUMOF; j++) {
+            /* ff02::1 is link-local, too */
+            if (ipv6_addr_is_link_local(&netif->addrs[j].addr) &&
+                !ipv6_addr_is_multicast(&netif->addrs[j].addr)) {
+                memcpy(&addr.u64[1], &netif->addrs[j].addr.u64[1],
+                       sizeof(addr.u64[1]));
+                break;
+            }
+        }
+        addr.u8[0] = 0xfd;
+        gnrc_ipv6_netif_add_addr(ifs[i], &addr, 64,
+                                 GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST);
+        gnrc_ipv6_netif_add_addr(ifs[i], &_group, IPV6_ADDR_BIT_LEN, 0);
+        if (gnrc_mpl_init(ifs[i]) == KERNEL_PID_UNDEF) {
+            printf("error: unable to enable MPL on interface %" PRIkernel_pid
+                   "\n", ifs[i]);
+        }
+    }
+}
+
+static void *_rcv_thread(void *args)
+{
+    msg_t msg;
+
+    (void)args;
+    msg_init_queue(_rcv_msg_queue, RCV_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+            if (pkt->size >= sizeof(uint32_t)) {
+                unsigned id = byteorder_ntohl(*(network_uint32_t *)pkt->data) %
+                              TEST_MSG_IDS;
+
+                if (bf_isset(_seen, id)) {
+                    _delivered_dup++;
+                }
+                else {
+                    bf_set(_seen, id);
+                    _delivered++;
+                }
+            }
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+    return NULL;
+}
+
+static int _mpl_send(int argc, char **argv)
+{
+    static uint32_t id = 0;
+    unsigned count, gap = TEST_DEFAULT_GAP;
+
+    if (argc < 2) {
+        printf("usage: %s <count> [<gap in ms>]\n", argv[0]);
+        return 1;
+    }
+    count = atoi(argv[1]);
+    if (argc > 2) {
+        gap = atoi(argv[2]);
+    }
+    for (unsigned i = 0; i < count; i++) {
+        network_uint32_t data = byteorder_htonl(id++);
+        gnrc_pktsnip_t *pkt;
+        int res;
+
+        pkt = gnrc_pktbuf_add(NULL, &data, sizeof(data), GNRC_NETTYPE_UNDEF);
+        if (pkt != NULL) {
+            gnrc_pktsnip_t *udp = gnrc_udp_hdr_build(pkt, TEST_PORT, TEST_PORT);
+
+            if (udp == NULL) {
+                gnrc_pktbuf_release(pkt);
+                pkt = NULL;
+            }
+            else {
+                pkt = udp;
+            }
+        }
+        if (pkt != NULL) {
+            gnrc_pktsnip_t *ipv6 = gnrc_ipv6_hdr_build(pkt, NULL, &_group);
+
+            if (ipv6 == NULL) {
+                gnrc_pktbuf_release(pkt);
+                pkt = NULL;
+            }
+            else {
+                pkt = ipv6;
+            }
+        }
+        if (pkt == NULL) {
+            puts("error: packet buffer full");
+            return 1;
+        }
+        if ((res = gnrc_mpl_send(pkt)) < 0) {
+            printf("error: unable to seed message (%d)\n", res);
+            return 1;
+        }
+        xtimer_usleep(gap * US_PER_MS);
+    }
+    printf("seeded %u messages\n", count);
+    return 0;
+}
+
+static int _mpl_stats(int argc, char **argv)
+{
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        memset(&gnrc_mpl_stats, 0, sizeof(gnrc_mpl_stats));
+        memset(_seen, 0, sizeof(_seen));
+        _delivered = 0;
+        _delivered_dup = 0;
+        return 0;
+    }
+    printf("seeded: %" PRIu32 ", received: %" PRIu32 ", duplicates: %" PRIu32
+           ", transmissions: %" PRIu32 ", evicted: %" PRIu32 "\n",
+           gnrc_mpl_stats.seeded, gnrc_mpl_stats.rx, gnrc_mpl_stats.rx_dup,
+           gnrc_mpl_stats.tx, gnrc_mpl_stats.evicted);
+    printf("delivered: %" PRIu32 ", delivered twice: %" PRIu32 "\n",
+           _delivered, _delivered_dup);
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "mpl_send", "seed messages to ff03::1:1", _mpl_send },
+    { "mpl_stats", "print (or reset) MPL and delivery counters", _mpl_stats },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    _init_interfaces();
+    _rcv_reg.demux_ctx = TEST_PORT;
+    _rcv_reg.target.pid = thread_create(_rcv_stack, sizeof(_rcv_stack),
+                                        THREAD_PRIORITY_MAIN - 1,
+                                        THREAD_CREATE_STACKTEST, _rcv_thread,
+                                        NULL, "mpl_rcv");
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_rcv_reg);
+
+    puts("MPL test application");
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
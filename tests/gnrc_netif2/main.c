@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <errno.h>
 #include <stdio.h>
 
@@ -81,6 +82,10 @@ static void _set_up(void)
                sizeof(ethernet_netif->ipv6.addrs));
         memset(ethernet_netif->ipv6.groups, 0,
                sizeof(ethernet_netif->ipv6.groups));
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+        memset(ethernet_netif->ipv6.src_cache, 0,
+               sizeof(ethernet_netif->ipv6.src_cache));
+#endif
     }
     if (ieee802154_netif != NULL) {
         memset(ieee802154_netif->ipv6.addrs_flags, 0,
@@ -89,6 +94,10 @@ static void _set_up(void)
                sizeof(ieee802154_netif->ipv6.addrs));
         memset(ieee802154_netif->ipv6.groups, 0,
                sizeof(ieee802154_netif->ipv6.groups));
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+        memset(ieee802154_netif->ipv6.src_cache, 0,
+               sizeof(ieee802154_netif->ipv6.src_cache));
+#endif
     }
     for (unsigned i = 0; i < DEFAULT_DEVS_NUMOF; i++) {
         if (netifs[i] != NULL) {
@@ -96,6 +105,10 @@ static void _set_up(void)
                    sizeof(netifs[i]->ipv6.addrs_flags));
             memset(netifs[i]->ipv6.addrs, 0, sizeof(netifs[i]->ipv6.addrs));
             memset(netifs[i]->ipv6.groups, 0, sizeof(netifs[i]->ipv6.groups));
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+            memset(netifs[i]->ipv6.src_cache, 0,
+                   sizeof(netifs[i]->ipv6.src_cache));
+#endif
         }
     }
     /* empty message queue */
@@ -430,6 +443,45 @@ static void test_ipv6_addr_best_src__other_subnet(void)
     TEST_ASSERT(!ipv6_addr_is_unspecified(out));
 }
 
+static void test_ipv6_addr_best_src__cache_flushed_on_add(void)
+{
+    static const ipv6_addr_t addr1 = { .u8 = NETIF0_IPV6_G };
+    static const ipv6_addr_t addr2 = { .u8 = GLOBAL_PFX18 };
+    static const ipv6_addr_t ll_addr = { .u8 = NETIF0_IPV6_LL };
+    ipv6_addr_t *out;
+
+    /* adds a link-local address */
+    test_ipv6_addr_add__success();
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif2_ipv6_addr_best_src(netifs[0],
+                                                               &addr2,
+                                                               false)));
+    TEST_ASSERT(ipv6_addr_equal(&ll_addr, out));
+    /* second lookup is answered from the cache */
+    TEST_ASSERT(out == gnrc_netif2_ipv6_addr_best_src(netifs[0], &addr2,
+                                                      false));
+    TEST_ASSERT(0 <= gnrc_netif2_ipv6_addr_add(netifs[0], &addr1, 64U,
+                                               GNRC_NETIF2_IPV6_ADDRS_FLAGS_STATE_VALID));
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif2_ipv6_addr_best_src(netifs[0],
+                                                               &addr2,
+                                                               false)));
+    TEST_ASSERT(ipv6_addr_equal(&addr1, out));
+}
+
+static void test_ipv6_addr_best_src__cache_flushed_on_remove(void)
+{
+    static const ipv6_addr_t addr1 = { .u8 = NETIF0_IPV6_G };
+    static const ipv6_addr_t addr2 = { .u8 = GLOBAL_PFX18 };
+    static const ipv6_addr_t ll_addr = { .u8 = NETIF0_IPV6_LL };
+    ipv6_addr_t *out;
+
+    test_ipv6_addr_best_src__multicast_input();
+    gnrc_netif2_ipv6_addr_remove(netifs[0], &addr1);
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif2_ipv6_addr_best_src(netifs[0],
+                                                               &addr2,
+                                                               false)));
+    TEST_ASSERT(ipv6_addr_equal(&ll_addr, out));
+}
+
 static void test_get_by_ipv6_addr__empty(void)
 {
     static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_LL };
@@ -1345,6 +1397,8 @@ static Test *embunit_tests_gnrc_netif2(void)
         new_TestFixture(test_ipv6_addr_match__success64),
         new_TestFixture(test_ipv6_addr_best_src__multicast_input),
         new_TestFixture(test_ipv6_addr_best_src__other_subnet),
+        new_TestFixture(test_ipv6_addr_best_src__cache_flushed_on_add),
+        new_TestFixture(test_ipv6_addr_best_src__cache_flushed_on_remove),
         new_TestFixture(test_get_by_ipv6_addr__empty),
         new_TestFixture(test_get_by_ipv6_addr__success),
         new_TestFixture(test_get_by_prefix__empty),
@@ -1387,6 +1441,37 @@ static Test *embunit_tests_gnrc_netif2(void)
     return (Test *)&tests;
 }
 
+#define BEST_SRC_BENCH_NUMOF    (1000U)
+
+static void bench_ipv6_addr_best_src(void)
+{
+    static const ipv6_addr_t ll_addr = { .u8 = NETIF0_IPV6_LL };
+    static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_G };
+    static const ipv6_addr_t dst = { .u8 = GLOBAL_PFX18 };
+    uint32_t start, cached, uncached;
+
+    _set_up();
+    gnrc_netif2_ipv6_addr_add(netifs[0], &ll_addr, 64U,
+                              GNRC_NETIF2_IPV6_ADDRS_FLAGS_STATE_VALID);
+    gnrc_netif2_ipv6_addr_add(netifs[0], &addr, 64U,
+                              GNRC_NETIF2_IPV6_ADDRS_FLAGS_STATE_VALID);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < BEST_SRC_BENCH_NUMOF; i++) {
+#if GNRC_NETIF2_IPV6_SRC_CACHE_SIZE
+        memset(netifs[0]->ipv6.src_cache, 0, sizeof(netifs[0]->ipv6.src_cache));
+#endif
+        gnrc_netif2_ipv6_addr_best_src(netifs[0], &dst, false);
+    }
+    uncached = xtimer_now_usec() - start;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < BEST_SRC_BENCH_NUMOF; i++) {
+        gnrc_netif2_ipv6_addr_best_src(netifs[0], &dst, false);
+    }
+    cached = xtimer_now_usec() - start;
+    printf("best_src benchmark: %u lookups, uncached: %" PRIu32 " us, "
+           "cached: %" PRIu32 " us\n", BEST_SRC_BENCH_NUMOF, uncached, cached);
+}
+
 int main(void)
 {
     _tests_init();
@@ -1428,6 +1513,7 @@ int main(void)
     test_netapi_recv__raw_ethernet_payload();
     test_netapi_recv__raw_ieee802154_payload();
     test_netapi_recv__ipv6_ethernet_payload();
+    bench_ipv6_addr_best_src();
     return 0;
 }
 
@@ -147,6 +147,8 @@ def testfunc(child):
     child.expect("src_l2addr: 3e:e6:b5:22:fd:0b")
     child.expect("dst_l2addr: 3e:e6:b5:22:fd:0a")
     child.expect("~~ PKT    -  2 snips, total size:  61 byte")
+    # bench_ipv6_addr_best_src
+    child.expect(r"best_src benchmark: \d+ lookups, uncached: \d+ us, cached: \d+ us")
 
 if __name__ == "__main__":
     sys.exit(testrunner.run(testfunc, timeout=1, traceback=True))
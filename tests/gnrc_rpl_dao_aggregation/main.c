@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the aggregation of DAOs in storing mode
+ *
+ * DAOs of children are handed to gnrc_rpl_recv_DAO() of a router. The test
+ * checks which of them schedule a DAO of the router, when it is due, and
+ * the DAO statistics of the DODAG.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/fib.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/of_manager.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/icmpv6.h"
+
+#define TEST_INSTANCE_ID    (7U)
+/* routes are added to the FIB only, the interface does not need to exist */
+#define TEST_IFACE          (5)
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dao_t dao;
+    ipv6_addr_t dodag_id;
+    gnrc_rpl_opt_target_t target;
+    gnrc_rpl_opt_transit_t transit;
+} test_dao_t;
+
+static const ipv6_addr_t _dodag_id = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+/* link-local addresses of two children */
+static const ipv6_addr_t _child_a = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x0a
+    } };
+static const ipv6_addr_t _child_b = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x0b
+    } };
+/* targets announced by the children */
+static const ipv6_addr_t _target_1 = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01
+    } };
+static const ipv6_addr_t _target_2 = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02
+    } };
+
+static gnrc_rpl_instance_t *_inst;
+
+static void set_up(void)
+{
+    fib_flush(&gnrc_ipv6_fib_table, KERNEL_PID_UNDEF);
+    if (_inst != NULL) {
+        gnrc_rpl_instance_remove(_inst);
+    }
+    gnrc_rpl_instance_add(TEST_INSTANCE_ID, &_inst);
+    _inst->mop = GNRC_RPL_MOP_STORING_MODE_NO_MC;
+    _inst->of = gnrc_rpl_get_of_for_ocp(GNRC_RPL_DEFAULT_OCP);
+    gnrc_rpl_dodag_init(_inst, (ipv6_addr_t *)&_dodag_id, TEST_IFACE, NULL);
+    /* the regular DAO of the router is scheduled */
+    gnrc_rpl_long_delay_dao(&_inst->dodag);
+}
+
+static void _recv_dao(const ipv6_addr_t *child, const ipv6_addr_t *target,
+                      uint8_t path_lifetime)
+{
+    test_dao_t msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.icmpv6.type = ICMPV6_RPL_CTRL;
+    msg.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DAO;
+    msg.dao.instance_id = TEST_INSTANCE_ID;
+    msg.dao.k_d_flags = GNRC_RPL_DAO_D_BIT;
+    memcpy(&msg.dodag_id, &_dodag_id, sizeof(msg.dodag_id));
+    msg.target.type = GNRC_RPL_OPT_TARGET;
+    msg.target.length = GNRC_RPL_OPT_TARGET_LEN;
+    msg.target.prefix_length = IPV6_ADDR_BIT_LEN;
+    memcpy(&msg.target.target, target, sizeof(msg.target.target));
+    msg.transit.type = GNRC_RPL_OPT_TRANSIT;
+    msg.transit.length = GNRC_RPL_OPT_TRANSIT_INFO_LEN;
+    msg.transit.path_lifetime = path_lifetime;
+    gnrc_rpl_recv_DAO(&msg.dao, TEST_IFACE, (ipv6_addr_t *)child,
+                      (ipv6_addr_t *)&_dodag_id, sizeof(msg));
+}
+
+static void _simulate_dao_sent(void)
+{
+    /* what the RPL thread does when the DAO of the router is due */
+    _inst->dodag.dao_counter++;
+    _inst->dodag.dao_time = GNRC_RPL_DEFAULT_WAIT_FOR_DAO_ACK;
+}
+
+static void test_dao__new_target(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_inst->dodag;
+
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(1, dodag->stats.dao_received);
+    TEST_ASSERT_EQUAL_INT(0, dodag->stats.dao_suppressed);
+    TEST_ASSERT_EQUAL_INT(0, dodag->stats.dao_merged);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW, dodag->dao_time);
+    TEST_ASSERT_EQUAL_INT(0, dodag->dao_counter);
+}
+
+static void test_dao__refresh_suppressed(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_inst->dodag;
+
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    /* the DAO with the new route was sent and acknowledged */
+    gnrc_rpl_long_delay_dao(dodag);
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(2, dodag->stats.dao_received);
+    TEST_ASSERT_EQUAL_INT(1, dodag->stats.dao_suppressed);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_REGULAR_DAO_INTERVAL, dodag->dao_time);
+}
+
+static void test_dao__changes_merged(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_inst->dodag;
+
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW, dodag->dao_time);
+    /* another target */
+    _recv_dao(&_child_b, &_target_2, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(1, dodag->stats.dao_merged);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW, dodag->dao_time);
+    /* a known target over another next hop after some time passed: the
+     * scheduled DAO is not postponed */
+    dodag->dao_time = GNRC_RPL_DAO_AGGREGATION_WINDOW - 1;
+    _recv_dao(&_child_b, &_target_1, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(2, dodag->stats.dao_merged);
+    TEST_ASSERT_EQUAL_INT(0, dodag->stats.dao_suppressed);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW - 1, dodag->dao_time);
+}
+
+static void test_dao__no_path(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_inst->dodag;
+
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    gnrc_rpl_long_delay_dao(dodag);
+    /* a No-Path of a known route is a change */
+    _recv_dao(&_child_a, &_target_1, 0);
+    TEST_ASSERT_EQUAL_INT(0, dodag->stats.dao_suppressed);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW, dodag->dao_time);
+}
+
+static void test_dao__change_after_sent(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_inst->dodag;
+
+    _recv_dao(&_child_a, &_target_1, dodag->default_lifetime);
+    _simulate_dao_sent();
+    /* the DAO in flight does not carry the new target, so it is not merged */
+    _recv_dao(&_child_b, &_target_2, dodag->default_lifetime);
+    TEST_ASSERT_EQUAL_INT(0, dodag->stats.dao_merged);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DAO_AGGREGATION_WINDOW, dodag->dao_time);
+    TEST_ASSERT_EQUAL_INT(0, dodag->dao_counter);
+}
+
+static Test *tests_dao_aggregation(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dao__new_target),
+        new_TestFixture(test_dao__refresh_suppressed),
+        new_TestFixture(test_dao__changes_merged),
+        new_TestFixture(test_dao__no_path),
+        new_TestFixture(test_dao__change_after_sent),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    gnrc_rpl_of_manager_init();
+
+    TESTS_START();
+    TESTS_RUN(tests_dao_aggregation());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the control message counters of a DODAG and the
+ *              redundancy constant adapted to the number of neighbors
+ *
+ * DIOs and DISs are handed to gnrc_rpl_recv_DIO() and gnrc_rpl_recv_DIS()
+ * of two instances, a router and a leaf.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "sched.h"
+#include "trickle.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/of_manager.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/icmpv6.h"
+
+#define TEST_ROUTER_ID      (7U)
+#define TEST_LEAF_ID        (8U)
+/* messages are not sent, the interface does not need to exist */
+#define TEST_IFACE          (5)
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dio_t dio;
+} test_dio_t;
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dis_t dis;
+} test_dis_t;
+
+static const ipv6_addr_t _dodag_id = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+
+static gnrc_rpl_instance_t *_router, *_leaf;
+
+static gnrc_rpl_instance_t *_add(uint8_t id, gnrc_rpl_instance_t *old)
+{
+    gnrc_rpl_instance_t *inst;
+
+    if (old != NULL) {
+        gnrc_rpl_instance_remove(old);
+    }
+    gnrc_rpl_instance_add(id, &inst);
+    inst->mop = GNRC_RPL_MOP_STORING_MODE_NO_MC;
+    inst->of = gnrc_rpl_get_of_for_ocp(GNRC_RPL_DEFAULT_OCP);
+    gnrc_rpl_dodag_init(inst, (ipv6_addr_t *)&_dodag_id, TEST_IFACE, NULL);
+    /* the DIO timer is started on joining, its messages are not handled
+     * by this application */
+    trickle_start(sched_active_pid, &inst->dodag.trickle,
+                  GNRC_RPL_MSG_TYPE_TRICKLE_MSG, (1 << inst->dodag.dio_min),
+                  inst->dodag.dio_interval_doubl, inst->dodag.dio_redun);
+    return inst;
+}
+
+static void set_up(void)
+{
+    _router = _add(TEST_ROUTER_ID, _router);
+    _leaf = _add(TEST_LEAF_ID, _leaf);
+    _leaf->dodag.node_status = GNRC_RPL_LEAF_NODE;
+}
+
+/* link-local address of the n-th neighbor */
+static void _nb_addr(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    memset(&addr->u8[8], 0, 8);
+    addr->u8[11] = 0xff;
+    addr->u8[12] = 0xfe;
+    addr->u8[15] = (uint8_t)n;
+}
+
+static void _recv_dio(uint8_t instance_id, unsigned n)
+{
+    test_dio_t msg;
+    ipv6_addr_t src;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.icmpv6.type = ICMPV6_RPL_CTRL;
+    msg.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DIO;
+    msg.dio.instance_id = instance_id;
+    msg.dio.rank = byteorder_htons(GNRC_RPL_INFINITE_RANK);
+    /* the DIOs announce another mode of operation, so they are counted
+     * but not processed any further */
+    msg.dio.g_mop_prf = GNRC_RPL_MOP_NO_DOWNWARD_ROUTES << 3;
+    memcpy(&msg.dio.dodag_id, &_dodag_id, sizeof(msg.dio.dodag_id));
+    _nb_addr(&src, n);
+    gnrc_rpl_recv_DIO(&msg.dio, TEST_IFACE, &src,
+                      (ipv6_addr_t *)&ipv6_addr_all_rpl_nodes, sizeof(msg));
+}
+
+static void _recv_dis(void)
+{
+    test_dis_t msg;
+    ipv6_addr_t src;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.icmpv6.type = ICMPV6_RPL_CTRL;
+    msg.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DIS;
+    _nb_addr(&src, 1);
+    gnrc_rpl_recv_DIS(&msg.dis, TEST_IFACE, &src,
+                      (ipv6_addr_t *)&ipv6_addr_all_rpl_nodes, sizeof(msg));
+}
+
+static void test_density__dis_counted_once(void)
+{
+    _recv_dis();
+    _recv_dis();
+    /* a leaf does not respond to multicast DISs */
+    TEST_ASSERT_EQUAL_INT(2, _router->dodag.stats.dis_received);
+    TEST_ASSERT_EQUAL_INT(0, _leaf->dodag.stats.dis_received);
+}
+
+static void test_density__dio_neighbors(void)
+{
+    for (unsigned n = 1; n <= 6; n++) {
+        _recv_dio(TEST_ROUTER_ID, n);
+    }
+    /* a neighbor heard again is counted once */
+    _recv_dio(TEST_ROUTER_ID, 1);
+    TEST_ASSERT_EQUAL_INT(7, _router->dodag.stats.dio_received);
+    TEST_ASSERT_EQUAL_INT(6, gnrc_rpl_density_get(&_router->dodag));
+    TEST_ASSERT_EQUAL_INT(0, _leaf->dodag.stats.dio_received);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_density_get(&_leaf->dodag));
+}
+
+static void test_density__redun(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_router->dodag;
+
+    /* lower bound */
+    _recv_dio(TEST_ROUTER_ID, 1);
+    gnrc_rpl_density_update(dodag);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_DENSITY_REDUN_MIN, dodag->trickle.k);
+    /* about one DIO per GNRC_RPL_DENSITY_PER_REDUN neighbors */
+    for (unsigned n = 1; n <= 3 * GNRC_RPL_DENSITY_PER_REDUN; n++) {
+        _recv_dio(TEST_ROUTER_ID, n);
+    }
+    gnrc_rpl_density_update(dodag);
+    TEST_ASSERT_EQUAL_INT(3, dodag->trickle.k);
+    /* upper bound is the configured redundancy constant */
+    dodag->dio_redun = 2;
+    gnrc_rpl_density_update(dodag);
+    TEST_ASSERT_EQUAL_INT(2, dodag->trickle.k);
+    /* a redundancy constant of infinity is not changed */
+    dodag->dio_redun = 0;
+    dodag->trickle.k = 0;
+    gnrc_rpl_density_update(dodag);
+    TEST_ASSERT_EQUAL_INT(0, dodag->trickle.k);
+}
+
+static void test_density__window(void)
+{
+    gnrc_rpl_dodag_t *dodag = &_router->dodag;
+
+    for (unsigned n = 1; n <= 3; n++) {
+        _recv_dio(TEST_ROUTER_ID, n);
+    }
+    for (unsigned i = 0; i < GNRC_RPL_DENSITY_WINDOW; i++) {
+        gnrc_rpl_density_update(dodag);
+    }
+    TEST_ASSERT_EQUAL_INT(3, gnrc_rpl_density_get(dodag));
+    /* heard again just in time */
+    _recv_dio(TEST_ROUTER_ID, 1);
+    gnrc_rpl_density_update(dodag);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_density_get(dodag));
+}
+
+static Test *tests_density(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_density__dis_counted_once),
+        new_TestFixture(test_density__dio_neighbors),
+        new_TestFixture(test_density__redun),
+        new_TestFixture(test_density__window),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    gnrc_rpl_of_manager_init();
+
+    TESTS_START();
+    TESTS_RUN(tests_density());
+    TESTS_END();
+
+    return 0;
+}
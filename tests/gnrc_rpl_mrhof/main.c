@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the DODAGs OF0 and MRHOF build over lossy links
+ *
+ * The application simulates a network of TEST_NODES nodes with lossy links.
+ * Every node but the root runs an RPL instance. After every round of traffic
+ * each node is handed a DIO of every candidate neighbor, which goes through
+ * the parent selection of RPL (gnrc_rpl_parent_add_by_addr() and
+ * gnrc_rpl_parent_update()) with the objective function of the instance.
+ * Packets are forwarded to the root over the preferred parents. The link layer of the nodes
+ * retransmits unacknowledged frames and reports the outcome of every frame to
+ * netstats_neighbor, which provides the ETX to MRHOF.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched.h"
+#include "trickle.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/of_manager.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats/neighbor.h"
+
+#define TEST_NODES          (6U)
+#define TEST_CANDIDATES     (3U)
+#define TEST_PROBES         (16U)   /* frames to every candidate before */
+#define TEST_ROUNDS         (20U)
+#define TEST_PACKETS        (10U)   /* per node and round */
+#define TEST_MAX_TX         (4U)    /* transmissions of a frame by the MAC */
+#define TEST_SEED           (0x6719U)
+#define TEST_INSTANCE_ID    (0U)
+#define OCP_OF0             (0x0)
+#define OCP_MRHOF           (0x1)
+
+typedef struct {
+    uint8_t node;           /**< candidate parent */
+    uint8_t pdr;            /**< chance of a transmission to succeed in % */
+} test_link_t;
+
+/* node 0 is the root, candidates always have a lower node number */
+static const test_link_t _links[TEST_NODES][TEST_CANDIDATES] = {
+    { { 0, 0 } },
+    { { 0, 90 } },
+    { { 0, 50 }, { 1, 90 } },
+    { { 0, 30 }, { 1, 80 }, { 2, 90 } },
+    { { 1, 40 }, { 2, 90 }, { 3, 95 } },
+    { { 1, 30 }, { 3, 90 }, { 4, 95 } },
+};
+
+static const ipv6_addr_t _dodag_id = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+
+/* every node but the root runs its own RPL instance */
+static gnrc_rpl_instance_t *_insts[TEST_NODES];
+static uint32_t _prng;
+static uint32_t _tx, _sent, _delivered;
+
+static inline kernel_pid_t _iface(unsigned node)
+{
+    /* every node gets its own interface in netstats_neighbor and the FIB */
+    return (kernel_pid_t)(node + 1);
+}
+
+static void _l2addr(uint8_t *l2addr, unsigned node)
+{
+    static const uint8_t base[] = { 0x02, 0x00, 0x00, 0xff,
+                                    0xfe, 0x00, 0x00, 0x00 };
+
+    memcpy(l2addr, base, sizeof(base));
+    l2addr[7] = node + 1;
+}
+
+static inline unsigned _node(const gnrc_rpl_parent_t *parent)
+{
+    return parent->addr.u8[15] - 1;
+}
+
+static uint16_t _rank(unsigned node)
+{
+    return (node == 0) ? GNRC_RPL_ROOT_RANK : _insts[node]->dodag.my_rank;
+}
+
+static const test_link_t *_link(unsigned node, unsigned parent)
+{
+    for (unsigned j = 0; j < TEST_CANDIDATES; j++) {
+        if ((_links[node][j].pdr != 0) && (_links[node][j].node == parent)) {
+            return &_links[node][j];
+        }
+    }
+    return NULL;
+}
+
+/* losses come from their own generator, so that they are independent of the
+ * random numbers trickle draws */
+static unsigned _percent(void)
+{
+    /* xorshift32 */
+    _prng ^= _prng << 13;
+    _prng ^= _prng >> 17;
+    _prng ^= _prng << 5;
+    return _prng % 100;
+}
+
+/* sends a frame over a link like a MAC layer with retransmissions would */
+static bool _link_send(unsigned node, const test_link_t *link)
+{
+    uint8_t l2addr[8];
+    unsigned tx = 0;
+    bool acked = false;
+
+    _l2addr(l2addr, link->node);
+    netstats_nb_record(_iface(node), l2addr, sizeof(l2addr));
+    while (!acked && (tx < TEST_MAX_TX)) {
+        tx++;
+        acked = (_percent() < link->pdr);
+    }
+    _tx += tx;
+    netstats_nb_update_tx(_iface(node),
+                          acked ? NETSTATS_NB_SUCCESS : NETSTATS_NB_NOACK, tx);
+    return acked;
+}
+
+static void _init(uint16_t ocp)
+{
+    _prng = TEST_SEED;
+    netstats_nb_init();
+    for (unsigned i = 1; i < TEST_NODES; i++) {
+        gnrc_rpl_instance_t *inst;
+        gnrc_rpl_dodag_t *dodag;
+
+        if (_insts[i] != NULL) {
+            gnrc_rpl_instance_remove(_insts[i]);
+        }
+        if (!gnrc_rpl_instance_add(TEST_INSTANCE_ID + i, &inst)) {
+            puts("error: no space for another instance");
+            return;
+        }
+        inst->mop = GNRC_RPL_MOP_NO_DOWNWARD_ROUTES;
+        inst->of = gnrc_rpl_get_of_for_ocp(ocp);
+        gnrc_rpl_dodag_init(inst, (ipv6_addr_t *)&_dodag_id, _iface(i), NULL);
+        dodag = &inst->dodag;
+        /* the DIO timer is started on joining, its messages are not handled
+         * by this application */
+        trickle_start(sched_active_pid, &dodag->trickle,
+                      GNRC_RPL_MSG_TYPE_TRICKLE_MSG, (1 << dodag->dio_min),
+                      dodag->dio_interval_doubl, dodag->dio_redun);
+        _insts[i] = inst;
+    }
+}
+
+/* every node receives a DIO of every candidate, processed as
+ * gnrc_rpl_recv_DIO() does it */
+static void _send_dios(void)
+{
+    for (unsigned i = 1; i < TEST_NODES; i++) {
+        gnrc_rpl_dodag_t *dodag = &_insts[i]->dodag;
+
+        for (unsigned j = 0; (j < TEST_CANDIDATES) && _links[i][j].pdr; j++) {
+            gnrc_rpl_parent_t *parent = NULL;
+            ipv6_addr_t src;
+            uint8_t l2addr[8];
+
+            _l2addr(l2addr, _links[i][j].node);
+            ipv6_addr_set_link_local_prefix(&src);
+            ipv6_addr_set_aiid(&src, l2addr);
+            src.u8[8] ^= 0x02;
+            if (!gnrc_rpl_parent_add_by_addr(dodag, &src, &parent) &&
+                (parent == NULL)) {
+                puts("error: no space for another parent");
+                continue;
+            }
+            parent->rank = _rank(_links[i][j].node);
+            gnrc_rpl_parent_update(dodag, parent);
+        }
+    }
+}
+
+static void _forward(unsigned node)
+{
+    _sent++;
+    while (node != 0) {
+        gnrc_rpl_parent_t *parent = _insts[node]->dodag.parents;
+        const test_link_t *link;
+
+        if ((parent == NULL) || ((link = _link(node, _node(parent))) == NULL) ||
+            !_link_send(node, link)) {
+            return;
+        }
+        node = link->node;
+    }
+    _delivered++;
+}
+
+static void _run(const char *name, uint16_t ocp)
+{
+    uint32_t switches = 0;
+
+    _init(ocp);
+    /* every candidate is used for some traffic (DAOs, DIS, data) before */
+    for (unsigned i = 1; i < TEST_NODES; i++) {
+        for (unsigned j = 0; (j < TEST_CANDIDATES) && _links[i][j].pdr; j++) {
+            for (unsigned k = 0; k < TEST_PROBES; k++) {
+                _link_send(i, &_links[i][j]);
+            }
+        }
+    }
+    _send_dios();
+    _tx = _sent = _delivered = 0;
+    for (unsigned i = 1; i < TEST_NODES; i++) {
+        switches -= _insts[i]->dodag.stats.parent_switches;
+    }
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 1; i < TEST_NODES; i++) {
+            for (unsigned k = 0; k < TEST_PACKETS; k++) {
+                _forward(i);
+            }
+        }
+        _send_dios();
+    }
+    for (unsigned i = 1; i < TEST_NODES; i++) {
+        gnrc_rpl_dodag_t *dodag = &_insts[i]->dodag;
+
+        switches += dodag->stats.parent_switches;
+        if (dodag->parents == NULL) {
+            printf("%s: node %u has no parent\n", name, i);
+            continue;
+        }
+        printf("%s: node %u -> node %u (rank %u)\n", name, i,
+               _node(dodag->parents), dodag->my_rank);
+    }
+    printf("%s: %lu/%lu packets delivered, %lu transmissions, "
+           "%lu parent changes, ", name, (unsigned long)_delivered,
+           (unsigned long)_sent, (unsigned long)_tx, (unsigned long)switches);
+    if (_delivered > 0) {
+        unsigned long ratio = (_tx * 100UL) / _delivered;
+
+        printf("%lu.%02lu transmissions per delivered packet\n", ratio / 100,
+               ratio % 100);
+    }
+    else {
+        puts("no packet delivered");
+    }
+}
+
+int main(void)
+{
+    gnrc_rpl_of_manager_init();
+    _run("OF0", OCP_OF0);
+    _run("MRHOF", OCP_MRHOF);
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect(r"OF0: (\d+)/(\d+) packets delivered, (\d+) transmissions, "
+                 r"(\d+) parent changes, "
+                 r"(\d+)\.(\d+) transmissions per delivered packet")
+    of0 = int(child.match.group(5)) * 100 + int(child.match.group(6))
+    child.expect(r"MRHOF: (\d+)/(\d+) packets delivered, (\d+) transmissions, "
+                 r"(\d+) parent changes, "
+                 r"(\d+)\.(\d+) transmissions per delivered packet")
+    mrhof = int(child.match.group(5)) * 100 + int(child.match.group(6))
+    assert mrhof < of0
+    child.expect("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the pacing of 6LoWPAN fragments, the queue of datagrams
+ *              waiting for fragmentation and the retries of fragments
+ *
+ * A simulated interface records the time and the datagram tag of every
+ * fragment. It can be held busy, so its message queue fills up and the
+ * fragmentation has to retry.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/netif.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+
+#define TEST_PAYLOAD_SIZE   (300U)
+#define TEST_FRAME_SIZE     (64U)
+#define TEST_FRAMES_MAX     (64U)
+#define TEST_GAP            (GNRC_SIXLOWPAN_FRAG_GAP)
+/* longer than any pause between two fragments in these tests */
+#define TEST_IDLE           (6U * TEST_GAP)
+/* the interface handles a fragment and one more waits in its queue */
+#define LINK_QUEUE_SIZE     (1U)
+
+typedef struct {
+    uint32_t time;
+    uint16_t tag;
+} frame_t;
+
+static const uint8_t _own_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _peer_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+
+static msg_t _link_msg_queue[LINK_QUEUE_SIZE];
+static char _link_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _link_pid;
+static frame_t _frames[TEST_FRAMES_MAX];
+static volatile unsigned _frames_num;
+static volatile uint32_t _hold;
+static unsigned _frames_per_datagram;
+
+static void _record(gnrc_pktsnip_t *pkt)
+{
+    sixlowpan_frag_t *hdr = pkt->next->data;
+
+    if (_frames_num < TEST_FRAMES_MAX) {
+        _frames[_frames_num].time = xtimer_now_usec();
+        _frames[_frames_num].tag = byteorder_ntohs(hdr->tag);
+    }
+    _frames_num++;
+}
+
+static void *_link_thread(void *args)
+{
+    msg_t msg, reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    (void)args;
+    msg_init_queue(_link_msg_queue, LINK_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                _record(msg.content.ptr);
+                gnrc_pktbuf_release(msg.content.ptr);
+                /* busy sending, e.g. with link-layer retransmissions */
+                if (_hold > 0) {
+                    xtimer_usleep(_hold);
+                    _hold = 0;
+                }
+                break;
+            case GNRC_NETAPI_MSG_TYPE_GET:
+            case GNRC_NETAPI_MSG_TYPE_SET:
+                reply.content.value = (uint32_t)(-ENOTSUP);
+                msg_reply(&msg, &reply);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+static int _send(void)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *payload;
+    ipv6_hdr_t *hdr;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, TEST_PAYLOAD_SIZE, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOBUFS;
+    }
+    memset(payload->data, 0xa5, payload->size);
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOBUFS;
+    }
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(TEST_PAYLOAD_SIZE);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    netif = gnrc_netif_hdr_build((uint8_t *)_own_l2addr, sizeof(_own_l2addr),
+                                 (uint8_t *)_peer_l2addr, sizeof(_peer_l2addr));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return -ENOBUFS;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _link_pid;
+    netif->next = ipv6;
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, netif)) {
+        gnrc_pktbuf_release(netif);
+        return -ENOTSUP;
+    }
+    return 0;
+}
+
+/* waits until the interface did not get a fragment for TEST_IDLE */
+static void _wait_idle(void)
+{
+    unsigned num;
+
+    do {
+        num = _frames_num;
+        xtimer_usleep(TEST_IDLE);
+    } while (num != _frames_num);
+}
+
+static void set_up(void)
+{
+    memset(gnrc_sixlowpan_frag_stats_get(), 0, sizeof(gnrc_sixlowpan_frag_stats_t));
+    memset(_frames, 0, sizeof(_frames));
+    _frames_num = 0;
+    _hold = 0;
+}
+
+static void tear_down(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pacing__gap(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _send());
+    _wait_idle();
+    TEST_ASSERT(_frames_num > 2);
+    TEST_ASSERT(_frames_num <= TEST_FRAMES_MAX);
+    for (unsigned i = 1; i < _frames_num; i++) {
+        TEST_ASSERT_EQUAL_INT(_frames[0].tag, _frames[i].tag);
+        TEST_ASSERT((_frames[i].time - _frames[i - 1].time) >= TEST_GAP);
+    }
+    TEST_ASSERT_EQUAL_INT(_frames_num, gnrc_sixlowpan_frag_stats_get()->frags_sent);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_stats_get()->frag_retries);
+    _frames_per_datagram = _frames_num;
+}
+
+static void test_pacing__queue(void)
+{
+    /* the last datagram does not fit into the queue anymore */
+    for (unsigned i = 0; i <= GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _send());
+    }
+    _wait_idle();
+    TEST_ASSERT(_frames_per_datagram > 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_FRAG_QUEUE_SIZE * _frames_per_datagram,
+                          _frames_num);
+    /* the datagrams are fragmented one after another, and the next one waits
+     * for the gap after the last fragment of the previous one, too */
+    for (unsigned i = 1; i < _frames_num; i++) {
+        if ((i % _frames_per_datagram) == 0) {
+            TEST_ASSERT(_frames[i].tag != _frames[i - 1].tag);
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(_frames[i - 1].tag, _frames[i].tag);
+        }
+        TEST_ASSERT((_frames[i].time - _frames[i - 1].time) >= TEST_GAP);
+    }
+}
+
+static void test_pacing__retry(void)
+{
+    /* The interface is busy with the first fragment until 3.5 gaps later.
+     * The second fragment waits in its queue, so the third one is not
+     * accepted 2 gaps after the first one. It is retried 1 gap later, still
+     * too early, and then 2 more gaps later. */
+    _hold = (7U * TEST_GAP) / 2;
+    TEST_ASSERT_EQUAL_INT(0, _send());
+    _wait_idle();
+    TEST_ASSERT(_frames_per_datagram > 2);
+    TEST_ASSERT_EQUAL_INT(_frames_per_datagram, _frames_num);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_sixlowpan_frag_stats_get()->frag_retries);
+    TEST_ASSERT((_frames[2].time - _frames[0].time) >=
+                ((5U * TEST_GAP) - (TEST_GAP / 4)));
+}
+
+static Test *tests_pacing(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pacing__gap),
+        new_TestFixture(test_pacing__queue),
+        new_TestFixture(test_pacing__retry),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    _link_pid = thread_create(_link_stack, sizeof(_link_stack),
+                              THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                              _link_thread, NULL, "link");
+    gnrc_sixlowpan_netif_add(_link_pid, TEST_FRAME_SIZE);
+
+    TESTS_START();
+    TESTS_RUN(tests_pacing());
+    TESTS_END();
+
+    return 0;
+}
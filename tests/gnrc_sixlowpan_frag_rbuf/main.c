@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the 6LoWPAN reassembly buffer
+ *
+ * Fragments are handed to gnrc_sixlowpan_frag_handle_pkt(), reassembled
+ * datagrams are received by this thread.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "sched.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/sixlowpan.h"
+#include "rbuf.h"
+
+#define TEST_TAG            (0x1234U)
+/* an IPv6 header and 22 bytes of payload: two full fragments of 40 and 16
+ * bytes and a last one of 6 bytes */
+#define TEST_DGRAM_SIZE     (62U)
+#define TEST_FRAG1_LEN      (40U)
+#define TEST_MSG_QUEUE_SIZE (4U)
+
+static msg_t _msg_queue[TEST_MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _ipv6_handler;
+
+static void set_up(void)
+{
+    rbuf_reset();
+}
+
+static void tear_down(void)
+{
+    msg_t msg;
+
+    rbuf_reset();
+    /* release datagrams not received by the test */
+    while (msg_try_receive(&msg) > 0) {
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/* the n-th byte of the datagram sent by src */
+static inline uint8_t _dgram_byte(uint8_t src, unsigned n)
+{
+    return (uint8_t)((src * 37U) + n);
+}
+
+static gnrc_pktsnip_t *_frag_pkt(uint8_t src, uint16_t size, uint16_t offset,
+                                 size_t pkt_len)
+{
+    static const uint8_t dst[] = { 0x00, 0xff };
+    const uint8_t addr[] = { 0x00, src };
+    gnrc_pktsnip_t *netif, *pkt;
+    sixlowpan_frag_n_t *hdr;
+
+    netif = gnrc_netif_hdr_build((uint8_t *)addr, sizeof(addr),
+                                 (uint8_t *)dst, sizeof(dst));
+    if (netif == NULL) {
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(netif, NULL, pkt_len, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(size);
+    hdr->tag = byteorder_htons(TEST_TAG);
+    if (offset == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+    }
+    return pkt;
+}
+
+/* hands len bytes of the datagram of src at offset to the reassembly buffer */
+static void _recv_frag(uint8_t src, uint16_t offset, size_t len)
+{
+    gnrc_pktsnip_t *pkt;
+    uint8_t *data;
+
+    if (offset == 0) {
+        /* uncompressed IPv6 header */
+        pkt = _frag_pkt(src, TEST_DGRAM_SIZE, offset,
+                        sizeof(sixlowpan_frag_t) + 1 + len);
+        TEST_ASSERT_NOT_NULL(pkt);
+        data = (uint8_t *)pkt->data + sizeof(sixlowpan_frag_t);
+        *(data++) = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        pkt = _frag_pkt(src, TEST_DGRAM_SIZE, offset,
+                        sizeof(sixlowpan_frag_n_t) + len);
+        TEST_ASSERT_NOT_NULL(pkt);
+        data = (uint8_t *)pkt->data + sizeof(sixlowpan_frag_n_t);
+    }
+    for (unsigned i = 0; i < len; i++) {
+        data[i] = _dgram_byte(src, offset + i);
+    }
+    gnrc_sixlowpan_frag_handle_pkt(pkt);
+}
+
+static void _recv_rest(uint8_t src)
+{
+    _recv_frag(src, TEST_FRAG1_LEN, 16);
+    _recv_frag(src, TEST_FRAG1_LEN + 16, TEST_DGRAM_SIZE - TEST_FRAG1_LEN - 16);
+}
+
+static const rbuf_t *_entry(uint8_t src)
+{
+    const rbuf_t *entries = rbuf_array();
+
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        if ((entries[i].pkt != NULL) && (entries[i].src_len == 2) &&
+            (entries[i].src[1] == src)) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static inline bool _unit(const rbuf_t *entry, unsigned unit)
+{
+    return bf_isset((uint8_t *)entry->received, unit);
+}
+
+/* returns the source of the next reassembled datagram or 0 if there is
+ * none or its content is wrong */
+static uint8_t _reassembled(void)
+{
+    msg_t msg;
+    gnrc_pktsnip_t *pkt;
+    gnrc_netif_hdr_t *netif_hdr;
+    uint8_t src;
+
+    if ((msg_try_receive(&msg) <= 0) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_RCV)) {
+        return 0;
+    }
+    pkt = msg.content.ptr;
+    if ((pkt->size != TEST_DGRAM_SIZE) || (pkt->next == NULL) ||
+        (pkt->next->type != GNRC_NETTYPE_NETIF)) {
+        gnrc_pktbuf_release(pkt);
+        return 0;
+    }
+    netif_hdr = pkt->next->data;
+    src = gnrc_netif_hdr_get_src_addr(netif_hdr)[1];
+    for (unsigned i = 0; i < pkt->size; i++) {
+        if (((uint8_t *)pkt->data)[i] != _dgram_byte(src, i)) {
+            src = 0;
+            break;
+        }
+    }
+    gnrc_pktbuf_release(pkt);
+    return src;
+}
+
+static void test_rbuf__empty_fragments(void)
+{
+    gnrc_pktsnip_t *pkt;
+    const rbuf_t *entry;
+
+    /* a FRAGN without payload */
+    pkt = _frag_pkt(1, TEST_DGRAM_SIZE, TEST_DGRAM_SIZE - 8,
+                    sizeof(sixlowpan_frag_n_t));
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_sixlowpan_frag_handle_pkt(pkt);
+    TEST_ASSERT_NULL(_entry(1));
+    /* a FRAGN shorter than its header */
+    pkt = _frag_pkt(1, TEST_DGRAM_SIZE, TEST_DGRAM_SIZE - 8,
+                    sizeof(sixlowpan_frag_t));
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_sixlowpan_frag_handle_pkt(pkt);
+    TEST_ASSERT_NULL(_entry(1));
+    /* a FRAG1 without payload */
+    pkt = _frag_pkt(1, TEST_DGRAM_SIZE, 0, sizeof(sixlowpan_frag_t));
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_sixlowpan_frag_handle_pkt(pkt);
+    TEST_ASSERT_NULL(_entry(1));
+    /* a FRAG1 with nothing but the dispatch */
+    _recv_frag(1, 0, 0);
+    entry = _entry(1);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(0, entry->cur_size);
+    for (unsigned i = 0; i < RBUF_UNITS; i++) {
+        TEST_ASSERT(!_unit(entry, i));
+    }
+    /* the datagram can still be reassembled */
+    _recv_frag(1, 0, TEST_FRAG1_LEN);
+    _recv_rest(1);
+    TEST_ASSERT_EQUAL_INT(1, _reassembled());
+}
+
+static void test_rbuf__units(void)
+{
+    const rbuf_t *entry;
+
+    _recv_frag(1, TEST_FRAG1_LEN, 16);
+    entry = _entry(1);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(16, entry->cur_size);
+    for (unsigned i = 0; i < RBUF_UNITS; i++) {
+        TEST_ASSERT_EQUAL_INT((i == 5) || (i == 6),
+                              _unit(entry, i));
+    }
+    /* the last fragment does not fill its unit */
+    _recv_frag(1, TEST_FRAG1_LEN + 16, TEST_DGRAM_SIZE - TEST_FRAG1_LEN - 16);
+    TEST_ASSERT_EQUAL_INT(TEST_DGRAM_SIZE - TEST_FRAG1_LEN, entry->cur_size);
+    TEST_ASSERT(_unit(entry, 7));
+    TEST_ASSERT(!_unit(entry, 8));
+    TEST_ASSERT_EQUAL_INT(0, _reassembled());
+    _recv_frag(1, 0, TEST_FRAG1_LEN);
+    TEST_ASSERT_EQUAL_INT(1, _reassembled());
+    TEST_ASSERT_NULL(_entry(1));
+}
+
+static void test_rbuf__duplicates(void)
+{
+    const rbuf_t *entry;
+
+    _recv_frag(1, 0, TEST_FRAG1_LEN);
+    _recv_frag(1, 0, TEST_FRAG1_LEN);
+    _recv_frag(1, TEST_FRAG1_LEN, 16);
+    _recv_frag(1, TEST_FRAG1_LEN, 16);
+    entry = _entry(1);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG1_LEN + 16, entry->cur_size);
+    _recv_frag(1, TEST_FRAG1_LEN + 16, TEST_DGRAM_SIZE - TEST_FRAG1_LEN - 16);
+    TEST_ASSERT_EQUAL_INT(1, _reassembled());
+    TEST_ASSERT_EQUAL_INT(0, _reassembled());
+}
+
+static void test_rbuf__overlap(void)
+{
+    const rbuf_t *entry;
+
+    _recv_frag(1, 0, TEST_FRAG1_LEN);
+    /* overlaps the last unit of the first fragment */
+    _recv_frag(1, TEST_FRAG1_LEN - 8, 16);
+    /* the datagram was discarded and reassembly starts again with the
+     * latest fragment */
+    entry = _entry(1);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT(16, entry->cur_size);
+    for (unsigned i = 0; i < RBUF_UNITS; i++) {
+        TEST_ASSERT_EQUAL_INT((i == 4) || (i == 5),
+                              _unit(entry, i));
+    }
+    /* a fragment too big for the datagram discards it */
+    _recv_frag(1, TEST_DGRAM_SIZE - 8, 16);
+    TEST_ASSERT_NULL(_entry(1));
+    TEST_ASSERT_EQUAL_INT(0, _reassembled());
+}
+
+static void test_rbuf__interleaved(void)
+{
+    /* datagrams with the same tag and size, told apart by their source */
+    for (uint8_t src = 1; src <= RBUF_SIZE; src++) {
+        _recv_frag(src, 0, TEST_FRAG1_LEN);
+    }
+    for (uint8_t src = RBUF_SIZE; src > 0; src--) {
+        TEST_ASSERT_NOT_NULL(_entry(src));
+        _recv_rest(src);
+        TEST_ASSERT_EQUAL_INT(src, _reassembled());
+        TEST_ASSERT_NULL(_entry(src));
+    }
+}
+
+static void test_rbuf__eviction(void)
+{
+    for (uint8_t src = 1; src <= RBUF_SIZE; src++) {
+        _recv_frag(src, 0, TEST_FRAG1_LEN);
+    }
+    /* the oldest datagram makes room for a new one */
+    _recv_frag(RBUF_SIZE + 1, 0, TEST_FRAG1_LEN);
+    TEST_ASSERT_NULL(_entry(1));
+    TEST_ASSERT_NOT_NULL(_entry(RBUF_SIZE + 1));
+    /* a fragment moves its datagram to the end of the expiry queue */
+    _recv_frag(2, TEST_FRAG1_LEN, 16);
+    _recv_frag(RBUF_SIZE + 2, 0, TEST_FRAG1_LEN);
+    TEST_ASSERT_NOT_NULL(_entry(2));
+    TEST_ASSERT_NULL(_entry(3));
+    _recv_frag(2, TEST_FRAG1_LEN + 16, TEST_DGRAM_SIZE - TEST_FRAG1_LEN - 16);
+    TEST_ASSERT_EQUAL_INT(2, _reassembled());
+}
+
+static Test *tests_rbuf(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rbuf__empty_fragments),
+        new_TestFixture(test_rbuf__units),
+        new_TestFixture(test_rbuf__duplicates),
+        new_TestFixture(test_rbuf__overlap),
+        new_TestFixture(test_rbuf__interleaved),
+        new_TestFixture(test_rbuf__eviction),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, TEST_MSG_QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&_ipv6_handler, GNRC_NETREG_DEMUX_CTX_ALL,
+                               sched_active_pid);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6_handler);
+
+    TESTS_START();
+    TESTS_RUN(tests_rbuf());
+    TESTS_END();
+
+    return 0;
+}
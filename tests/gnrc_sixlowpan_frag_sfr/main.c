@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares RFC 4944 fragmentation with selective fragment
+ *              recovery on a lossy link
+ *
+ * A simulated interface drops TEST_LOSS percent of all frames and loops the
+ * others back as frames from a peer. The frames to drop are chosen
+ * deterministically, so both modes see the same loss pattern and every run
+ * yields the same counts. Every datagram is sent again by the
+ * application until it is delivered, as an upper layer would do.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/netif.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+
+#ifndef TEST_LOSS
+#define TEST_LOSS           (10U)   /* percent */
+#endif
+#define TEST_DATAGRAMS      (20U)
+#define TEST_PAYLOAD_SIZE   (300U)
+#define TEST_FRAME_SIZE     (64U)
+#define TEST_ATTEMPTS       (10U)
+#define TEST_TIMEOUT        (1500U * US_PER_MS)
+/* gives the RFC 8931 sender time to recover a lost final acknowledgment */
+#define TEST_GAP            (GNRC_SIXLOWPAN_SFR_ACK_TIMEOUT + (50U * US_PER_MS))
+#define MAIN_QUEUE_SIZE     (8U)
+#define LINK_QUEUE_SIZE     (16U)
+
+static const uint8_t _own_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _peer_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static msg_t _link_msg_queue[LINK_QUEUE_SIZE];
+static char _link_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _link_pid;
+static uint32_t _frames;
+
+static void _loopback(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *frame, *netif;
+    uint8_t *data;
+
+    frame = gnrc_pktbuf_add(NULL, NULL, gnrc_pkt_len(pkt->next),
+                            GNRC_NETTYPE_SIXLOWPAN);
+    if (frame == NULL) {
+        return;
+    }
+    data = frame->data;
+    for (gnrc_pktsnip_t *snip = pkt->next; snip != NULL; snip = snip->next) {
+        memcpy(data, snip->data, snip->size);
+        data += snip->size;
+    }
+    netif = gnrc_netif_hdr_build((uint8_t *)_peer_l2addr, sizeof(_peer_l2addr),
+                                 (uint8_t *)_own_l2addr, sizeof(_own_l2addr));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(frame);
+        return;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _link_pid;
+    frame->next = netif;
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, frame)) {
+        gnrc_pktbuf_release(frame);
+    }
+}
+
+static void *_link_thread(void *args)
+{
+    msg_t msg, reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    (void)args;
+    msg_init_queue(_link_msg_queue, LINK_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                _frames++;
+                /* drop a frame whenever the accumulated loss reaches another
+                 * full frame, i.e. exactly TEST_LOSS percent of all frames */
+                if (((_frames * TEST_LOSS) / 100) ==
+                    (((_frames - 1) * TEST_LOSS) / 100)) {
+                    _loopback(msg.content.ptr);
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_GET:
+            case GNRC_NETAPI_MSG_TYPE_SET:
+                reply.content.value = (uint32_t)(-ENOTSUP);
+                msg_reply(&msg, &reply);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+static void _send(uint32_t id)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *payload;
+    ipv6_hdr_t *hdr;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, TEST_PAYLOAD_SIZE, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        puts("error: packet buffer full");
+        return;
+    }
+    memset(payload->data, 0xa5, payload->size);
+    *((network_uint32_t *)payload->data) = byteorder_htonl(id);
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        puts("error: packet buffer full");
+        gnrc_pktbuf_release(payload);
+        return;
+    }
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(TEST_PAYLOAD_SIZE);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    ipv6_addr_set_link_local_prefix(&hdr->src);
+    ipv6_addr_set_link_local_prefix(&hdr->dst);
+    ipv6_addr_set_aiid(&hdr->src, (uint8_t *)_own_l2addr);
+    ipv6_addr_set_aiid(&hdr->dst, (uint8_t *)_peer_l2addr);
+    hdr->src.u8[8] ^= 0x02;
+    hdr->dst.u8[8] ^= 0x02;
+    netif = gnrc_netif_hdr_build((uint8_t *)_own_l2addr, sizeof(_own_l2addr),
+                                 (uint8_t *)_peer_l2addr, sizeof(_peer_l2addr));
+    if (netif == NULL) {
+        puts("error: packet buffer full");
+        gnrc_pktbuf_release(ipv6);
+        return;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _link_pid;
+    netif->next = ipv6;
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, netif)) {
+        puts("error: 6LoWPAN not available");
+        gnrc_pktbuf_release(netif);
+    }
+}
+
+/* the payload starts with the ID of the datagram */
+static bool _has_id(gnrc_pktsnip_t *pkt, uint32_t id)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    uint8_t *data;
+
+    if (ipv6 == NULL) {
+        return false;
+    }
+    /* reassembled RFC 4944 fragments keep the payload behind the IPv6
+     * header, while IPHC decoding of a reassembled RFC 8931 datagram puts it
+     * into a snip of its own */
+    if (ipv6->size >= (sizeof(ipv6_hdr_t) + sizeof(uint32_t))) {
+        data = ((uint8_t *)ipv6->data) + sizeof(ipv6_hdr_t);
+    }
+    else if ((pkt != ipv6) && (pkt->size >= sizeof(uint32_t))) {
+        data = pkt->data;
+    }
+    else {
+        return false;
+    }
+    return (byteorder_ntohl(*((network_uint32_t *)data)) == id);
+}
+
+static bool _delivered(uint32_t id)
+{
+    msg_t msg;
+    uint32_t start = xtimer_now_usec();
+    bool res = false;
+
+    while ((xtimer_now_usec() - start) < TEST_TIMEOUT) {
+        if (xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT -
+                                       (xtimer_now_usec() - start)) < 0) {
+            break;
+        }
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+            res = _has_id(pkt, id);
+            gnrc_pktbuf_release(pkt);
+            if (res) {
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+static void _run(const char *name)
+{
+    static uint32_t id = 0;
+    unsigned delivered = 0;
+
+    _frames = 0;
+    for (unsigned i = 0; i < TEST_DATAGRAMS; i++) {
+        id++;
+        for (unsigned attempt = 0; attempt < TEST_ATTEMPTS; attempt++) {
+            _send(id);
+            if (_delivered(id)) {
+                delivered++;
+                break;
+            }
+        }
+        xtimer_usleep(TEST_GAP);
+    }
+    printf("%s: %u/%u datagrams delivered, %lu frames, ", name, delivered,
+           TEST_DATAGRAMS, (unsigned long)_frames);
+    if (delivered > 0) {
+        unsigned long ratio = (_frames * 100UL) / delivered;
+
+        printf("%lu.%02lu frames per datagram\n", ratio / 100, ratio % 100);
+    }
+    else {
+        puts("no datagram delivered");
+    }
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t ipv6_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              sched_active_pid);
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    printf("Lossy link test with %u%% frame loss\n", TEST_LOSS);
+    _link_pid = thread_create(_link_stack, sizeof(_link_stack),
+                              THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                              _link_thread, NULL, "lossy_link");
+    gnrc_sixlowpan_netif_add(_link_pid, TEST_FRAME_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &ipv6_reg);
+
+    /* the peer is not known to support RFC 8931 yet */
+    _run("RFC 4944");
+    gnrc_sixlowpan_frag_sfr_peer_add(_peer_l2addr, sizeof(_peer_l2addr));
+    _run("RFC 8931");
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect(r"RFC 4944: (\d+)/(\d+) datagrams delivered, (\d+) frames, ")
+    assert child.match.group(1) == child.match.group(2)
+    classic = int(child.match.group(3))
+    child.expect(r"RFC 8931: (\d+)/(\d+) datagrams delivered, (\d+) frames, ")
+    assert child.match.group(1) == child.match.group(2)
+    sfr = int(child.match.group(3))
+    # the link drops the same frames on every run, so the frame counts of all
+    # delivered datagrams are deterministic
+    assert sfr < classic
+    child.expect("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc, timeout=120))
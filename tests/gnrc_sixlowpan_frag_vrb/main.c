@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the 6LoWPAN virtual reassembly buffer
+ *
+ * Entries are added with this thread as the interface to the next hop, so
+ * forwarded fragments are received by this thread.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "bitfield.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/sixlowpan.h"
+#include "vrb.h"
+
+#define TEST_TAG            (0x1234U)
+#define TEST_OUT_TAG_NONE   (0U)
+/* a first fragment of 40 bytes, then 16 and 8 bytes */
+#define TEST_DGRAM_SIZE     (64U)
+#define TEST_FRAG1_LEN      (40U)
+#define TEST_FRAG2_LEN      (16U)
+#define TEST_MSG_QUEUE_SIZE (4U)
+
+static const uint8_t _dst[] = { 0x00, 0xff };
+static const uint8_t _next_hop[] = { 0x00, 0x02 };
+static msg_t _msg_queue[TEST_MSG_QUEUE_SIZE];
+
+static void set_up(void)
+{
+    vrb_reset();
+}
+
+static void tear_down(void)
+{
+    msg_t msg;
+
+    vrb_reset();
+    /* release fragments not received by the test */
+    while (msg_try_receive(&msg) > 0) {
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static vrb_t *_add(uint8_t src, uint16_t tag)
+{
+    const uint8_t addr[] = { 0x00, src };
+
+    return vrb_add(addr, sizeof(addr), _dst, sizeof(_dst), TEST_DGRAM_SIZE,
+                   tag, thread_getpid(), _next_hop, sizeof(_next_hop));
+}
+
+/* marks the first fragment as forwarded, as if the entry was added for it */
+static void _first_forwarded(vrb_t *entry)
+{
+    bf_set(entry->forwarded, 0);
+    entry->cur_size = TEST_FRAG1_LEN;
+}
+
+/* a received fragment with its netif header */
+static gnrc_pktsnip_t *_frag_pkt(uint8_t src, uint16_t tag, uint16_t offset,
+                                 size_t len)
+{
+    const uint8_t addr[] = { 0x00, src };
+    gnrc_pktsnip_t *netif, *pkt;
+    sixlowpan_frag_n_t *hdr;
+    size_t hdr_len = (offset == 0) ? sizeof(sixlowpan_frag_t)
+                                   : sizeof(sixlowpan_frag_n_t);
+
+    netif = gnrc_netif_hdr_build((uint8_t *)addr, sizeof(addr),
+                                 (uint8_t *)_dst, sizeof(_dst));
+    if (netif == NULL) {
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(netif, NULL, hdr_len + len, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    memset(pkt->data, 0, pkt->size);
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (offset == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+    }
+    return pkt;
+}
+
+static bool _forward(uint8_t src, uint16_t tag, uint16_t offset, size_t len)
+{
+    gnrc_pktsnip_t *pkt = _frag_pkt(src, tag, offset, len);
+    bool res;
+
+    if (pkt == NULL) {
+        return false;
+    }
+    res = vrb_forward(pkt->next->data, pkt, len, offset);
+    if (!res) {
+        /* left to the reassembly buffer */
+        gnrc_pktbuf_release(pkt);
+    }
+    return res;
+}
+
+/* returns the tag of the next forwarded fragment after checking where it
+ * went or TEST_OUT_TAG_NONE if there is none */
+static uint16_t _forwarded(void)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_frag_t *hdr;
+    gnrc_pktsnip_t *pkt;
+    uint16_t tag;
+    msg_t msg;
+
+    if ((msg_try_receive(&msg) < 1) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_SND)) {
+        return TEST_OUT_TAG_NONE;
+    }
+    pkt = msg.content.ptr;
+    netif_hdr = pkt->data;
+    hdr = pkt->next->data;
+    if ((netif_hdr->if_pid != thread_getpid()) ||
+        (netif_hdr->dst_l2addr_len != sizeof(_next_hop)) ||
+        (memcmp(gnrc_netif_hdr_get_dst_addr(netif_hdr), _next_hop,
+                sizeof(_next_hop)) != 0)) {
+        tag = TEST_OUT_TAG_NONE;
+    }
+    else {
+        tag = byteorder_ntohs(hdr->tag);
+    }
+    gnrc_pktbuf_release(pkt);
+    return tag;
+}
+
+static vrb_t *_get(uint8_t src, uint16_t tag)
+{
+    gnrc_pktsnip_t *pkt = _frag_pkt(src, tag, TEST_FRAG1_LEN, TEST_FRAG2_LEN);
+    vrb_t *res;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    res = vrb_get(pkt->next->data, TEST_DGRAM_SIZE, tag);
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+static void test_vrb_add__lookup(void)
+{
+    vrb_t *entry = _add(1, TEST_TAG);
+
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT(entry->out_tag != TEST_OUT_TAG_NONE);
+    TEST_ASSERT(_get(1, TEST_TAG) == entry);
+    /* another tag or source is another datagram */
+    TEST_ASSERT_NULL(_get(1, TEST_TAG + 1));
+    TEST_ASSERT_NULL(_get(2, TEST_TAG));
+    TEST_ASSERT(_add(2, TEST_TAG) != entry);
+    TEST_ASSERT(_get(1, TEST_TAG) == entry);
+}
+
+static void test_vrb_add__full(void)
+{
+    vrb_t *oldest = _add(1, TEST_TAG);
+
+    for (unsigned i = 1; i < VRB_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(_add(1 + i, TEST_TAG));
+    }
+    for (unsigned i = 0; i < VRB_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(_get(1 + i, TEST_TAG));
+    }
+    /* the first entry waited the longest for a fragment */
+    TEST_ASSERT(_add(VRB_SIZE + 1, TEST_TAG) == oldest);
+    TEST_ASSERT_NULL(_get(1, TEST_TAG));
+    TEST_ASSERT(_get(VRB_SIZE + 1, TEST_TAG) == oldest);
+}
+
+static void test_vrb_forward__subsequent(void)
+{
+    vrb_t *entry = _add(1, TEST_TAG);
+
+    TEST_ASSERT_NOT_NULL(entry);
+    _first_forwarded(entry);
+    TEST_ASSERT(_forward(1, TEST_TAG, TEST_FRAG1_LEN, TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(entry->out_tag, _forwarded());
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG1_LEN + TEST_FRAG2_LEN, entry->cur_size);
+    /* a fragment of an unknown datagram is left to the reassembly buffer */
+    TEST_ASSERT(!_forward(2, TEST_TAG, TEST_FRAG1_LEN, TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(TEST_OUT_TAG_NONE, _forwarded());
+}
+
+static void test_vrb_forward__duplicate(void)
+{
+    vrb_t *entry = _add(1, TEST_TAG);
+
+    TEST_ASSERT_NOT_NULL(entry);
+    _first_forwarded(entry);
+    TEST_ASSERT(_forward(1, TEST_TAG, TEST_FRAG1_LEN, TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(entry->out_tag, _forwarded());
+    /* duplicates are dropped and don't count to the datagram */
+    TEST_ASSERT(_forward(1, TEST_TAG, TEST_FRAG1_LEN, TEST_FRAG2_LEN));
+    TEST_ASSERT(_forward(1, TEST_TAG, 0, TEST_FRAG1_LEN));
+    TEST_ASSERT_EQUAL_INT(TEST_OUT_TAG_NONE, _forwarded());
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG1_LEN + TEST_FRAG2_LEN, entry->cur_size);
+    TEST_ASSERT(_get(1, TEST_TAG) == entry);
+    /* the last fragment completes the datagram */
+    TEST_ASSERT(_forward(1, TEST_TAG, TEST_FRAG1_LEN + TEST_FRAG2_LEN,
+                         TEST_DGRAM_SIZE - TEST_FRAG1_LEN - TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(entry->out_tag, _forwarded());
+    TEST_ASSERT_NULL(_get(1, TEST_TAG));
+}
+
+static void test_vrb_get__timeout(void)
+{
+    vrb_t *entry = _add(1, TEST_TAG);
+
+    TEST_ASSERT_NOT_NULL(entry);
+    _first_forwarded(entry);
+    /* a fragment keeps the entry alive */
+    xtimer_usleep((RBUF_TIMEOUT * 3) / 4);
+    TEST_ASSERT(_forward(1, TEST_TAG, TEST_FRAG1_LEN, TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(entry->out_tag, _forwarded());
+    xtimer_usleep((RBUF_TIMEOUT * 3) / 4);
+    TEST_ASSERT(_get(1, TEST_TAG) == entry);
+    xtimer_usleep(RBUF_TIMEOUT + (RBUF_TIMEOUT / 4));
+    TEST_ASSERT_NULL(_get(1, TEST_TAG));
+    TEST_ASSERT(!_forward(1, TEST_TAG, TEST_FRAG1_LEN + TEST_FRAG2_LEN,
+                          TEST_DGRAM_SIZE - TEST_FRAG1_LEN - TEST_FRAG2_LEN));
+    TEST_ASSERT_EQUAL_INT(TEST_OUT_TAG_NONE, _forwarded());
+}
+
+static Test *tests_vrb(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vrb_add__lookup),
+        new_TestFixture(test_vrb_add__full),
+        new_TestFixture(test_vrb_forward__subsequent),
+        new_TestFixture(test_vrb_forward__duplicate),
+        new_TestFixture(test_vrb_get__timeout),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, TEST_MSG_QUEUE_SIZE);
+
+    TESTS_START();
+    TESTS_RUN(tests_vrb());
+    TESTS_END();
+
+    return 0;
+}
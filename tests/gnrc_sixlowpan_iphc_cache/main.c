@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests that the IPHC flow cache yields the same encoding as
+ *              compressing the addresses anew
+ *
+ * Every flow is compressed once with an empty cache and once with its
+ * cached addresses. Between the two, the context buffer is set up again,
+ * which invalidates all cached flows, so a packet can be encoded on both
+ * paths and the results compared byte by byte.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+
+/* encoding never sends, so the interface does not need to exist */
+#define TEST_IF_PID         (7)
+#define TEST_BUF_SIZE       (64U)
+
+typedef struct {
+    ipv6_addr_t src;
+    ipv6_addr_t dst;
+    uint8_t tc;
+    uint32_t fl;
+    uint8_t hl;
+    bool udp;
+} test_pkt_t;
+
+static uint8_t _src_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static uint8_t _dst_l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+
+/* 2001:db8::/64, compression context 0 */
+static const ipv6_addr_t _ctx0_prefix = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    } };
+/* fd00::/64, compression context 1 (needs the CID extension) */
+static const ipv6_addr_t _ctx1_prefix = { {
+        0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    } };
+
+static uint8_t _uncached[TEST_BUF_SIZE];
+static uint8_t _cached[TEST_BUF_SIZE];
+
+static void _setup_ctxs(void)
+{
+    /* also changes the version of the context buffer, which invalidates all
+     * cached flows */
+    gnrc_sixlowpan_ctx_reset();
+    gnrc_sixlowpan_ctx_update(0, &_ctx0_prefix, 64, UINT16_MAX, true);
+    gnrc_sixlowpan_ctx_update(1, &_ctx1_prefix, 64, UINT16_MAX, true);
+}
+
+static void _encode(const test_pkt_t *test, uint8_t *buf, size_t *len)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *pkt;
+    ipv6_hdr_t *hdr;
+
+    *len = 0;
+
+    pkt = gnrc_pktbuf_add(NULL, "test", sizeof("test"), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    if (test->udp) {
+        udp_hdr_t *udp_hdr;
+
+        pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+        TEST_ASSERT_NOT_NULL(pkt);
+        udp_hdr = pkt->data;
+        udp_hdr->src_port = byteorder_htons(0xf0b1);
+        udp_hdr->dst_port = byteorder_htons(0xf0b2);
+        udp_hdr->length = byteorder_htons(gnrc_pkt_len(pkt));
+        udp_hdr->checksum = byteorder_htons(0x1234);
+    }
+    ipv6 = gnrc_pktbuf_add(pkt, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(hdr);
+    ipv6_hdr_set_tc(hdr, test->tc);
+    ipv6_hdr_set_fl(hdr, test->fl);
+    hdr->len = byteorder_htons(gnrc_pkt_len(pkt));
+    hdr->nh = (test->udp) ? PROTNUM_UDP : PROTNUM_IPV6_NONXT;
+    hdr->hl = test->hl;
+    memcpy(&hdr->src, &test->src, sizeof(hdr->src));
+    memcpy(&hdr->dst, &test->dst, sizeof(hdr->dst));
+    netif = gnrc_netif_hdr_build(_src_l2addr, sizeof(_src_l2addr),
+                                 _dst_l2addr, sizeof(_dst_l2addr));
+    TEST_ASSERT_NOT_NULL(netif);
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = TEST_IF_PID;
+    netif->next = ipv6;
+
+    TEST_ASSERT(gnrc_sixlowpan_iphc_encode(netif));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_SIXLOWPAN, netif->next->type);
+    TEST_ASSERT(gnrc_pkt_len(netif->next) <= TEST_BUF_SIZE);
+    for (gnrc_pktsnip_t *snip = netif->next; snip != NULL; snip = snip->next) {
+        memcpy(buf + *len, snip->data, snip->size);
+        *len += snip->size;
+    }
+    gnrc_pktbuf_release(netif);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/*
+ * Encodes every packet of a flow once on the uncached path and once with the
+ * addresses cached by the first packet of the flow
+ */
+static void _check_flow(const test_pkt_t *pkts, unsigned pkts_numof)
+{
+    gnrc_sixlowpan_iphc_cache_stats_t *stats = gnrc_sixlowpan_iphc_cache_stats_get();
+
+    for (unsigned i = 0; i < pkts_numof; i++) {
+        uint32_t hits, misses;
+        size_t uncached_len, cached_len, primed_len;
+
+        _setup_ctxs();
+        misses = stats->misses;
+        _encode(&pkts[i], _uncached, &uncached_len);
+        TEST_ASSERT_EQUAL_INT(misses + 1, stats->misses);
+
+        /* the first packet of the flow primes the cache for the others */
+        _setup_ctxs();
+        _encode(&pkts[0], _cached, &primed_len);
+        hits = stats->hits;
+        _encode(&pkts[i], _cached, &cached_len);
+        TEST_ASSERT_EQUAL_INT(hits + 1, stats->hits);
+
+        TEST_ASSERT_EQUAL_INT(uncached_len, cached_len);
+        TEST_ASSERT(memcmp(_uncached, _cached, cached_len) == 0);
+    }
+}
+
+static void test_iphc_cache__link_local(void)
+{
+    /* source derived from the link-layer address, destination 16 bit */
+    const test_pkt_t pkts[] = {
+        { .src = { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x12, 0x34 } },
+          .hl = 255 },
+        { .src = { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x12, 0x34 } },
+          .tc = 0x2e, .fl = 0x12345, .hl = 17, .udp = true },
+    };
+
+    _check_flow(pkts, sizeof(pkts) / sizeof(pkts[0]));
+}
+
+static void test_iphc_cache__stateful(void)
+{
+    /* both addresses context-based, the source IID is elided */
+    const test_pkt_t pkts[] = {
+        { .src = { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 } },
+          .dst = { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .hl = 64, .udp = true },
+        { .src = { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 } },
+          .dst = { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .tc = 0x01, .hl = 1 },
+    };
+
+    _check_flow(pkts, sizeof(pkts) / sizeof(pkts[0]));
+}
+
+static void test_iphc_cache__cid_multicast(void)
+{
+    /* source with CID extension, link-local all-nodes destination */
+    const test_pkt_t pkts[] = {
+        { .src = { { 0xfd, 0x00, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xff, 0x02, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .hl = 255 },
+        { .src = { { 0xfd, 0x00, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xff, 0x02, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .fl = 0xabcde, .hl = 64, .udp = true },
+    };
+
+    _check_flow(pkts, sizeof(pkts) / sizeof(pkts[0]));
+}
+
+static void test_iphc_cache__inline(void)
+{
+    /* source without context carried in full, 32-bit multicast
+     * destination */
+    const test_pkt_t pkts[] = {
+        { .src = { { 0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xff, 0x05, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03 } },
+          .hl = 64 },
+        { .src = { { 0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+          .dst = { { 0xff, 0x05, 0, 0, 0, 0, 0, 0,
+                     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03 } },
+          .tc = 0xb8, .fl = 0x1, .hl = 200, .udp = true },
+    };
+
+    _check_flow(pkts, sizeof(pkts) / sizeof(pkts[0]));
+}
+
+static Test *tests_iphc_cache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_iphc_cache__link_local),
+        new_TestFixture(test_iphc_cache__stateful),
+        new_TestFixture(test_iphc_cache__cid_multicast),
+        new_TestFixture(test_iphc_cache__inline),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_iphc_cache());
+    TESTS_END();
+
+    return 0;
+}
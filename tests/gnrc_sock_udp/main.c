@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "net/iana/portrange.h"
 #include "net/sock/udp.h"
 #include "xtimer.h"
 
@@ -379,6 +380,118 @@ static void test_sock_udp_recv__non_blocking(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_buf__EPROTO(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    void *data = NULL, *ctx = NULL;
+
+    assert(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    assert(-EPROTO == sock_udp_recv_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT,
+                                        NULL));
+    assert(ctx == NULL);
+    assert(_check_net());
+}
+
+static void test_sock_udp_recv_buf__with_remote(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+    void *data = NULL, *ctx = NULL;
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    assert(sizeof("ABCD") == sock_udp_recv_buf(&_sock, &data, &ctx,
+                                               SOCK_NO_TIMEOUT, &result));
+    assert(memcmp(data, "ABCD", sizeof("ABCD")) == 0);
+    assert(AF_INET6 == result.family);
+    assert(memcmp(&result.addr, &src_addr, sizeof(result.addr)) == 0);
+    assert(_TEST_PORT_REMOTE == result.port);
+    assert(_TEST_NETIF == result.netif);
+    /* the payload is kept until the end of the iteration */
+    assert(!_check_net());
+    assert(0 == sock_udp_recv_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT, NULL));
+    assert((data == NULL) && (ctx == NULL));
+    assert(_check_net());
+}
+
+static void test_sock_udp_recv_buf__empty(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+    void *data = NULL, *ctx = NULL;
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "", 0, _TEST_NETIF));
+    /* the first call already ends the iteration and releases the packet */
+    assert(0 == sock_udp_recv_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT,
+                                  &result));
+    assert((data == NULL) && (ctx == NULL));
+    assert(_TEST_PORT_REMOTE == result.port);
+    assert(_check_net());
+}
+
+static void test_sock_udp_recv_batch__EAGAIN(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6, .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msg = { .data = _test_buffer, .len = sizeof(_test_buffer) };
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+
+    assert(-EAGAIN == sock_udp_recv_batch(&_sock, &msg, 1, 0));
+}
+
+static void test_sock_udp_recv_batch__waiting(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t results[3];
+    sock_udp_msg_t msgs[3];
+
+    for (unsigned i = 0; i < 3; i++) {
+        msgs[i].data = &_test_buffer[i * (sizeof(_test_buffer) / 3)];
+        msgs[i].len = sizeof(_test_buffer) / 3;
+        msgs[i].remote = &results[i];
+    }
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"),
+                          _TEST_NETIF));
+    /* only the waiting messages are received */
+    assert(2 == sock_udp_recv_batch(&_sock, msgs, 3, SOCK_NO_TIMEOUT));
+    assert(sizeof("ABCD") == msgs[0].len);
+    assert(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    assert(_TEST_PORT_REMOTE == results[0].port);
+    assert(sizeof("EF") == msgs[1].len);
+    assert(memcmp(msgs[1].data, "EF", sizeof("EF")) == 0);
+    assert((_TEST_PORT_REMOTE + 1) == results[1].port);
+    assert(memcmp(&results[1].addr, &src_addr, sizeof(results[1].addr)) == 0);
+    assert(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -493,6 +606,38 @@ static void test_sock_udp_send__socketed_no_local(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_send__socketed_no_local_dyn_port(void)
+{
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .netif = _TEST_NETIF,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t ep, ep2;
+
+    assert(0 == sock_udp_create(&_sock, NULL, &remote, 0));
+    assert(0 == sock_udp_create(&_sock2, NULL, &remote, 0));
+    assert(sizeof("ABCD") == sock_udp_send(&_sock, "ABCD", sizeof("ABCD"),
+                                           NULL));
+    assert(_check_packet(&ipv6_addr_unspecified, &dst_addr, 0,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"), _TEST_NETIF,
+                         true));
+    assert(sizeof("EFGH") == sock_udp_send(&_sock2, "EFGH", sizeof("EFGH"),
+                                           NULL));
+    assert(_check_packet(&ipv6_addr_unspecified, &dst_addr, 0,
+                         _TEST_PORT_REMOTE, "EFGH", sizeof("EFGH"), _TEST_NETIF,
+                         true));
+    /* both socks were bound implicitly to different dynamic ports */
+    assert(0 == sock_udp_get_local(&_sock, &ep));
+    assert(0 == sock_udp_get_local(&_sock2, &ep2));
+    assert(ep.port >= IANA_DYNAMIC_PORTRANGE_MIN);
+    assert(ep2.port >= IANA_DYNAMIC_PORTRANGE_MIN);
+    assert(ep.port != ep2.port);
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    assert(_check_net());
+    sock_udp_close(&_sock2);
+}
+
 static void test_sock_udp_send__socketed(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -515,6 +660,52 @@ static void test_sock_udp_send__socketed(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_send_batch__ENOTCONN(void)
+{
+    sock_udp_msg_t msg = { .data = "ABCD", .len = sizeof("ABCD") };
+
+    assert(0 == sock_udp_create(&_sock, NULL, NULL, SOCK_FLAGS_REUSE_EP));
+    assert(-ENOTCONN == sock_udp_send_batch(&_sock, &msg, 1));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    assert(_check_net());
+}
+
+static void test_sock_udp_send_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t other_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    static sock_udp_ep_t other = { .addr = { .ipv6 = _TEST_ADDR_WRONG },
+                                   .family = AF_INET6,
+                                   .port = _TEST_PORT_REMOTE + 1 };
+    static sock_udp_ep_t invalid = { .family = AF_INET6,
+                                     .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD"), .remote = NULL },
+        { .data = "EF", .len = sizeof("EF"), .remote = &other },
+        { .data = "GH", .len = sizeof("GH"), .remote = &invalid },
+    };
+
+    assert(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    /* sending stops at the invalid remote */
+    assert(2 == sock_udp_send_batch(&_sock, msgs, 3));
+    assert(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    assert(_check_packet(&src_addr, &other_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "EF", sizeof("EF"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    assert(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -680,6 +871,11 @@ int main(void)
     CALL(test_sock_udp_recv__unsocketed_with_remote());
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
+    CALL(test_sock_udp_recv_buf__EPROTO());
+    CALL(test_sock_udp_recv_buf__with_remote());
+    CALL(test_sock_udp_recv_buf__empty());
+    CALL(test_sock_udp_recv_batch__EAGAIN());
+    CALL(test_sock_udp_recv_batch__waiting());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -689,7 +885,10 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local_no_netif());
     CALL(test_sock_udp_send__socketed_no_netif());
     CALL(test_sock_udp_send__socketed_no_local());
+    CALL(test_sock_udp_send__socketed_no_local_dyn_port());
     CALL(test_sock_udp_send__socketed());
+    CALL(test_sock_udp_send_batch__ENOTCONN());
+    CALL(test_sock_udp_send_batch__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
@@ -37,6 +37,11 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_recv__unsocketed_with_remote()")
     child.expect_exact(u"Calling test_sock_udp_recv__with_timeout()")
     child.expect_exact(u"Calling test_sock_udp_recv__non_blocking()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf__EPROTO()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf__with_remote()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf__empty()")
+    child.expect_exact(u"Calling test_sock_udp_recv_batch__EAGAIN()")
+    child.expect_exact(u"Calling test_sock_udp_recv_batch__waiting()")
     child.expect_exact(u"Calling test_sock_udp_send__EAFNOSUPPORT()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_addr()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_netif()")
@@ -45,7 +50,10 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_local_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_local()")
+    child.expect_exact(u"Calling test_sock_udp_send__socketed_no_local_dyn_port()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed()")
+    child.expect_exact(u"Calling test_sock_udp_send_batch__ENOTCONN()")
+    child.expect_exact(u"Calling test_sock_udp_send_batch__socketed()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_other_remote()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_local_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_netif()")
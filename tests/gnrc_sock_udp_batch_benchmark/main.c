@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares single and batched send and receive of UDP sock
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "shell.h"
+#include "xtimer.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netif.h"
+#include "net/sock/udp.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BENCH_PORT          (4711U)
+#define BENCH_DEFAULT_NUM   (10000U)
+/* batches must fit into the mbox of the receiving sock */
+#define BATCH_SIZE          (8U)
+#define PAYLOAD_MAX         (100U)
+/* loopback datagrams pass the IPv6 and UDP threads before they arrive */
+#define RECV_TIMEOUT        (1U * US_PER_SEC)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static sock_udp_t _server, _client;
+static sock_udp_ep_t _remote = { .family = AF_INET6, .port = BENCH_PORT };
+static uint8_t _payload[PAYLOAD_MAX];
+static uint8_t _bufs[BATCH_SIZE][PAYLOAD_MAX];
+
+static int _run_single(size_t len)
+{
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (sock_udp_send(&_client, _payload, len, &_remote) < 0) {
+            return -1;
+        }
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (sock_udp_recv(&_server, _bufs[i], sizeof(_bufs[i]), RECV_TIMEOUT,
+                          NULL) != (ssize_t)len) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _run_batch(size_t len)
+{
+    sock_udp_msg_t msgs[BATCH_SIZE];
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        msgs[i].data = _payload;
+        msgs[i].len = len;
+        msgs[i].remote = &_remote;
+    }
+    if (sock_udp_send_batch(&_client, msgs, BATCH_SIZE) != BATCH_SIZE) {
+        return -1;
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        msgs[i].data = _bufs[i];
+        msgs[i].len = sizeof(_bufs[i]);
+        msgs[i].remote = NULL;
+    }
+    /* a batch returns what already arrived, so wait for the rest */
+    for (unsigned rcvd = 0; rcvd < BATCH_SIZE;) {
+        ssize_t res = sock_udp_recv_batch(&_server, &msgs[rcvd],
+                                          BATCH_SIZE - rcvd, RECV_TIMEOUT);
+
+        if (res <= 0) {
+            return -1;
+        }
+        for (unsigned i = rcvd; i < (rcvd + (unsigned)res); i++) {
+            if (msgs[i].len != len) {
+                return -1;
+            }
+        }
+        rcvd += (unsigned)res;
+    }
+    return 0;
+}
+
+/* drops datagrams left over from a failed round */
+static void _drain(void)
+{
+    while (sock_udp_recv(&_server, _bufs[0], sizeof(_bufs[0]), 0, NULL) >= 0) {}
+}
+
+static int _bench(const char *name, const char *dst, int (*run)(size_t),
+                  size_t len, unsigned num)
+{
+    uint32_t start, duration;
+    unsigned sent = 0;
+
+    start = xtimer_now_usec();
+    while (sent < num) {
+        if (run(len) < 0) {
+            printf("error: %s, %s, %u bytes: failed after %u datagrams\n",
+                   name, dst, (unsigned)len, sent);
+            _drain();
+            return -1;
+        }
+        sent += BATCH_SIZE;
+    }
+    duration = xtimer_now_usec() - start;
+    printf("%s, %s, %u bytes: %u datagrams in %" PRIu32 " us (%" PRIu32
+           " datagrams/s)\n", name, dst, (unsigned)len, sent, duration,
+           (uint32_t)(((uint64_t)sent * US_PER_SEC) / duration));
+    return 0;
+}
+
+/* gets the link-local address of the interface */
+static int _get_link_local(ipv6_addr_t *addr)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+    ipv6_addr_t *ll;
+
+    if ((gnrc_netif_get(ifs) == 0) ||
+        ((ll = gnrc_ipv6_netif_find_best_src_addr(ifs[0],
+                                                  &ipv6_addr_all_nodes_link_local,
+                                                  true)) == NULL)) {
+        return -1;
+    }
+    memcpy(addr, ll, sizeof(ipv6_addr_t));
+    return 0;
+}
+
+static int _udp_bench(int argc, char **argv)
+{
+    static const size_t lens[] = { 1, PAYLOAD_MAX };
+    unsigned num = BENCH_DEFAULT_NUM;
+
+    if (argc > 1) {
+        num = atoi(argv[1]);
+    }
+    for (unsigned dst = 0; dst < 2; dst++) {
+        const char *name = (dst == 0) ? "loopback" : "link-local";
+
+        /* a datagram to the loopback address bypasses the lookups of the
+         * interface and the source address in the IPv6 thread, a datagram to
+         * an address of the interface doesn't */
+        if (dst == 0) {
+            ipv6_addr_set_loopback((ipv6_addr_t *)&_remote.addr.ipv6);
+        }
+        else if (_get_link_local((ipv6_addr_t *)&_remote.addr.ipv6) < 0) {
+            puts("error: no link-local address");
+            return 1;
+        }
+        for (unsigned i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            if ((_bench("single", name, _run_single, lens[i], num) < 0) ||
+                (_bench("batch", name, _run_batch, lens[i], num) < 0)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "udp_bench", "send and receive [number] datagrams to the node itself",
+      _udp_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC UDP sock batch benchmark");
+    memset(_payload, 'x', sizeof(_payload));
+
+    local.port = BENCH_PORT;
+    if ((sock_udp_create(&_server, &local, NULL, 0) < 0) ||
+        (sock_udp_create(&_client, NULL, NULL, 0) < 0)) {
+        puts("error: unable to create socks");
+        return 1;
+    }
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
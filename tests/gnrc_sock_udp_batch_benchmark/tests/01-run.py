@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+NUM = int(os.environ.get('BENCH_NUM', 10000))
+LENS = (1, 100)
+DSTS = ("loopback", "link-local")
+
+
+def testfunc(child):
+    rates = {}
+
+    child.expect_exact(u"GNRC UDP sock batch benchmark")
+    child.sendline(u"udp_bench {}".format(NUM))
+    for dst in DSTS:
+        for length in LENS:
+            for name in ("single", "batch"):
+                res = child.expect([r"{}, {}, {} bytes: \d+ datagrams in \d+ us "
+                                    r"\((\d+) datagrams/s\)".format(name, dst,
+                                                                    length),
+                                    r"error: [^\n]+"])
+                if res == 1:
+                    raise RuntimeError(child.match.group(0).strip())
+                rates[name, dst, length] = int(child.match.group(1))
+
+    print("\ndestination  payload  single [datagrams/s]  batch [datagrams/s]  "
+          "ratio")
+    for dst in DSTS:
+        for length in LENS:
+            single = rates["single", dst, length]
+            batch = rates["batch", dst, length]
+            print("{:>11}  {:>5} B  {:>20}  {:>19}  {:>5.2f}".format(
+                dst, length, single, batch, batch / single))
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc, timeout=120))
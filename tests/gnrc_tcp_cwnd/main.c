@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the growth of the congestion window of GNRC TCP on
+ *              acknowledgments
+ *
+ * Segments are put into the retransmission queue the way they are sent and
+ * acknowledged with _pkt_acknowledge().
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/tcp.h"
+#include "internal/common.h"
+#include "internal/pkt.h"
+
+#define TEST_ISS        (1000U)
+
+static gnrc_tcp_tcb_t _tcb;
+static uint32_t _smss;
+
+static void set_up(void)
+{
+    gnrc_tcp_tcb_init(&_tcb);
+    _tcb.mss = GNRC_TCP_MSS;
+    _tcb.snd_una = TEST_ISS;
+    _tcb.snd_nxt = TEST_ISS;
+    _tcb.recover = TEST_ISS;
+    _tcb.cwnd = _pkt_get_initial_cwnd(&_tcb);
+    _tcb.ssthresh = UINT16_MAX;
+    _smss = _pkt_get_smss(&_tcb);
+}
+
+static void tear_down(void)
+{
+    /* drops what is left in the retransmission queue and stops the timer */
+    _pkt_acknowledge(&_tcb, _tcb.snd_nxt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/* queues a full-sized data segment the way it is sent */
+static gnrc_pktsnip_t *_send_segment(void)
+{
+    gnrc_pktsnip_t *pay, *pkt;
+    tcp_hdr_t hdr;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.seq_num = byteorder_htonl(_tcb.snd_nxt);
+    hdr.off_ctl = byteorder_htons(MSK_ACK);
+    pay = gnrc_pktbuf_add(NULL, NULL, _smss, GNRC_NETTYPE_UNDEF);
+    pkt = gnrc_pktbuf_add(pay, &hdr, sizeof(hdr), GNRC_NETTYPE_TCP);
+    if ((pay == NULL) || (pkt == NULL) || (_pkt_setup_retransmit(&_tcb, pkt, false) < 0)) {
+        return NULL;
+    }
+    /* the network stack consumes the user of the caller */
+    gnrc_pktbuf_release(pkt);
+    _tcb.snd_nxt += _smss;
+    return pkt;
+}
+
+static void _ack(uint32_t ack)
+{
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(&_tcb, ack));
+    _tcb.snd_una = ack;
+}
+
+static void test_cwnd__slow_start_one_segment(void)
+{
+    uint32_t cwnd = _tcb.cwnd;
+
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT_EQUAL_INT(cwnd + _smss, _tcb.cwnd);
+}
+
+static void test_cwnd__slow_start_delayed_ack(void)
+{
+    uint32_t cwnd = _tcb.cwnd;
+
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    /* one ACK for two segments grows the window as much as two ACKs */
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT_EQUAL_INT(cwnd + (2 * _smss), _tcb.cwnd);
+}
+
+static void test_cwnd__slow_start_limit(void)
+{
+    uint32_t cwnd = _tcb.cwnd;
+
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    /* an ACK counts two segments at most */
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT_EQUAL_INT(cwnd + (2 * _smss), _tcb.cwnd);
+}
+
+static void test_cwnd__slow_start_after_timeout(void)
+{
+    gnrc_pktsnip_t *pkt = _send_segment();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    /* the oldest segment timed out and is sent again */
+    TEST_ASSERT_EQUAL_INT(0, _pkt_setup_retransmit(&_tcb, pkt, true));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(_smss, _tcb.cwnd);
+    /* as if more segments than the queue holds had been in flight */
+    _tcb.ssthresh = 4 * _smss;
+
+    /* one ACK for two segments counts one segment only */
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT_EQUAL_INT(2 * _smss, _tcb.cwnd);
+
+    /* leaving slow start ends the recovery from the timeout */
+    while (_tcb.cwnd < _tcb.ssthresh) {
+        TEST_ASSERT_NOT_NULL(_send_segment());
+        _ack(_tcb.snd_nxt);
+    }
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT(!(_tcb.status & STATUS_RTO_RECOVERY));
+}
+
+static void test_cwnd__congestion_avoidance(void)
+{
+    uint32_t cwnd;
+
+    _tcb.ssthresh = _tcb.cwnd;
+    cwnd = _tcb.cwnd;
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    TEST_ASSERT_NOT_NULL(_send_segment());
+    _ack(_tcb.snd_nxt);
+    TEST_ASSERT_EQUAL_INT(cwnd + ((_smss * _smss) / cwnd), _tcb.cwnd);
+}
+
+static Test *tests_cwnd(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_cwnd__slow_start_one_segment),
+        new_TestFixture(test_cwnd__slow_start_delayed_ack),
+        new_TestFixture(test_cwnd__slow_start_limit),
+        new_TestFixture(test_cwnd__slow_start_after_timeout),
+        new_TestFixture(test_cwnd__congestion_avoidance),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_cwnd());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Serves several connections from one thread with the non-blocking
+ *              GNRC TCP API
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/af.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/tcp.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define CONNS               (8U)
+#define PORT                (8080U)
+#define PAYLOAD_SIZE        (2048U)
+#define TEST_TIMEOUT        (20U * US_PER_SEC)
+
+#define MSG_TYPE_WAKEUP     (0x4242)
+#define MSG_TYPE_TIMEOUT    (0x4243)
+
+typedef struct {
+    gnrc_tcp_tcb_t tcb;
+    volatile uint8_t events;    /**< events not handled yet */
+    bool client;
+    bool closing;
+    bool closed;
+    size_t sent;                /**< bytes of buf sent */
+    size_t rcvd;                /**< bytes received into buf */
+    uint8_t buf[PAYLOAD_SIZE];
+} conn_t;
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static conn_t _servers[CONNS];
+static conn_t _clients[CONNS];
+static unsigned _failed;
+
+static void _event_cb(gnrc_tcp_tcb_t *tcb, uint8_t events, void *arg)
+{
+    conn_t *conn = arg;
+    unsigned state = irq_disable();
+    msg_t msg;
+
+    (void)tcb;
+    conn->events |= events;
+    irq_restore(state);
+
+    /* the events are kept in conn, so a lost wakeup on a full queue is harmless */
+    msg.type = MSG_TYPE_WAKEUP;
+    msg_try_send(&msg, _main_pid);
+}
+
+static inline uint8_t _pattern(unsigned idx, size_t pos)
+{
+    return (uint8_t)(idx * 31 + pos);
+}
+
+static void _send(conn_t *conn, size_t len)
+{
+    while (conn->sent < len) {
+        ssize_t res = gnrc_tcp_send_nb(&conn->tcb, conn->buf + conn->sent,
+                                       len - conn->sent);
+        if (res < 0) {
+            if (res != -EAGAIN) {
+                printf("send failed (%d)\n", (int)res);
+                _failed++;
+            }
+            /* GNRC_TCP_EVENT_WRITABLE continues */
+            return;
+        }
+        conn->sent += res;
+    }
+}
+
+static void _handle_client(conn_t *conn, unsigned idx, uint8_t events)
+{
+    if (events & (GNRC_TCP_EVENT_CONNECTED | GNRC_TCP_EVENT_WRITABLE)) {
+        _send(conn, PAYLOAD_SIZE);
+    }
+    if (events & GNRC_TCP_EVENT_READABLE) {
+        uint8_t tmp[128];
+        ssize_t res;
+
+        /* the echo is compared against the sent pattern */
+        while ((res = gnrc_tcp_recv_nb(&conn->tcb, tmp, sizeof(tmp))) > 0) {
+            for (ssize_t i = 0; i < res; i++) {
+                if ((conn->rcvd >= PAYLOAD_SIZE) ||
+                    (tmp[i] != _pattern(idx, conn->rcvd))) {
+                    printf("client %u: unexpected data at %u\n", idx,
+                           (unsigned)conn->rcvd);
+                    _failed++;
+                    gnrc_tcp_abort(&conn->tcb);
+                    return;
+                }
+                conn->rcvd++;
+            }
+        }
+        if ((conn->rcvd == PAYLOAD_SIZE) && !conn->closing) {
+            conn->closing = true;
+            gnrc_tcp_close_nb(&conn->tcb);
+        }
+    }
+}
+
+static void _handle_server(conn_t *conn, uint8_t events)
+{
+    if (events & GNRC_TCP_EVENT_READABLE) {
+        ssize_t res;
+
+        while ((conn->rcvd < PAYLOAD_SIZE) &&
+               ((res = gnrc_tcp_recv_nb(&conn->tcb, conn->buf + conn->rcvd,
+                                        PAYLOAD_SIZE - conn->rcvd)) > 0)) {
+            conn->rcvd += res;
+        }
+    }
+    /* echo what was received */
+    if (events & (GNRC_TCP_EVENT_READABLE | GNRC_TCP_EVENT_WRITABLE)) {
+        _send(conn, conn->rcvd);
+    }
+    /* close once the client closed and everything was echoed */
+    if (!conn->closing && (conn->rcvd == PAYLOAD_SIZE) && (conn->sent == PAYLOAD_SIZE) &&
+        (gnrc_tcp_recv_nb(&conn->tcb, conn->buf, 1) == 0)) {
+        conn->closing = true;
+        gnrc_tcp_close_nb(&conn->tcb);
+    }
+}
+
+static bool _handle(conn_t *conn, unsigned idx)
+{
+    unsigned state = irq_disable();
+    uint8_t events = conn->events;
+
+    conn->events = 0;
+    irq_restore(state);
+
+    if (events & GNRC_TCP_EVENT_CLOSED) {
+        if (!conn->closing || (conn->rcvd != PAYLOAD_SIZE) ||
+            (conn->sent != PAYLOAD_SIZE)) {
+            printf("%s %u: closed early (%u sent, %u received)\n",
+                   conn->client ? "client" : "server", idx,
+                   (unsigned)conn->sent, (unsigned)conn->rcvd);
+            _failed++;
+        }
+        conn->closed = true;
+    }
+    else if (conn->client) {
+        _handle_client(conn, idx, events);
+    }
+    else {
+        /* the peer may close before the last echo was sent */
+        _handle_server(conn, events | GNRC_TCP_EVENT_WRITABLE);
+    }
+    return conn->closed;
+}
+
+static void _init(conn_t *conn, bool client)
+{
+    memset(conn, 0, sizeof(conn_t));
+    conn->client = client;
+    gnrc_tcp_tcb_init(&conn->tcb);
+    gnrc_tcp_set_event_cb(&conn->tcb, _event_cb, conn);
+}
+
+int main(void)
+{
+    ipv6_addr_t addr = IPV6_ADDR_LOOPBACK;
+    xtimer_t timer;
+    msg_t msg, timeout = { .type = MSG_TYPE_TIMEOUT };
+    unsigned closed = 0;
+    int res;
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    _main_pid = thread_getpid();
+    puts("Start.");
+
+    for (unsigned i = 0; i < CONNS; i++) {
+        _init(&_servers[i], false);
+        if ((res = gnrc_tcp_open_passive_nb(&_servers[i].tcb, AF_INET6, NULL, PORT)) < 0) {
+            printf("listen failed (%d)\n", res);
+            return 1;
+        }
+    }
+    for (unsigned i = 0; i < CONNS; i++) {
+        _init(&_clients[i], true);
+        for (size_t pos = 0; pos < PAYLOAD_SIZE; pos++) {
+            _clients[i].buf[pos] = _pattern(i, pos);
+        }
+        if ((res = gnrc_tcp_open_active_nb(&_clients[i].tcb, AF_INET6,
+                                           (uint8_t *)&addr, PORT, 0)) < 0) {
+            printf("connect failed (%d)\n", res);
+            return 1;
+        }
+    }
+
+    xtimer_set_msg(&timer, TEST_TIMEOUT, &timeout, _main_pid);
+    while (closed < (2 * CONNS)) {
+        msg_receive(&msg);
+        if (msg.type == MSG_TYPE_TIMEOUT) {
+            printf("FAILED: %u connections not closed\n", (2 * CONNS) - closed);
+            return 1;
+        }
+        closed = 0;
+        for (unsigned i = 0; i < CONNS; i++) {
+            closed += (_clients[i].closed || _handle(&_clients[i], i));
+            closed += (_servers[i].closed || _handle(&_servers[i], i));
+        }
+    }
+    xtimer_remove(&timer);
+
+    if (_failed) {
+        printf("FAILED: %u errors\n", _failed);
+        return 1;
+    }
+    puts("SUCCESS");
+    return 0;
+}
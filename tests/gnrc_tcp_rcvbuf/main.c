@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the receive queues of several GNRC TCP connections
+ *              sharing GNRC_TCP_RCV_BUDGET
+ *
+ * Segments are added to the receive queues the way the FSM does it on
+ * reception, with the advertised window shrinking by the data added and
+ * updated afterwards.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "internal/rcvbuf.h"
+
+#define TEST_TCBS       (3U)
+#define TEST_SEG_LEN    (GNRC_TCP_DEFAULT_WINDOW / 2)
+
+static gnrc_tcp_tcb_t _tcbs[TEST_TCBS];
+static uint8_t _data[GNRC_TCP_DEFAULT_WINDOW];
+
+static void set_up(void)
+{
+    _rcvbuf_init();
+    for (unsigned i = 0; i < TEST_TCBS; i++) {
+        gnrc_tcp_tcb_init(&_tcbs[i]);
+        _tcbs[i].rcv_nxt = 1000U * i;
+        _tcbs[i].rcv_user = _tcbs[i].rcv_nxt;
+        /* every connection advertises its window on opening */
+        _rcvbuf_update_window(&_tcbs[i]);
+    }
+}
+
+static void tear_down(void)
+{
+    for (unsigned i = 0; i < TEST_TCBS; i++) {
+        _rcvbuf_release(&_tcbs[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/* payload of a segment: the low byte of the sequence number of each byte */
+static gnrc_pktsnip_t *_segment(uint32_t seq, size_t len)
+{
+    uint8_t payload[TEST_SEG_LEN];
+
+    for (size_t i = 0; i < len; i++) {
+        payload[i] = (uint8_t)(seq + i);
+    }
+    return gnrc_pktbuf_add(NULL, payload, len, GNRC_NETTYPE_UNDEF);
+}
+
+/* returns the number of bytes rcv_nxt advanced by */
+static uint32_t _receive(gnrc_tcp_tcb_t *tcb, uint32_t seq)
+{
+    gnrc_pktsnip_t *pkt = _segment(seq, TEST_SEG_LEN);
+    uint32_t added;
+
+    if (pkt == NULL) {
+        return 0;
+    }
+    added = _rcvbuf_add_segment(tcb, pkt, seq, TEST_SEG_LEN);
+    gnrc_pktbuf_release(pkt);
+    tcb->rcv_wnd = (added < tcb->rcv_wnd) ? tcb->rcv_wnd - added : 0;
+    _rcvbuf_update_window(tcb);
+    return added;
+}
+
+static void _fill_budget(void)
+{
+    /* the first two connections take the whole budget */
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[i], _tcbs[i].rcv_nxt));
+        TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[i], _tcbs[i].rcv_nxt));
+    }
+}
+
+static void test_rcvbuf__windows_on_open(void)
+{
+    for (unsigned i = 0; i < TEST_TCBS; i++) {
+        TEST_ASSERT_EQUAL_INT(GNRC_TCP_DEFAULT_WINDOW, _tcbs[i].rcv_wnd);
+    }
+}
+
+static void test_rcvbuf__budget_respected(void)
+{
+    uint32_t nxt = _tcbs[2].rcv_nxt;
+
+    TEST_ASSERT_EQUAL_INT(4 * TEST_SEG_LEN, GNRC_TCP_RCV_BUDGET);
+    _fill_budget();
+    /* a full window of unread data closes the window */
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[0].rcv_wnd);
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[1].rcv_wnd);
+    /* the third connection advertised a window before, but the budget is
+     * exhausted: its segments are not kept, yet its window is not shrunk */
+    TEST_ASSERT_EQUAL_INT(0, _receive(&_tcbs[2], nxt));
+    TEST_ASSERT_EQUAL_INT(0, _receive(&_tcbs[2], nxt + TEST_SEG_LEN));
+    TEST_ASSERT_EQUAL_INT(nxt, _tcbs[2].rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_DEFAULT_WINDOW, _tcbs[2].rcv_wnd);
+}
+
+static void test_rcvbuf__window_reopens(void)
+{
+    uint8_t buf[TEST_SEG_LEN];
+
+    _fill_budget();
+    /* reading releases a segment to the budget */
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _rcvbuf_read(&_tcbs[0], buf, sizeof(buf)));
+    for (unsigned i = 0; i < TEST_TCBS; i++) {
+        _rcvbuf_update_window(&_tcbs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _tcbs[0].rcv_wnd);
+    /* the budget no connection holds is less than a window */
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[1].rcv_wnd);
+    /* another connection may take it */
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[2], _tcbs[2].rcv_nxt));
+    TEST_ASSERT_EQUAL_INT(0, _receive(&_tcbs[2], _tcbs[2].rcv_nxt));
+    TEST_ASSERT_EQUAL_INT(0, _receive(&_tcbs[0], _tcbs[0].rcv_nxt));
+    /* the window of the first connection is not shrunk */
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _tcbs[0].rcv_wnd);
+}
+
+static void test_rcvbuf__out_of_order(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t seq = tcb->rcv_nxt;
+
+    TEST_ASSERT_EQUAL_INT(0, _receive(tcb, seq + TEST_SEG_LEN));
+    TEST_ASSERT_EQUAL_INT(2 * TEST_SEG_LEN, _receive(tcb, seq));
+    /* the segment kept out of order counts against the budget, too */
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[1], _tcbs[1].rcv_nxt));
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[1], _tcbs[1].rcv_nxt));
+    TEST_ASSERT_EQUAL_INT(0, _receive(&_tcbs[2], _tcbs[2].rcv_nxt));
+
+    TEST_ASSERT_EQUAL_INT(sizeof(_data), _rcvbuf_read(tcb, _data, sizeof(_data)));
+    for (size_t i = 0; i < sizeof(_data); i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(seq + i), _data[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_SEG_LEN, _receive(&_tcbs[2], _tcbs[2].rcv_nxt));
+}
+
+static Test *tests_rcvbuf(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rcvbuf__windows_on_open),
+        new_TestFixture(test_rcvbuf__budget_respected),
+        new_TestFixture(test_rcvbuf__window_reopens),
+        new_TestFixture(test_rcvbuf__out_of_order),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_rcvbuf());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Counts the TCP segments of request/response transactions with
+ *              and without delayed ACKs and Nagle's algorithm
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/af.h"
+#include "net/ipv6/addr.h"
+#include "net/protnum.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+
+#define TRANSACTIONS        (50U)
+#define PORT                (8080U)
+#define REQUEST_SIZE        (32U)
+#define RESPONSE_SIZE       (64U)
+#define TIMEOUT             (5U * US_PER_SEC)
+/* longer than GNRC_TCP_DELAYED_ACK_TIMEOUT, so that delayed ACKs are counted */
+#define SETTLE_TIME         (2U * GNRC_TCP_DELAYED_ACK_TIMEOUT)
+
+#define COUNTER_PRIO        (GNRC_IPV6_PRIO - 1)
+#define COUNTER_QUEUE_SIZE  (16U)
+#define SERVER_PRIO         (THREAD_PRIORITY_MAIN - 1)
+#define SERVER_QUEUE_SIZE   (4U)
+
+static const uint8_t _opts[] = {
+    0,
+    GNRC_TCP_OPT_DELAYED_ACK,
+    GNRC_TCP_OPT_NAGLE,
+    GNRC_TCP_OPT_DELAYED_ACK | GNRC_TCP_OPT_NAGLE,
+};
+
+static char _counter_stack[THREAD_STACKSIZE_DEFAULT];
+static char _server_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _counter_msg_queue[COUNTER_QUEUE_SIZE];
+static msg_t _server_msg_queue[SERVER_QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static volatile unsigned _frames;
+static gnrc_tcp_tcb_t _server_tcb;
+static gnrc_tcp_tcb_t _client_tcb;
+static unsigned _failed;
+
+static void *_counter(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_init_queue(_counter_msg_queue, COUNTER_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            /* this thread preempts the IPv6 thread, so the segment is
+             * released before GNRC TCP handles it */
+            _frames++;
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static int _recv_all(gnrc_tcp_tcb_t *tcb, uint8_t *buf, size_t len)
+{
+    size_t rcvd = 0;
+
+    while (rcvd < len) {
+        ssize_t res = gnrc_tcp_recv(tcb, buf + rcvd, len - rcvd, TIMEOUT);
+        if (res <= 0) {
+            return (int)res;
+        }
+        rcvd += res;
+    }
+    return 1;
+}
+
+static int _send_all(gnrc_tcp_tcb_t *tcb, const uint8_t *buf, size_t len)
+{
+    size_t sent = 0;
+
+    while (sent < len) {
+        ssize_t res = gnrc_tcp_send(tcb, buf + sent, len - sent, TIMEOUT);
+        if (res < 0) {
+            return (int)res;
+        }
+        sent += res;
+    }
+    return 1;
+}
+
+static void *_server(void *arg)
+{
+    uint8_t buf[RESPONSE_SIZE];
+    msg_t msg;
+    int res;
+
+    (void)arg;
+    msg_init_queue(_server_msg_queue, SERVER_QUEUE_SIZE);
+    memset(buf, 0x55, sizeof(buf));
+    while (1) {
+        /* the main thread passes the options of the next run */
+        msg_receive(&msg);
+        gnrc_tcp_tcb_init(&_server_tcb);
+        gnrc_tcp_set_opts(&_server_tcb, (uint8_t)msg.content.value);
+        if ((res = gnrc_tcp_open_passive(&_server_tcb, AF_INET6, NULL, PORT)) < 0) {
+            printf("listen failed (%d)\n", res);
+            _failed++;
+        }
+        else {
+            /* a blocking receive doesn't return on the FIN of the client, so
+             * the server answers the known number of requests */
+            for (unsigned i = 0; i < TRANSACTIONS; i++) {
+                if (((res = _recv_all(&_server_tcb, buf, REQUEST_SIZE)) <= 0) ||
+                    ((res = _send_all(&_server_tcb, buf, RESPONSE_SIZE)) < 0)) {
+                    break;
+                }
+            }
+            if (res <= 0) {
+                printf("server failed (%d)\n", res);
+                _failed++;
+            }
+            gnrc_tcp_close(&_server_tcb);
+        }
+        msg_send(&msg, _main_pid);
+    }
+    return NULL;
+}
+
+static void _run(kernel_pid_t server, uint8_t opts, unsigned writes)
+{
+    ipv6_addr_t addr = IPV6_ADDR_LOOPBACK;
+    uint8_t buf[RESPONSE_SIZE];
+    msg_t msg = { .content = { .value = opts } };
+    unsigned frames, failed = _failed;
+    uint32_t start, duration;
+    int res;
+
+    msg_send(&msg, server);
+    gnrc_tcp_tcb_init(&_client_tcb);
+    gnrc_tcp_set_opts(&_client_tcb, opts);
+    if ((res = gnrc_tcp_open_active(&_client_tcb, AF_INET6, (uint8_t *)&addr,
+                                    PORT, 0)) < 0) {
+        printf("connect failed (%d)\n", res);
+        _failed++;
+        gnrc_tcp_abort(&_server_tcb);
+        msg_receive(&msg);
+        return;
+    }
+    /* don't count the final ACK of the handshake */
+    xtimer_usleep(SETTLE_TIME);
+
+    memset(buf, 0xaa, sizeof(buf));
+    _frames = 0;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; (i < TRANSACTIONS) && (failed == _failed); i++) {
+        /* a request of one or several writes, e.g. header and body */
+        for (unsigned w = 0; w < writes; w++) {
+            if ((res = _send_all(&_client_tcb, buf, REQUEST_SIZE / writes)) < 0) {
+                printf("send failed (%d)\n", res);
+                _failed++;
+                break;
+            }
+        }
+        if ((failed == _failed) &&
+            ((res = _recv_all(&_client_tcb, buf, RESPONSE_SIZE)) <= 0)) {
+            printf("recv failed (%d)\n", res);
+            _failed++;
+        }
+    }
+    duration = xtimer_now_usec() - start;
+    xtimer_usleep(SETTLE_TIME);
+    frames = _frames;
+
+    gnrc_tcp_close(&_client_tcb);
+    msg_receive(&msg);
+
+    if (failed == _failed) {
+        printf("opts: 0x%02x writes: %u frames/transaction: %u.%02u "
+               "us/transaction: %u\n", (unsigned)opts, writes,
+               frames / TRANSACTIONS, ((frames * 100) / TRANSACTIONS) % 100,
+               (unsigned)(duration / TRANSACTIONS));
+    }
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry;
+    kernel_pid_t server;
+
+    _main_pid = thread_getpid();
+    puts("Start.");
+
+    gnrc_netreg_entry_init_pid(&entry, PROTNUM_TCP,
+                               thread_create(_counter_stack, sizeof(_counter_stack),
+                                             COUNTER_PRIO, THREAD_CREATE_STACKTEST,
+                                             _counter, NULL, "counter"));
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &entry);
+    server = thread_create(_server_stack, sizeof(_server_stack), SERVER_PRIO,
+                           THREAD_CREATE_STACKTEST, _server, NULL, "server");
+
+    for (unsigned writes = 1; writes <= 2; writes++) {
+        for (unsigned i = 0; i < sizeof(_opts); i++) {
+            _run(server, _opts[i], writes);
+        }
+    }
+
+    if (_failed) {
+        printf("FAILED: %u errors\n", _failed);
+        return 1;
+    }
+    puts("SUCCESS");
+    return 0;
+}
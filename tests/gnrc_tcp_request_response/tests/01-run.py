@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+def testfunc(child):
+    child.expect_exact("Start.")
+    for writes in (1, 2):
+        for opts in (0, 1, 2, 3):
+            child.expect(r"opts: 0x{:02x} writes: {} frames/transaction: \d+\.\d+ "
+                         r"us/transaction: \d+".format(opts, writes))
+    child.expect_exact("SUCCESS")
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc, timeout=60))
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Measures the goodput of the benchmark for a number of loss rates.
+
+Needs the TAP interface and a discarding server on the host as described in
+README.md and runs `tc` with sudo. Run it from the application directory:
+
+    ./loss_sweep.py fe80::<host IID> 8080
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+TAP = os.environ.get('PORT', 'tap0')
+IFB = 'ifb0'
+
+
+def tc(*args, check=True):
+    cmd = ['sudo', 'tc'] + list(args)
+    if check:
+        subprocess.check_call(cmd)
+    else:
+        subprocess.call(cmd, stderr=subprocess.DEVNULL)
+
+
+def setup(delay):
+    subprocess.check_call(['sudo', 'modprobe', 'ifb'])
+    subprocess.check_call(['sudo', 'ip', 'link', 'set', IFB, 'up'])
+    tc('qdisc', 'add', 'dev', TAP, 'ingress')
+    tc('filter', 'add', 'dev', TAP, 'parent', 'ffff:', 'matchall', 'action',
+       'mirred', 'egress', 'redirect', 'dev', IFB)
+    tc('qdisc', 'add', 'dev', IFB, 'root', 'netem', 'delay', delay)
+    tc('qdisc', 'add', 'dev', TAP, 'root', 'netem', 'loss', '0%')
+
+
+def set_loss(delay, loss):
+    tc('qdisc', 'change', 'dev', IFB, 'root', 'netem', 'delay', delay,
+       'loss', loss)
+    tc('qdisc', 'change', 'dev', TAP, 'root', 'netem', 'loss', loss)
+
+
+def teardown():
+    tc('qdisc', 'del', 'dev', TAP, 'root', check=False)
+    tc('qdisc', 'del', 'dev', TAP, 'ingress', check=False)
+    tc('qdisc', 'del', 'dev', IFB, 'root', check=False)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('addr', help='link-local address of the host')
+    parser.add_argument('port', help='port of the discarding server')
+    parser.add_argument('--kbyte', type=int, default=256,
+                        help='data sent per run')
+    parser.add_argument('--runs', type=int, default=10,
+                        help='runs per loss rate')
+    parser.add_argument('--delay', default='20ms',
+                        help='one-way delay of data segments')
+    parser.add_argument('--loss', nargs='+', default=['1%', '5%', '10%'],
+                        help='loss rates in both directions')
+    args = parser.parse_args()
+    results = {}
+
+    def testfunc(child):
+        child.expect(r'GNRC TCP throughput benchmark')
+        for loss in args.loss:
+            set_loss(args.delay, loss)
+            results[loss] = []
+            for _ in range(args.runs):
+                child.sendline('tcp_bench {} {} {}'.format(args.addr, args.port,
+                                                           args.kbyte))
+                child.expect(r'sent \d+ bytes in \d+ us \((\d+) kbit/s\)|error: .*',
+                             timeout=600)
+                if child.match.group(1) is not None:
+                    results[loss].append(int(child.match.group(1)))
+
+    setup(args.delay)
+    try:
+        res = testrunner.run(testfunc, echo=False)
+    finally:
+        teardown()
+
+    print('loss  runs  goodput [kbit/s]    min    max')
+    for loss in args.loss:
+        rates = results.get(loss, [])
+        if rates:
+            print('{:>4}  {:>4}  {:>16}  {:>5}  {:>5}'.format(
+                loss, len(rates), sum(rates) // len(rates), min(rates),
+                max(rates)))
+        else:
+            print('{:>4}  {:>4}  {:>16}'.format(loss, 0, '-'))
+    return res
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the bulk transfer throughput of GNRC TCP
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "shell.h"
+#include "xtimer.h"
+#include "net/af.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/tcp.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BENCH_DEFAULT_KBYTE (256U)
+#define BENCH_CHUNK_SIZE    (1024U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _chunk[BENCH_CHUNK_SIZE];
+
+static int _tcp_bench(int argc, char **argv)
+{
+    ipv6_addr_t addr;
+    uint32_t total, sent = 0, start, duration;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <addr> <port> [kbyte]\n", argv[0]);
+        return 1;
+    }
+    if (ipv6_addr_from_str(&addr, argv[1]) == NULL) {
+        puts("error: unable to parse address");
+        return 1;
+    }
+    total = ((argc > 3) ? (uint32_t)atoi(argv[3]) : BENCH_DEFAULT_KBYTE) * 1024;
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open_active(&_tcb, AF_INET6, (uint8_t *)&addr, atoi(argv[2]), 0);
+    if (res < 0) {
+        printf("error: unable to connect (%d)\n", res);
+        return 1;
+    }
+    start = xtimer_now_usec();
+    while (sent < total) {
+        size_t len = total - sent;
+
+        len = (len < sizeof(_chunk)) ? len : sizeof(_chunk);
+        res = gnrc_tcp_send(&_tcb, _chunk, len, 0);
+        if (res < 0) {
+            printf("error: send failed after %" PRIu32 " bytes (%d)\n", sent, res);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += res;
+    }
+    /* returns once the peer acknowledged all data */
+    gnrc_tcp_close(&_tcb);
+    duration = xtimer_now_usec() - start;
+    printf("sent %" PRIu32 " bytes in %" PRIu32 " us (%" PRIu32 " kbit/s)\n",
+           sent, duration, (uint32_t)(((uint64_t)sent * 8 * MS_PER_SEC) / duration));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tcp_bench", "send [kbyte] to <addr> <port> and measure throughput", _tcp_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    memset(_chunk, 'R', sizeof(_chunk));
+    printf("GNRC TCP throughput benchmark, MSS %u, %u segments in flight\n",
+           GNRC_TCP_MSS, GNRC_TCP_RTX_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests poll() and select() on POSIX sockets
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "netinet/in.h"
+#include "sys/socket.h"
+
+#define PORT1           (4711U)
+#define PORT2           (4712U)
+#define TIMEOUT_MS      (100U)
+#define SEND_DELAY      (50U * US_PER_MS)
+
+static char _sender_stack[THREAD_STACKSIZE_DEFAULT];
+static unsigned _failed;
+
+#define CHECK(cond)     if (!(cond)) { \
+                            printf("%s:%d: failed: %s\n", __FILE__, __LINE__, \
+                                   #cond); \
+                            _failed++; \
+                        }
+
+static int _socket(uint16_t port)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_port = htons(port) };
+    int fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    if ((fd < 0) ||
+        (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+        printf("unable to create socket (%d)\n", errno);
+        return -1;
+    }
+    return fd;
+}
+
+static void *_sender(void *arg)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_port = htons((uintptr_t)arg),
+                                 .sin6_addr = IN6ADDR_LOOPBACK_INIT };
+    int fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    /* the main thread is blocked in poll() or select() by now */
+    xtimer_usleep(SEND_DELAY);
+    if ((fd < 0) || (sendto(fd, "ABCD", sizeof("ABCD"), 0,
+                            (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+        printf("unable to send (%d)\n", errno);
+    }
+    close(fd);
+    return NULL;
+}
+
+static void _send_delayed(uint16_t port)
+{
+    thread_create(_sender_stack, sizeof(_sender_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _sender, (void *)(uintptr_t)port, "sender");
+}
+
+static void test_poll(int fd1, int fd2)
+{
+    struct pollfd fds[] = { { .fd = fd1, .events = POLLIN },
+                            { .fd = fd2, .events = POLLIN },
+                            { .fd = -1, .events = POLLIN } };
+    uint32_t start;
+    char buf[8];
+
+    puts("poll: nothing received");
+    CHECK(poll(fds, 3, 0) == 0);
+    start = xtimer_now_usec();
+    CHECK(poll(fds, 3, TIMEOUT_MS) == 0);
+    CHECK((xtimer_now_usec() - start) >= (TIMEOUT_MS * US_PER_MS));
+
+    puts("poll: wait for datagram");
+    _send_delayed(PORT2);
+    CHECK(poll(fds, 3, -1) == 1);
+    CHECK(fds[0].revents == 0);
+    CHECK(fds[1].revents == POLLIN);
+    CHECK(fds[2].revents == 0);
+    CHECK(recv(fd2, buf, sizeof(buf), 0) == sizeof("ABCD"));
+    CHECK(poll(fds, 3, 0) == 0);
+
+    puts("poll: writable and invalid fds");
+    fds[0].events = POLLOUT;
+    fds[2].fd = fd2 + 1;
+    CHECK(poll(fds, 3, -1) == 2);
+    CHECK(fds[0].revents == POLLOUT);
+    CHECK(fds[1].revents == 0);
+    CHECK(fds[2].revents == POLLNVAL);
+}
+
+static void test_select(int fd1, int fd2)
+{
+    struct timeval timeout = { .tv_sec = 0, .tv_usec = TIMEOUT_MS * US_PER_MS };
+    fd_set readfds;
+    char buf[8];
+    int nfds = ((fd1 > fd2) ? fd1 : fd2) + 1;
+
+    puts("select: nothing received");
+    FD_ZERO(&readfds);
+    FD_SET(fd1, &readfds);
+    FD_SET(fd2, &readfds);
+    CHECK(select(nfds, &readfds, NULL, NULL, &timeout) == 0);
+    CHECK(!FD_ISSET(fd1, &readfds) && !FD_ISSET(fd2, &readfds));
+
+    puts("select: wait for datagram");
+    FD_SET(fd1, &readfds);
+    FD_SET(fd2, &readfds);
+    _send_delayed(PORT1);
+    CHECK(select(nfds, &readfds, NULL, NULL, NULL) == 1);
+    CHECK(FD_ISSET(fd1, &readfds) && !FD_ISSET(fd2, &readfds));
+    CHECK(recv(fd1, buf, sizeof(buf), 0) == sizeof("ABCD"));
+
+    puts("select: invalid fd");
+    FD_ZERO(&readfds);
+    FD_SET(nfds, &readfds);
+    CHECK((select(nfds + 1, &readfds, NULL, NULL, NULL) == -1) &&
+          (errno == EBADF));
+    CHECK(FD_ISSET(nfds, &readfds));
+}
+
+int main(void)
+{
+    int fd1, fd2;
+
+    puts("Start.");
+    if (((fd1 = _socket(PORT1)) < 0) || ((fd2 = _socket(PORT2)) < 0)) {
+        return 1;
+    }
+    test_poll(fd1, fd2);
+    test_select(fd1, fd2);
+    close(fd1);
+    close(fd2);
+    if (_failed) {
+        printf("FAILED: %u errors\n", _failed);
+        return 1;
+    }
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+def testfunc(child):
+    child.expect_exact("Start.")
+    child.expect_exact("poll: nothing received")
+    child.expect_exact("poll: wait for datagram")
+    child.expect_exact("poll: writable and invalid fds")
+    child.expect_exact("select: nothing received")
+    child.expect_exact("select: wait for datagram")
+    child.expect_exact("select: invalid fd")
+    child.expect_exact("SUCCESS")
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
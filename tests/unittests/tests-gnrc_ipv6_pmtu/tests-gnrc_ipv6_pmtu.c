@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "embUnit.h"
+
+#include "net/ipv6.h"
+#include "net/gnrc/ipv6/pmtu.h"
+
+#include "tests-gnrc_ipv6_pmtu.h"
+
+#define TEST_DST    { { \
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 \
+        } \
+    }
+
+static void set_up(void)
+{
+    gnrc_ipv6_pmtu_flush();
+}
+
+static void test_gnrc_ipv6_pmtu_get__empty(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_pmtu_get(&dst));
+}
+
+static void test_gnrc_ipv6_pmtu_update__success(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    gnrc_ipv6_pmtu_update(&dst, 1400);
+    TEST_ASSERT_EQUAL_INT(1400, gnrc_ipv6_pmtu_get(&dst));
+}
+
+static void test_gnrc_ipv6_pmtu_update__min_mtu(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    gnrc_ipv6_pmtu_update(&dst, 576);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_pmtu_get(&dst));
+    gnrc_ipv6_pmtu_update(&dst, 1400);
+    gnrc_ipv6_pmtu_update(&dst, IPV6_MIN_MTU - 1);
+    TEST_ASSERT_EQUAL_INT(1400, gnrc_ipv6_pmtu_get(&dst));
+    gnrc_ipv6_pmtu_update(&dst, IPV6_MIN_MTU);
+    TEST_ASSERT_EQUAL_INT(IPV6_MIN_MTU, gnrc_ipv6_pmtu_get(&dst));
+}
+
+static void test_gnrc_ipv6_pmtu_update__no_increase(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    gnrc_ipv6_pmtu_update(&dst, 1400);
+    gnrc_ipv6_pmtu_update(&dst, 1500);
+    TEST_ASSERT_EQUAL_INT(1400, gnrc_ipv6_pmtu_get(&dst));
+    gnrc_ipv6_pmtu_update(&dst, 1300);
+    TEST_ASSERT_EQUAL_INT(1300, gnrc_ipv6_pmtu_get(&dst));
+}
+
+static void test_gnrc_ipv6_pmtu_update__full(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    for (unsigned i = 0; i < GNRC_IPV6_PMTU_CACHE_SIZE; i++) {
+        dst.u8[15] = i;
+        gnrc_ipv6_pmtu_update(&dst, 1300 + i);
+    }
+    /* does not fail, but replaces an entry */
+    dst.u8[15] = GNRC_IPV6_PMTU_CACHE_SIZE;
+    gnrc_ipv6_pmtu_update(&dst, 1290);
+    TEST_ASSERT_EQUAL_INT(1290, gnrc_ipv6_pmtu_get(&dst));
+}
+
+static void test_gnrc_ipv6_pmtu_del(void)
+{
+    ipv6_addr_t dst = TEST_DST;
+
+    gnrc_ipv6_pmtu_update(&dst, 1400);
+    gnrc_ipv6_pmtu_del(&dst);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_pmtu_get(&dst));
+}
+
+Test *tests_gnrc_ipv6_pmtu_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_ipv6_pmtu_get__empty),
+        new_TestFixture(test_gnrc_ipv6_pmtu_update__success),
+        new_TestFixture(test_gnrc_ipv6_pmtu_update__min_mtu),
+        new_TestFixture(test_gnrc_ipv6_pmtu_update__no_increase),
+        new_TestFixture(test_gnrc_ipv6_pmtu_update__full),
+        new_TestFixture(test_gnrc_ipv6_pmtu_del),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_ipv6_pmtu_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_ipv6_pmtu_tests;
+}
+
+void tests_gnrc_ipv6_pmtu(void)
+{
+    TESTS_RUN(tests_gnrc_ipv6_pmtu_tests());
+}
+/** @} */
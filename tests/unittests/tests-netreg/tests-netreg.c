@@ -26,6 +26,14 @@ static gnrc_netreg_entry_t entries[] = {
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 1)
 };
 
+/* UDP entries are hashed by port: ports 1 and 1 + GNRC_NETREG_UDP_BUCKETS
+ * share a bucket */
+static gnrc_netreg_entry_t udp_entries[] = {
+    GNRC_NETREG_ENTRY_INIT_PID(1, TEST_UINT8),
+    GNRC_NETREG_ENTRY_INIT_PID(1 + GNRC_NETREG_UDP_BUCKETS, TEST_UINT8 + 1),
+    GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL, TEST_UINT8 + 2)
+};
+
 static void set_up(void)
 {
     gnrc_netreg_init();
@@ -139,6 +147,79 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+static void _register_udp_entries(void)
+{
+    for (unsigned i = 0; i < (sizeof(udp_entries) / sizeof(udp_entries[0])); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp_entries[i]));
+    }
+}
+
+void test_netreg_lookup__udp_same_bucket(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    _register_udp_entries();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1)));
+    TEST_ASSERT_EQUAL_INT(1, res->demux_ctx);
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                   1 + GNRC_NETREG_UDP_BUCKETS)));
+    TEST_ASSERT_EQUAL_INT(1 + GNRC_NETREG_UDP_BUCKETS, res->demux_ctx);
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8 + 1, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 2));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1 + (2 * GNRC_NETREG_UDP_BUCKETS)));
+    /* the other types don't see the UDP entries */
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, 1));
+}
+
+void test_netreg_lookup__udp_ctx_all(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    _register_udp_entries();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                   GNRC_NETREG_DEMUX_CTX_ALL)));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETREG_DEMUX_CTX_ALL, res->demux_ctx);
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8 + 2, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    /* a port is not found by an entry for all ports */
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp_entries[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1));
+}
+
+void test_netreg_num__udp_same_bucket(void)
+{
+    _register_udp_entries();
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, 1));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, 1 + GNRC_NETREG_UDP_BUCKETS));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UDP, 2));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, 1));
+}
+
+void test_netreg_unregister__udp_same_bucket(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    _register_udp_entries();
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp_entries[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UDP, 1));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                   1 + GNRC_NETREG_UDP_BUCKETS)));
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8 + 1, res->target.pid);
+    TEST_ASSERT_NOT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL));
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp_entries[1]);
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1 + GNRC_NETREG_UDP_BUCKETS));
+    TEST_ASSERT_NOT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL));
+    /* unregistering an entry twice changes nothing */
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp_entries[0]);
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp_entries[2]);
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +236,10 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__udp_same_bucket),
+        new_TestFixture(test_netreg_lookup__udp_ctx_all),
+        new_TestFixture(test_netreg_num__udp_same_bucket),
+        new_TestFixture(test_netreg_unregister__udp_same_bucket),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
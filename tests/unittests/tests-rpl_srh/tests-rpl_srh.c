@@ -11,6 +11,7 @@
  *
  * @file
  */
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include "embUnit.h"
@@ -36,6 +37,15 @@
                                0x00, 0x00, 0x00, 0x00, \
                                0x00, 0x00, 0x00, 0x03 }}
 
+#define IPV6_ROOT           {{ 0x20, 0x01, 0xab, 0xcd, \
+                               0x00, 0x00, 0x00, 0x00, \
+                               0x00, 0x00, 0x00, 0x00, \
+                               0x00, 0x00, 0x01, 0x00 }}
+#define IPV6_OTHER          {{ 0x20, 0x01, 0xab, 0xcd, \
+                               0x00, 0x00, 0x00, 0x00, \
+                               0x00, 0x00, 0x00, 0x00, \
+                               0x00, 0x00, 0x00, 0x04 }}
+
 #define IPV6_ADDR1_ELIDED   { 0x00, 0x00, 0x02 }
 #define IPV6_ADDR2_ELIDED   { 0x00, 0x00, 0x03 }
 #define IPV6_ELIDED_PREFIX  (13)
@@ -105,6 +115,138 @@ static void test_rpl_srh_nexthop_prefix_elided(void)
     TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &expected2));
 }
 
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+#define ROOT_LIFETIME       (60U)
+
+static void set_up_root(void)
+{
+    /* root -> IPV6_DST -> IPV6_ADDR1 -> IPV6_ADDR2 */
+    ipv6_addr_t root = IPV6_ROOT, dst = IPV6_DST, a1 = IPV6_ADDR1,
+                a2 = IPV6_ADDR2;
+
+    gnrc_rpl_srh_root_init(&root);
+    gnrc_rpl_srh_root_update(&dst, &root, ROOT_LIFETIME);
+    gnrc_rpl_srh_root_update(&a1, &dst, ROOT_LIFETIME);
+    gnrc_rpl_srh_root_update(&a2, &a1, ROOT_LIFETIME);
+}
+
+static void test_rpl_srh_root_get__child(void)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_addr_t dst = IPV6_DST, first_hop;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_srh_root_get(&dst, &first_hop, buf,
+                                                   sizeof(buf)));
+    TEST_ASSERT(ipv6_addr_equal(&dst, &first_hop));
+}
+
+static void test_rpl_srh_root_get__unknown(void)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_addr_t other = IPV6_OTHER, first_hop;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_srh_root_get(&other, &first_hop,
+                                                         buf, sizeof(buf)));
+}
+
+static void test_rpl_srh_root_get__too_small(void)
+{
+    uint8_t buf[sizeof(gnrc_rpl_srh_t)];
+    ipv6_addr_t a2 = IPV6_ADDR2, first_hop;
+
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, gnrc_rpl_srh_root_get(&a2, &first_hop,
+                                                          buf, sizeof(buf)));
+}
+
+static void test_rpl_srh_root_get__compressed(void)
+{
+    ipv6_hdr_t hdr;
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    gnrc_rpl_srh_t *srh = (gnrc_rpl_srh_t *) buf;
+    ipv6_addr_t dst = IPV6_DST, a1 = IPV6_ADDR1, a2 = IPV6_ADDR2;
+    int res;
+
+    res = gnrc_rpl_srh_root_get(&a2, &hdr.dst, buf, sizeof(buf));
+    /* both addresses share all but the last octet with the previous hop */
+    TEST_ASSERT_EQUAL_INT(2 * sizeof(gnrc_rpl_srh_t), res);
+    TEST_ASSERT(ipv6_addr_equal(&dst, &hdr.dst));
+    TEST_ASSERT_EQUAL_INT(1, srh->len);
+    TEST_ASSERT_EQUAL_INT(GNRC_RPL_SRH_TYPE, srh->type);
+    TEST_ASSERT_EQUAL_INT(SRH_SEG_LEFT, srh->seg_left);
+    TEST_ASSERT_EQUAL_INT(0xff, srh->compr);
+    TEST_ASSERT_EQUAL_INT(6 << 4, srh->pad_resv);
+
+    /* the header is processed by the hops down the DODAG */
+    res = gnrc_rpl_srh_process(&hdr, srh);
+    TEST_ASSERT_EQUAL_INT(EXT_RH_CODE_FORWARD, res);
+    TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &a1));
+    res = gnrc_rpl_srh_process(&hdr, srh);
+    TEST_ASSERT_EQUAL_INT(EXT_RH_CODE_FORWARD, res);
+    TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &a2));
+    TEST_ASSERT_EQUAL_INT(EXT_RH_CODE_OK, gnrc_rpl_srh_process(&hdr, srh));
+}
+
+static void test_rpl_srh_root_get__parent_changed(void)
+{
+    ipv6_hdr_t hdr;
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    gnrc_rpl_srh_t *srh = (gnrc_rpl_srh_t *) buf;
+    ipv6_addr_t dst = IPV6_DST, a2 = IPV6_ADDR2;
+
+    /* fill the cache */
+    TEST_ASSERT(gnrc_rpl_srh_root_get(&a2, &hdr.dst, buf, sizeof(buf)) > 0);
+    TEST_ASSERT_EQUAL_INT(SRH_SEG_LEFT, srh->seg_left);
+
+    /* IPV6_ADDR2 moves directly below IPV6_DST */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_srh_root_update(&a2, &dst, ROOT_LIFETIME));
+    TEST_ASSERT_EQUAL_INT(sizeof(gnrc_rpl_srh_t) + sizeof(gnrc_rpl_srh_t),
+                          gnrc_rpl_srh_root_get(&a2, &hdr.dst, buf, sizeof(buf)));
+    TEST_ASSERT(ipv6_addr_equal(&dst, &hdr.dst));
+    TEST_ASSERT_EQUAL_INT(1, srh->seg_left);
+    TEST_ASSERT_EQUAL_INT(EXT_RH_CODE_FORWARD, gnrc_rpl_srh_process(&hdr, srh));
+    TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &a2));
+}
+
+static void test_rpl_srh_root_get__removed(void)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_addr_t a1 = IPV6_ADDR1, a2 = IPV6_ADDR2, first_hop;
+
+    TEST_ASSERT(gnrc_rpl_srh_root_get(&a2, &first_hop, buf, sizeof(buf)) > 0);
+    /* a No-Path DAO of a hop on the route */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_srh_root_update(&a1, &a1, 0));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_srh_root_get(&a2, &first_hop, buf,
+                                                         sizeof(buf)));
+}
+
+static void test_rpl_srh_root_get__loop(void)
+{
+    uint8_t buf[GNRC_RPL_SRH_ROOT_HDR_MAX_LEN];
+    ipv6_addr_t dst = IPV6_DST, a2 = IPV6_ADDR2, first_hop;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_srh_root_update(&dst, &a2, ROOT_LIFETIME));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_rpl_srh_root_get(&a2, &first_hop, buf,
+                                                         sizeof(buf)));
+}
+
+Test *tests_rpl_srh_root_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rpl_srh_root_get__child),
+        new_TestFixture(test_rpl_srh_root_get__unknown),
+        new_TestFixture(test_rpl_srh_root_get__too_small),
+        new_TestFixture(test_rpl_srh_root_get__compressed),
+        new_TestFixture(test_rpl_srh_root_get__parent_changed),
+        new_TestFixture(test_rpl_srh_root_get__removed),
+        new_TestFixture(test_rpl_srh_root_get__loop),
+    };
+
+    EMB_UNIT_TESTCALLER(rpl_srh_root_tests, set_up_root, NULL, fixtures);
+
+    return (Test *)&rpl_srh_root_tests;
+}
+#endif
+
 Test *tests_rpl_srh_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -120,5 +262,8 @@ Test *tests_rpl_srh_tests(void)
 void tests_rpl_srh(void)
 {
     TESTS_RUN(tests_rpl_srh_tests());
+#ifdef MODULE_GNRC_RPL_SRH_ROOT
+    TESTS_RUN(tests_rpl_srh_root_tests());
+#endif
 }
 /** @} */
@@ -13,12 +13,14 @@
  */
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 #include "embUnit.h"
 
 #include "net/ipv6/addr.h"
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "xtimer.h"
 
 #include "unittests-constants.h"
 #include "tests-sixlowpan_ctx.h"
@@ -30,6 +32,7 @@
         } \
     }
 #define DEFAULT_TEST_PREFIX_LEN (63)
+#define BENCHMARK_LOOKUPS       (10000U)
 
 #define OTHER_TEST_ID         (12)
 #define OTHER_TEST_PREFIX   { { \
@@ -195,6 +198,68 @@ static void test_sixlowpan_ctx_remove(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_version(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    uint16_t version = gnrc_sixlowpan_ctx_version();
+
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+    version = gnrc_sixlowpan_ctx_version();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+}
+
+static void test_sixlowpan_ctx_lookup_addr__longest_prefix(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    /* add context DEFAULT_TEST_PREFIX to DEFAULT_TEST_ID */
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(OTHER_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN + 9,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | OTHER_TEST_ID, ctx->flags_id);
+    /* flip last bit of the longer prefix */
+    addr.u8[8] ^= 0x80;
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID, ctx->flags_id);
+}
+
+static void test_sixlowpan_ctx_lookup_addr__benchmark(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    uint32_t start, duration;
+
+    /* fill buffer with contexts that differ only in their last prefix bits,
+     * so every lookup compares all of them */
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        addr.u8[7] = id << 1;
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(id, &addr,
+                                                       DEFAULT_TEST_PREFIX_LEN,
+                                                       TEST_UINT16, true));
+    }
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < BENCHMARK_LOOKUPS; i++) {
+        gnrc_sixlowpan_ctx_t *ctx;
+
+        addr.u8[7] = (i % GNRC_SIXLOWPAN_CTX_SIZE) << 1;
+        ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr);
+        TEST_ASSERT_NOT_NULL(ctx);
+        TEST_ASSERT_EQUAL_INT(i % GNRC_SIXLOWPAN_CTX_SIZE,
+                              ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+    }
+    duration = xtimer_now_usec() - start;
+    printf("\n%u context lookups with %u contexts took %" PRIu32 " us\n",
+           BENCHMARK_LOOKUPS, GNRC_SIXLOWPAN_CTX_SIZE, duration);
+}
+
 Test *tests_sixlowpan_ctx_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -211,6 +276,9 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
         new_TestFixture(test_sixlowpan_ctx_remove),
+        new_TestFixture(test_sixlowpan_ctx_version),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__longest_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__benchmark),
     };
 
     EMB_UNIT_TESTCALLER(sixlowpan_ctx_tests, NULL, tear_down, fixtures);
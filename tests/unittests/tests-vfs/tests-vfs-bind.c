@@ -19,6 +19,7 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <poll.h>
 
 #include "embUnit/embUnit.h"
 
@@ -34,15 +35,23 @@ static const uint8_t str_data[] = "This is a test file";
 
 static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes);
 static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static int _mock_poll(vfs_file_t *filp, int events);
 
 static volatile int _mock_write_calls = 0;
 static volatile int _mock_read_calls = 0;
+static volatile int _mock_poll_ready = 0;
 
 static vfs_file_ops_t _test_bind_ops = {
     .read = _mock_read,
     .write = _mock_write,
 };
 
+static vfs_file_ops_t _test_bind_poll_ops = {
+    .read = _mock_read,
+    .write = _mock_write,
+    .poll = _mock_poll,
+};
+
 static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     void *dest = filp->private_data.ptr;
@@ -65,6 +74,12 @@ static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
     return nbytes;
 }
 
+static int _mock_poll(vfs_file_t *filp, int events)
+{
+    (void)filp;
+    return _mock_poll_ready & events;
+}
+
 static void test_vfs_bind(void)
 {
     int fd;
@@ -107,11 +122,50 @@ static void test_vfs_bind__leak_fds(void)
     test_vfs_bind();
 }
 
+static void test_vfs_bind__poll(void)
+{
+    uint8_t buf[_VFS_TEST_BIND_BUFSIZE];
+    int fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_test_bind_poll_ops, &buf[0]);
+    TEST_ASSERT(fd >= 0);
+    if (fd < 0) {
+        return;
+    }
+
+    _mock_poll_ready = 0;
+    TEST_ASSERT_EQUAL_INT(0, vfs_poll(fd, POLLIN | POLLOUT));
+    _mock_poll_ready = POLLIN;
+    TEST_ASSERT_EQUAL_INT(POLLIN, vfs_poll(fd, POLLIN | POLLOUT));
+    TEST_ASSERT_EQUAL_INT(0, vfs_poll(fd, POLLOUT));
+
+    int res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(-EBADF, vfs_poll(fd, POLLIN));
+}
+
+static void test_vfs_bind__poll_default(void)
+{
+    uint8_t buf[_VFS_TEST_BIND_BUFSIZE];
+    int fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_test_bind_ops, &buf[0]);
+    TEST_ASSERT(fd >= 0);
+    if (fd < 0) {
+        return;
+    }
+
+    /* files without poll() are always ready */
+    TEST_ASSERT_EQUAL_INT(POLLIN | POLLOUT, vfs_poll(fd, POLLIN | POLLOUT));
+    TEST_ASSERT_EQUAL_INT(POLLOUT, vfs_poll(fd, POLLOUT | POLLPRI));
+
+    int res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 Test *tests_vfs_bind_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_vfs_bind),
         new_TestFixture(test_vfs_bind__leak_fds),
+        new_TestFixture(test_vfs_bind__poll),
+        new_TestFixture(test_vfs_bind__poll_default),
     };
 
     EMB_UNIT_TESTCALLER(vfs_bind_tests, NULL, NULL, fixtures);